@@ -29,34 +29,54 @@
 
 // Fonctions privées ===========================================================
 
-// Libère un noeud du type cross -----------------------------------------------
-void ReleaseCrossFunc
-  (uint32_t pKey,   //: Clé (médiaNo) du noeud à supprimer
-   void*    pValue) //: Valeur (cross) du noeud à supprimer
+// Affiche un noeud du type wait -----------------------------------------------
+void PrintWaitFunc
+  (void* pValue) //: Valeur (wait) du noeud
 {
-  if (pValue) sCrossFec_Release (pValue);
+  if (pValue) sWaitFec_Print (pValue);
 }
 
-// Libère un noeud du type wait ------------------------------------------------
-void ReleaseWaitFunc
-  (uint32_t pKey,   //: Clé (fecNo) du noeud à supprimer
-   void*    pValue) //: Valeur (wait) du noeud à supprimer
+// Comptabilise un wait alloué (pSigne = 1) ou libéré (pSigne = -1) ------------
+static void CompteWait
+  (sMemoire*       pMemoire, //: Comptabilité à mettre à jour (0 = aucune)
+   const sWaitFec* pWait,    //: Wait alloué ou libéré
+   int             pSigne)   //: 1 = allocation, -1 = libération
 {
-  if (pValue) sWaitFec_Release (pValue);
-}
+  int64_t _taille = CACHE_ALIGN (sizeof (sWaitFec) + pWait->capacity);
 
-// Affiche un noeud du type cross ----------------------------------------------
-void PrintCrossFunc
-  (void* pValue) //: Valeur (cross) du noeud
-{
-  if (pValue) sCrossFec_Print (pValue);
+  MEMOIRE (pMemoire, MEM_WAIT,   pSigne, pSigne * (_taille - pWait->capacity))
+  MEMOIRE (pMemoire, MEM_RESXOR, pSigne, pSigne * (int64_t)pWait->capacity)
 }
 
-// Affiche un noeud du type wait -----------------------------------------------
-void PrintWaitFunc
-  (void* pValue) //: Valeur (wait) du noeud
+// Comptabilise tous les waits du buffer, de l'arbre ou recyclés (+/-) ---------
+static void CompteWaits
+  (sBufferFec* pBuffer, //: Buffer dont les waits sont comptés
+   int         pSigne)  //: 1 = allocation, -1 = libération
 {
-  if (pValue) sWaitFec_Print (pValue);
+  unsigned d;
+
+  for (d = COL; d <= ROW; d++)
+  {
+    int64_t _noeuds = pSigne * (int64_t)pBuffer->wait[d].count;
+
+    MEMOIRE (pBuffer->memoire, MEM_NOEUD,
+             _noeuds, _noeuds * (int64_t)sizeof (sRbNode))
+
+    sRbTree_InitForeach (&pBuffer->wait[d], false);
+
+    while (sRbTree_NextForeach (&pBuffer->wait[d]))
+    {
+      CompteWait
+        (pBuffer->memoire, sRbTree_ForeachValue (&pBuffer->wait[d]), pSigne);
+    }
+  }
+
+  sWaitFec* _wait;
+
+  for (_wait = pBuffer->recycled; _wait; _wait = _wait->next)
+  {
+    CompteWait (pBuffer->memoire, _wait, pSigne);
+  }
 }
 
 // Fonctions publiques =========================================================
@@ -68,9 +88,11 @@ sBufferFec sBufferFec_New()
 {
   sBufferFec _buffer;
 
-  _buffer.cross     = sRbTree_New (ReleaseCrossFunc, PrintCrossFunc);
-  _buffer.wait[COL] = sRbTree_New (ReleaseWaitFunc,  PrintWaitFunc);
-  _buffer.wait[ROW] = sRbTree_New (ReleaseWaitFunc,  PrintWaitFunc);
+  // Les waits sont recyclés par le buffer, pas libérés par l'arbre
+  _buffer.wait[COL] = sRbTree_New (0, PrintWaitFunc);
+  _buffer.wait[ROW] = sRbTree_New (0, PrintWaitFunc);
+  _buffer.recycled  = 0;
+  _buffer.memoire   = 0;
 
   return _buffer;
 }
@@ -81,47 +103,88 @@ void sBufferFec_Release
 {
   ASSERTpc (pBuffer,, cExNullPtr)
 
-  sRbTree_Release (&pBuffer->cross);
-  sRbTree_Release (&pBuffer->wait[COL]);
-  sRbTree_Release (&pBuffer->wait[ROW]);
+  if (pBuffer->memoire) CompteWaits (pBuffer, -1);
+
+  unsigned d;
+
+  for (d = COL; d <= ROW; d++)
+  {
+    sRbTree_InitForeach (&pBuffer->wait[d], false);
+
+    while (sRbTree_NextForeach (&pBuffer->wait[d]))
+    {
+      sWaitFec_Release (sRbTree_ForeachValue (&pBuffer->wait[d]));
+    }
+
+    sRbTree_Release (&pBuffer->wait[d]);
+  }
+
+  while (pBuffer->recycled)
+  {
+    sWaitFec* _next = pBuffer->recycled->next;
+    sWaitFec_Release (pBuffer->recycled);
+    pBuffer->recycled = _next;
+  }
 }
 
-// Insère un nouveau cross dans le buffer de FEC -------------------------------
-//> Status de l'opération / ajout réussi ?
-bool sBufferFec_AddCrossByReference
-  (sBufferFec* pBuffer,  //: Buffer à modifier
-   sMediaNo    pMediaNo, //: Lier le cross à ce médiaNo
-   sCrossFec*  pCross,   //: Cross à ajouter
-   bool pOver) //: Faut-il écraser un noeud qui porterait déjà key=médiaNo ?
+// Attache une comptabilité mémoire au buffer (waits et noeuds actuels  --------
+// y sont comptés, puis chaque allocation ou libération)                --------
+// Remarque : la comptabilité doit survivre au buffer (sBufferFec_Release) -----
+void sBufferFec_Comptabilise
+  (sBufferFec* pBuffer,  //: Buffer à comptabiliser
+   sMemoire*   pMemoire) //: Comptabilité à mettre à jour
 {
-  ASSERTpc (pBuffer, false, cExNullPtr)
-  ASSERTpc (pCross,  false, cExNullPtr)
+  ASSERTpc (pBuffer,,  cExNullPtr)
+  ASSERTpc (pMemoire,, cExNullPtr)
+
+  pBuffer->memoire = pMemoire;
 
-  // Enregistre le cross dans bufferFec.cross
-  return sRbTree_AddByReference
-    (&pBuffer->cross, pMediaNo, (void*)pCross, pOver) != 0;
+  CompteWaits (pBuffer, 1);
 }
 
-// Retrouve un cross lié au médiaNo donné en paramètre -------------------------
-//> Pointeur sur le cross lié à key=médiaNo ou 0 si inexistant
-sCrossFec* sBufferFec_FindCross
-  (const sBufferFec* pBuffer,  //: Buffer à traiter
-         sMediaNo    pMediaNo) //: Paramètre de recherche
+// Créé un wait à partir d'un paquet de FEC en réutilisant si possible un   ----
+// wait recyclé (ne pas oublier de le rendre avec sBufferFec_RecycleWait !) ----
+//> Pointeur sur le wait ou 0 si problème
+sWaitFec* sBufferFec_ForgeWait
+  (      sBufferFec* pBuffer, //: Buffer à modifier
+   const sPaquetFec* pFec)    //: Le paquet d'où prendre les paramètres
 {
   ASSERTpc (pBuffer, 0, cExNullPtr)
+  ASSERTpc (pFec,    0, cExNullPtr)
+
+  sWaitFec* _wait = pBuffer->recycled;
+
+  // Un wait recyclé trop petit reste dans la liste, jamais libéré (génération)
+  if (_wait && _wait->capacity >= pFec->DWORD0.Length_recovery)
+  {
+    pBuffer->recycled = _wait->next;
+  }
+  else
+  {
+    _wait = sWaitFec_New (pFec->DWORD0.Length_recovery, false);
+    IFNOT (_wait, 0) // Allocation ratée ?
+
+    CompteWait (pBuffer->memoire, _wait, 1);
+  }
+
+  bool      ok = sWaitFec_Fill (_wait, pFec);
+  IFNOT_OP (ok, sBufferFec_RecycleWait (pBuffer, _wait), 0) // Copie ratée ?
 
-  return sRbTree_Lookup (&pBuffer->cross, pMediaNo);
+  return _wait;
 }
 
-// Supprime un cross -----------------------------------------------------------
-//> Status de l'opération
-bool sBufferFec_DeleteCross
-  (sBufferFec* pBuffer,  //: Buffer à modifier
-   sMediaNo    pMediaNo) //: MédiaNo du cross à supprimer
+// Rend un wait au buffer : sa génération change, les liens vers lui des -------
+// cross deviennent donc invalides                                       -------
+void sBufferFec_RecycleWait
+  (sBufferFec* pBuffer, //: Buffer à modifier
+   sWaitFec  * pWait)   //: Wait à recycler (ne doit plus être dans wait[D])
 {
-  ASSERTpc (pBuffer, false, cExNullPtr)
+  ASSERTpc (pBuffer,, cExNullPtr)
+  ASSERTpc (pWait,,   cExNullPtr)
 
-  return sRbTree_Delete (&pBuffer->cross, pMediaNo);
+  pWait->generation++;
+  pWait->next       = pBuffer->recycled;
+  pBuffer->recycled = pWait;
 }
 
 // Insère un nouveau wait ------------------------------------------------------
@@ -136,8 +199,19 @@ bool sBufferFec_AddWaitByReference
 
   // Enregistre le wait dans bufferFec.wait[D]
 
-  return sRbTree_AddByReference (&pBuffer->wait[pWait->D],
-                                 pWait->fecNo, (void*)pWait, pOver) != 0;
+  sRbTree* _arbre = &pBuffer->wait[pWait->D];
+  unsigned _avant = _arbre->count;
+
+  bool ok = sRbTree_AddByReference
+              (_arbre, pWait->fecNo, (void*)pWait, pOver) != 0;
+
+  // Un noeud écrasé (pOver) est réutilisé, seul un nouveau noeud compte
+  int64_t _noeuds = _arbre->count - _avant;
+
+  MEMOIRE (pBuffer->memoire, MEM_NOEUD,
+           _noeuds, _noeuds * (int64_t)sizeof (sRbNode))
+
+  return ok;
 }
 
 // Retrouve un wait lié à une direction et un fecNo donné en paramètre ---------
@@ -152,16 +226,23 @@ sWaitFec* sBufferFec_FindWait
   return sRbTree_Lookup (&pBuffer->wait[pD], pFecNo);
 }
 
-// Supprimer un wait du buffer de FEC ------------------------------------------
+// Supprimer un wait du buffer de FEC (puis le recycle) ------------------------
 //> Status de l'opération / suppression réussie ?
 bool sBufferFec_DeleteWait
   (sBufferFec* pBuffer, //: Buffer à modifier
-   eFecD       pD,      //: Faut-il opérer dans wait[COL] ou wait[ROW] ?
-   sFecNo      pFecNo)  //: fecNo du wait à supprimer
+   sWaitFec  * pWait)   //: Wait à supprimer (de wait[pWait.D])
 {
   ASSERTpc (pBuffer, false, cExNullPtr)
+  ASSERTpc (pWait,   false, cExNullPtr)
+
+  bool   ok = sRbTree_Delete (&pBuffer->wait[pWait->D], pWait->fecNo);
+  IFNOT (ok, false) // Wait introuvable ?
+
+  MEMOIRE (pBuffer->memoire, MEM_NOEUD, -1, -(int64_t)sizeof (sRbNode))
 
-  return sRbTree_Delete (&pBuffer->wait[pD], pFecNo);
+  sBufferFec_RecycleWait (pBuffer, pWait);
+
+  return true;
 }
 
 // Fait le ménage en supprimant toutes traces concernant un paquet de FEC   ----
@@ -171,47 +252,37 @@ bool sBufferFec_DeleteWait
 // le player...                                                             ----
 //> Status de l'opération / nettoyage réussi ?
 bool sBufferFec_DeleteCrossAndWait
-  (sBufferFec* pBuffer, //: Buffer à modifier
-   eFecD       pD,      //: Faut-il opérer dans wait[COL] ou wait[ROW] ?
-   sFecNo      pFecNo)  //: fecNo du wait (cross retrouvés depuis le wait)
+  (sBufferFec  * pBuffer, //: Buffer à modifier
+   sBufferMedia* pMedia,  //: Buffer média (table de slots portant les cross)
+   sWaitFec    * pWait)   //: Wait à supprimer (cross retrouvés depuis le wait)
 {
   ASSERTpc (pBuffer, false, cExNullPtr)
-
-  sWaitFec* _wait = sBufferFec_FindWait (pBuffer, pD, pFecNo);
-  IFNOT    (_wait, false) // Wait introuvable ?
+  ASSERTpc (pMedia,  false, cExNullPtr)
+  ASSERTpc (pWait,   false, cExNullPtr)
 
   uint8_t j;
 
-  for (j = 0; j < _wait->number; j++)
+  for (j = 0; j < pWait->number; j++)
   {
-    sMediaNx _mediaUpd = sWaitFec_GetManque (_wait, j + 1);
+    sMediaNx _mediaUpd = sWaitFec_GetManque (pWait, j + 1);
     ASSERTc (!_mediaUpd.null, false, cExAlgorithm)
 
-    sCrossFec* _crossUpd = sBufferFec_FindCross (pBuffer, _mediaUpd.v);
+    // Le slot du médiaNo porte directement le cross (pas de recherche)
+    sCrossFec* _crossUpd = sBufferMedia_FindCross (pMedia, _mediaUpd.v);
     if (!_crossUpd) continue;
+    if (sCrossFec_GetWait (_crossUpd, pWait->D) != pWait) continue;
 
-    if (pD == COL) { _crossUpd->colNx = FEC_NX_NULL; }
-    else           { _crossUpd->rowNx = FEC_NX_NULL; }
+    sCrossFec_Unlink (_crossUpd, pWait->D);
 
     // Entrée dans cross devenue inutile
-    if (_crossUpd->colNx.null && _crossUpd->rowNx.null)
+    if (sCrossFec_IsNull (_crossUpd))
     {
-      bool     ok = sBufferFec_DeleteCross (pBuffer, _mediaUpd.v);
+      bool     ok = sBufferMedia_DeleteCross (pMedia, _mediaUpd.v);
       ASSERTc (ok, false, cExAlgorithm)
     }
   }
 
-  return sBufferFec_DeleteWait (pBuffer, pD, pFecNo);
-}
-
-// Affiche le contenu du buffer cross ------------------------------------------
-void sBufferFec_PrintCross
-  (const sBufferFec* pBuffer,  //: Buffer à modifier
-         bool        pBuffers) //: Faut-il afficher le contenu des buffers ?
-{
-  ASSERTpc (pBuffer,, cExNullPtr)
-
-  sRbTree_Print (&pBuffer->cross, 2, pBuffers);
+  return sBufferFec_DeleteWait (pBuffer, pWait);
 }
 
 // Affiche le contenu du buffer wait -------------------------------------------
@@ -224,44 +295,3 @@ void sBufferFec_PrintWait
 
   sRbTree_Print (&pBuffer->wait[pD], 2, pBuffers);
 }
-
-// Initalise la boucle foreach like sur le buffer de FEC (cross) ---------------
-//> Status de l'opération / Est-ce que ForeachData est (un cross) valide ?
-bool sBufferFec_InitForeachCross
-  (sBufferFec* pBuffer,  //: Buffer à traiter
-   bool        pReverse) //: Faut-il effectuer la boucle à " l'envers " ?
-{
-  ASSERTpc (pBuffer, false, cExNullPtr)
-
-  return sRbTree_InitForeach (&pBuffer->cross, pReverse);
-}
-
-// Continue la boucle foreach like sur le buffer de FEC (cross) ----------------
-//> Status de l'opération / Est-ce que ForeachData est (un cross) valide ?
-bool sBufferFec_NextForeachCross
-  (sBufferFec* pBuffer) //: Buffer à traiter
-{
-  ASSERTpc (pBuffer, false, cExNullPtr)
-
-  return sRbTree_NextForeach (&pBuffer->cross);
-}
-
-// Retourne le médiaNo lié au cross (pointé) par la boucle foreach -------------
-//> médiaNo lié au cross (pointé) par la boucle foreach ou 0 si inactif
-sMediaNo sBufferFec_ForeachKeyCross
-  (const sBufferFec* pBuffer) //: Buffer à traiter
-{
-  ASSERTpc (pBuffer, 0, cExNullPtr)
-
-  return sRbTree_ForeachKey (&pBuffer->cross);
-}
-
-// Retourne un pointeur sur le cross (pointé) par la boucle foreach ------------
-//> Pointeur sur le cross (pointé) par la boucle foreach ou 0 si inactif
-sCrossFec* sBufferFec_ForeachValueCross
-  (const sBufferFec* pBuffer) //: Buffer à traiter
-{
-  ASSERTpc (pBuffer, 0, cExNullPtr)
-
-  return sRbTree_ForeachValue (&pBuffer->cross);
-}
@@ -30,11 +30,16 @@
 
 // Types de données ============================================================
 
-// Structure liant paquet de FEC et paquet média manquant ----------------------
+// Structure stockant les paquets de FEC en attente. Les cross (paquet média ---
+// manquant -> waits COL et ROW) sont dans la table de slots du buffer       ---
+// média, indexée par médiaNo (voir sMediaSlot)                              ---
+// Les waits supprimés sont recyclés (jamais libérés avant la fin) afin que ----
+// les liens directs des cross puissent être vérifiés par génération.       ----
 typedef struct
 {
-  sRbTree cross;   //. Key= paquetMedia.médiaNo, Val= Cross (FEC colNx ou rowNx)
-  sRbTree wait[2]; //. Key= {fecNo}, Val= wait (contenu utile du FEC + etc)
+  sRbTree   wait[2];  //. Key= {fecNo}, Val= wait (contenu utile du FEC + etc)
+  sWaitFec* recycled; //. Waits supprimés, réutilisables (liste chaînée)
+  sMemoire* memoire;  //. Comptabilité mémoire (0 = aucune, voir Comptabilise)
 }
   sBufferFec;
 
@@ -44,22 +49,17 @@ sBufferFec sBufferFec_New();
 
 void sBufferFec_Release (sBufferFec*);
 
-void sBufferFec_PrintCross (const sBufferFec*,        bool pBuffers);
-void sBufferFec_PrintWait  (const sBufferFec*, eFecD, bool pBuffers);
+void sBufferFec_Comptabilise (sBufferFec*, sMemoire*);
 
-bool sBufferFec_AddCrossByReference (sBufferFec*, sMediaNo, sCrossFec*, bool);
-sCrossFec* sBufferFec_FindCross   (const sBufferFec*, sMediaNo);
-bool       sBufferFec_DeleteCross (      sBufferFec*, sMediaNo);
+void sBufferFec_PrintWait (const sBufferFec*, eFecD, bool pBuffers);
+
+sWaitFec* sBufferFec_ForgeWait   (sBufferFec*, const sPaquetFec*);
+void      sBufferFec_RecycleWait (sBufferFec*, sWaitFec*);
 
 bool     sBufferFec_AddWaitByReference (sBufferFec*, sWaitFec*, bool pOver);
 sWaitFec*  sBufferFec_FindWait   (const sBufferFec*, eFecD, sFecNo);
-bool       sBufferFec_DeleteWait (      sBufferFec*, eFecD, sFecNo);
-
-bool sBufferFec_DeleteCrossAndWait (sBufferFec*, eFecD, sFecNo);
+bool       sBufferFec_DeleteWait (      sBufferFec*, sWaitFec*);
 
-bool       sBufferFec_InitForeachCross  (      sBufferFec*, bool pReverse);
-bool       sBufferFec_NextForeachCross  (      sBufferFec*);
-sMediaNo   sBufferFec_ForeachKeyCross   (const sBufferFec*);
-sCrossFec* sBufferFec_ForeachValueCross (const sBufferFec*);
+bool sBufferFec_DeleteCrossAndWait (sBufferFec*, sBufferMedia*, sWaitFec*);
 
 #endif
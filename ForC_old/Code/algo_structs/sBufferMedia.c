@@ -27,37 +27,232 @@
 
 #include "../smpte.h"
 
+#define SLOT_MOT(no) ((no) / 64)               //. Mot du bitmap lié au slot
+#define SLOT_BIT(no) ((uint64_t)1 << (no) % 64) //. Bit du mot lié au slot
+
+// Octets alloués pour un paquet média (entête + payload, voir AlignedMalloc)
+#define BLOC(size) ((int64_t)CACHE_ALIGN (sizeof (sPaquetMedia) + (size)))
+
 // Fonctions privées ===========================================================
 
-// Fonction appelée par l'arbre rb lors de la suppression d'un noeud -----------
-void ReleasePaquetMediaFunc
-  (uint32_t pKey,   //: Clé (médiaNo) du noeud à supprimer
-   void*    pValue) //: Valeur du noeud à supprimer
+// Retourne le premier slot présent à partir de pFrom (inclus) en avançant -----
+// (ou en reculant si pReverse) dans la fenêtre, sans bouclage             -----
+//> Slot trouvé ou -1 si aucun
+signed FindPresentSlot
+  (const sBufferMedia* pBuffer,  //: Buffer à traiter
+         signed        pFrom,    //: Slot de départ (inclus)
+         bool          pReverse) //: Recherche à " l'envers " ?
+{
+  if (pFrom < 0 || pFrom > (signed)pBuffer->masque) return -1;
+
+  unsigned _mot  = SLOT_MOT (pFrom);
+  uint64_t _bits = pBuffer->present[_mot];
+
+  if (pReverse)
+  {
+    _bits &= ~(uint64_t)0 >> (63 - pFrom % 64); // Garde les slots <= pFrom
+
+    while (_bits == 0)
+    {
+      if (_mot == 0) return -1;
+      _bits = pBuffer->present[--_mot];
+    }
+
+    return _mot * 64 + 63 - __builtin_clzll (_bits);
+  }
+
+  _bits &= ~(uint64_t)0 << (pFrom % 64); // Garde les slots >= pFrom
+
+  while (_bits == 0)
+  {
+    if (++_mot > SLOT_MOT (pBuffer->masque)) return -1;
+    _bits = pBuffer->present[_mot];
+  }
+
+  return _mot * 64 + __builtin_ctzll (_bits);
+}
+
+// Indique si un slot est occupé (paquet présent, cross ou lien) ---------------
+//> Le slot appartient-il (encore) au médiaNo rangé dans numero ?
+static inline bool Occupe
+  (const sBufferMedia* pBuffer, //: Buffer à traiter
+         unsigned      pSlot)   //: Slot à tester
+{
+  uint64_t _bits = pBuffer->present[SLOT_MOT (pSlot)] |
+                   pBuffer->lost   [SLOT_MOT (pSlot)];
+
+  return (_bits & SLOT_BIT (pSlot)) ||
+         pBuffer->lien[pSlot][COL] || pBuffer->lien[pSlot][ROW];
+}
+
+// Fenêtre (puissance de 2) couvrant deux fois pPaquets paquets média ----------
+//> Nombre de slots de la fenêtre
+static unsigned Fenetre
+  (unsigned pPaquets) //: Nombre de paquets média à couvrir (L×D)
 {
-  if (pValue) sPaquetMedia_Release (pValue);
+  unsigned _slots = MEDIA_SLOTS_MIN;
+
+  while (_slots < 2 * pPaquets && _slots < MEDIA_SLOTS) _slots *= 2;
+
+  return _slots;
 }
 
-// Fonction appelée par l'arbre rb lors de l'affichage d'un noeud --------------
-void PrintPaquetMediaFunc
-  (void* pValue) //: Valeur du noeud à afficher
+// Taille de la table de slots (tableaux parallèles alloués d'un bloc) ---------
+//> Taille en octets demandée à l'allocateur
+static size_t TailleTable
+  (unsigned pSlots) //: Nombre de slots de la fenêtre
 {
-  if (pValue) sPaquetMedia_Print (pValue);
+  return CACHE_ALIGN (2 * SLOT_MOT (pSlots) * sizeof (uint64_t) +
+                      pSlots * (sizeof (sMediaSlot) + 2 * sizeof (uint32_t) +
+                                sizeof (sMediaLien) + sizeof (sMediaNo) +
+                                sizeof (uint8_t)));
+}
+
+// Alloue une table (vide) de pSlots slots et y fait pointer le buffer ---------
+// Remarque : le buffer n'est pas modifié si l'allocation échoue       ---------
+//> Status de l'opération / allocation réussie ?
+static bool AlloueTable
+  (sBufferMedia* pBuffer, //: Buffer dont la table est remplacée
+   unsigned      pSlots)  //: Nombre de slots (puissance de 2)
+{
+  size_t _sizeBits = SLOT_MOT (pSlots) * sizeof (uint64_t);
+
+  uint8_t* _slots = AlignedCalloc (TailleTable (pSlots));
+  IFNOT   (_slots, false) // Allocation ratée ?
+
+  pBuffer->present     = (uint64_t*)   _slots;
+  pBuffer->lost        = (uint64_t*)   (_slots += _sizeBits);
+  pBuffer->slot        = (sMediaSlot*) (_slots += _sizeBits);
+  pBuffer->timeStamp   = (uint32_t*)   (_slots += pSlots * sizeof (sMediaSlot));
+  pBuffer->payloadSize = (uint32_t*)   (_slots += pSlots * sizeof (uint32_t));
+  pBuffer->lien        = (sMediaLien*) (_slots += pSlots * sizeof (uint32_t));
+  pBuffer->numero      = (sMediaNo*)   (_slots += pSlots * sizeof (sMediaLien));
+  pBuffer->payloadType = (uint8_t*)    (_slots += pSlots * sizeof (sMediaNo));
+  pBuffer->masque      = pSlots - 1;
+
+  return true;
+}
+
+// Agrandit la fenêtre à pSlots slots : chaque slot occupé rejoint le slot -----
+// de son médiaNo dans la nouvelle table (sans collision possible, le      -----
+// nouveau masque ne fait qu'ajouter des bits à l'ancien)                  -----
+//> Status de l'opération / agrandissement réussi ?
+static bool Agrandit
+  (sBufferMedia* pBuffer, //: Buffer à agrandir
+   unsigned      pSlots)  //: Nouveau nombre de slots (puissance de 2)
+{
+  sBufferMedia _ancien = *pBuffer;
+
+  IFNOT (AlloueTable (pBuffer, pSlots), false)
+
+  unsigned no;
+
+  for (no = 0; no <= _ancien.masque; no++)
+  {
+    if (!Occupe (&_ancien, no)) continue;
+
+    unsigned s = MEDIA_SLOT (pBuffer, _ancien.numero[no]);
+
+    if (_ancien.present[SLOT_MOT (no)] & SLOT_BIT (no))
+    {
+      pBuffer->present[SLOT_MOT (s)] |= SLOT_BIT (s);
+    }
+
+    if (_ancien.lost[SLOT_MOT (no)] & SLOT_BIT (no))
+    {
+      pBuffer->lost[SLOT_MOT (s)] |= SLOT_BIT (s);
+    }
+
+    pBuffer->slot       [s]      = _ancien.slot       [no];
+    pBuffer->timeStamp  [s]      = _ancien.timeStamp  [no];
+    pBuffer->payloadSize[s]      = _ancien.payloadSize[no];
+    pBuffer->lien       [s][COL] = _ancien.lien       [no][COL];
+    pBuffer->lien       [s][ROW] = _ancien.lien       [no][ROW];
+    pBuffer->numero     [s]      = _ancien.numero     [no];
+    pBuffer->payloadType[s]      = _ancien.payloadType[no];
+  }
+
+  if (!pBuffer->foreachNx.null)
+  {
+    pBuffer->foreachNx = sMediaNo_to_sMediaNx
+      (MEDIA_SLOT (pBuffer, _ancien.numero[_ancien.foreachNx.v]));
+  }
+
+  MEMOIRE (pBuffer->memoire, MEM_SLOTS, 0, (int64_t)TailleTable (pSlots) -
+                                (int64_t)TailleTable (_ancien.masque + 1))
+
+  AlignedFree (_ancien.present);
+
+  return true;
+}
+
+// Réserve le slot d'un médiaNo, la fenêtre est doublée tant que ce slot  ------
+// est occupé par un autre médiaNo (jamais le cas avec MEDIA_SLOTS slots) ------
+//> Slot réservé ou -1 si l'agrandissement a échoué
+static signed Reserve
+  (sBufferMedia* pBuffer,  //: Buffer à modifier
+   sMediaNo      pMediaNo) //: MédiaNo dont le slot est réservé
+{
+  unsigned s = MEDIA_SLOT (pBuffer, pMediaNo);
+
+  while (pBuffer->numero[s] != pMediaNo && Occupe (pBuffer, s))
+  {
+    IFNOT (Agrandit (pBuffer, 2 * (pBuffer->masque + 1)), -1)
+
+    s = MEDIA_SLOT (pBuffer, pMediaNo);
+  }
+
+  pBuffer->numero[s] = pMediaNo;
+
+  return s;
+}
+
+// Comptabilise la table et le contenu actuel du buffer (+/-) ------------------
+static void CompteContenu
+  (const sBufferMedia* pBuffer, //: Buffer dont le contenu est compté
+   int                 pSigne)  //: 1 = allocation, -1 = libération
+{
+  MEMOIRE (pBuffer->memoire, MEM_SLOTS, pSigne,
+           pSigne * (int64_t)TailleTable (pBuffer->masque + 1))
+
+  int64_t _cross = pSigne * (int64_t)pBuffer->crossCount;
+
+  MEMOIRE (pBuffer->memoire, MEM_CROSS,
+           _cross, _cross * (int64_t)sizeof (sCrossFec))
+
+  signed no = FindPresentSlot (pBuffer, 0, false);
+
+  for (; no != -1; no = FindPresentSlot (pBuffer, no + 1, false))
+  {
+    MEMOIRE (pBuffer->memoire, MEM_MEDIA,
+             pSigne, pSigne * BLOC (pBuffer->payloadSize[no]))
+  }
 }
 
 // Fonctions publiques =========================================================
 
-// Créé un buffer média                                                     ----
+// Créé un buffer média dont la fenêtre couvre pPaquets paquets (L×D, 0 si  ----
+// encore inconnu), les tableaux de slots sont alloués d'un bloc            ----
 // Remarque : ne pas oublier de faire le ménage avec sBufferMedia_Release ! ----
 //> Nouveau buffer média
-sBufferMedia sBufferMedia_New()
+sBufferMedia sBufferMedia_New
+  (unsigned pPaquets) //: Nombre de paquets média à couvrir (voir Dimensionne)
 {
   sBufferMedia _buffer;
 
-  _buffer.rbtree  = sRbTree_New (ReleasePaquetMediaFunc, PrintPaquetMediaFunc);
-  _buffer.reading = 0;
-  _buffer.arrival = 0;
-  _buffer.readingNx = MEDIA_NX_NULL;
-  _buffer.arrivalNx = MEDIA_NX_NULL;
+  _buffer.count          = 0;
+  _buffer.overCount      = 0;
+  _buffer.crossCount     = 0;
+  _buffer.readingNx      = MEDIA_NX_NULL;
+  _buffer.arrivalNx      = MEDIA_NX_NULL;
+  _buffer.foreachNx      = MEDIA_NX_NULL;
+  _buffer.foreachReverse = false;
+  _buffer.memoire        = 0;
+  _buffer.present        = 0;
+  _buffer.masque         = 0;
+
+  bool    ok = AlloueTable (&_buffer, Fenetre (pPaquets));
+  ASSERTc (ok, _buffer, cExAllocateMemory)
 
   return _buffer;
 }
@@ -68,7 +263,23 @@ void sBufferMedia_Release
 {
   ASSERTpc (pBuffer,, cExNullPtr)
 
-  sRbTree_Release (&pBuffer->rbtree);
+  signed no = FindPresentSlot (pBuffer, 0, false);
+
+  for (; no != -1; no = FindPresentSlot (pBuffer, no + 1, false))
+  {
+    MEMOIRE (pBuffer->memoire, MEM_MEDIA, -1, -BLOC (pBuffer->payloadSize[no]))
+    sPaquetMedia_Release (pBuffer->slot[no].block);
+  }
+
+  MEMOIRE (pBuffer->memoire, MEM_CROSS, -(int64_t)pBuffer->crossCount,
+           -(int64_t)(pBuffer->crossCount * sizeof (sCrossFec)))
+  MEMOIRE (pBuffer->memoire, MEM_SLOTS, -1,
+           -(int64_t)TailleTable (pBuffer->masque + 1))
+
+  AlignedFree (pBuffer->present);
+
+  pBuffer->present = 0;
+  pBuffer->count   = 0;
 }
 
 // Affiche le contenu d'un buffer média ----------------------------------------
@@ -78,44 +289,236 @@ void sBufferMedia_Print
 {
   ASSERTpc (pBuffer,, cExNullPtr)
 
-  sRbTree_Print (&pBuffer->rbtree, 2, pBuffers);
+  PRINT1 ("count=%u ", pBuffer->count)
+
+  if (pBuffers)
+  {
+    signed no = FindPresentSlot (pBuffer, 0, false);
+
+    for (; no != -1; no = FindPresentSlot (pBuffer, no + 1, false))
+    {
+      PRINT1 ("\n  ")
+      sPaquetMedia_Print (pBuffer->slot[no].block);
+    }
+  }
+
+  PRINT1 ("\n")
+}
+
+// Attache une comptabilité mémoire au buffer (table et contenu actuel  --------
+// y sont comptés, puis chaque ajout ou suppression). Avec pMemoire = 0 --------
+// le buffer est détaché, son contenu est décompté de l'ancienne        --------
+// Remarque : la comptabilité doit survivre au buffer (sBufferMedia_Release) ---
+void sBufferMedia_Comptabilise
+  (sBufferMedia* pBuffer,  //: Buffer à comptabiliser
+   sMemoire*     pMemoire) //: Comptabilité à mettre à jour (0 = détacher)
+{
+  ASSERTpc (pBuffer,, cExNullPtr)
+
+  if (pBuffer->memoire) CompteContenu (pBuffer, -1);
+
+  pBuffer->memoire = pMemoire;
+
+  if (pBuffer->memoire) CompteContenu (pBuffer, 1);
+}
+
+// Agrandit si nécessaire la fenêtre pour couvrir deux matrices de pPaquets ----
+// paquets média (L×D) : celle en réception et la précédente, encore en     ----
+// lecture ou en récupération. La fenêtre ne rétrécit jamais                ----
+//> Status de l'opération / la fenêtre couvre-t-elle pPaquets paquets ?
+bool sBufferMedia_Dimensionne
+  (sBufferMedia* pBuffer,  //: Buffer à dimensionner
+   unsigned      pPaquets) //: Nombre de paquets média à couvrir (L×D)
+{
+  ASSERTpc (pBuffer, false, cExNullPtr)
+
+  unsigned _slots = Fenetre (pPaquets);
+
+  return _slots <= pBuffer->masque + 1 || Agrandit (pBuffer, _slots);
 }
 
 // Est "l'équivalent" de media_receive de VLC : ajoute le paquet média au    ---
-// buffer, celui-ci étant trié par ordre de médiaNo.                         ---
+// buffer, dans le slot indexé par son médiaNo (médiaNo & masque).           ---
 // Remarque: Le buffer s'approprie le paquet média, cela veut dire que c'est ---
 // le buffer média qui s'occupera de libérer la mémoire prise par le paquet! ---
 //> Status de l'opération / ajout réussi ?
 bool sBufferMedia_AddByReference
   (sBufferMedia* pBuffer, //: Buffer à modifier
    sPaquetMedia* pMedia,  //: Paquet à ajouter
-   bool pOver) //: Faut-il écraser un noeud qui porterait déjà key=médiaNo ?
+   bool pOver) //: Faut-il écraser un paquet qui porterait déjà ce médiaNo ?
 {
   ASSERTpc (pBuffer, false, cExNullPtr)
   ASSERTpc (pMedia,  false, cExNullPtr)
 
-  // Ajoute key=méedia.médiaNo; value=média dans l'arbre rouge-noire
-  pBuffer->arrival = sRbTree_AddByReference
-                      (&pBuffer->rbtree, pMedia->mediaNo, pMedia, pOver);
-  IFNOT (pBuffer->arrival, false) // Ajout raté ?
+  sMediaNo no = pMedia->mediaNo;
+  signed   s  = Reserve (pBuffer, no);
+  ASSERTc (s != -1, false, cExAllocateMemory)
+
+  if (pBuffer->present[SLOT_MOT (s)] & SLOT_BIT (s))
+  {
+    IFNOT (pOver, false) // Doublon refusé ?
+
+    pBuffer->overCount++;
+    MEMOIRE (pBuffer->memoire, MEM_MEDIA, -1, -BLOC (pBuffer->payloadSize[s]))
+    sPaquetMedia_Release (pBuffer->slot[s].block);
+  }
+  else
+  {
+    pBuffer->present[SLOT_MOT (s)] |= SLOT_BIT (s);
+    pBuffer->count++;
+  }
 
-  pBuffer->arrivalNx = sMediaNo_to_sMediaNx (pMedia->mediaNo);
+  MEMOIRE (pBuffer->memoire, MEM_MEDIA, 1, BLOC (pMedia->payloadSize))
+
+  pBuffer->timeStamp  [s] = pMedia->timeStamp;
+  pBuffer->payloadSize[s] = pMedia->payloadSize;
+  pBuffer->payloadType[s] = pMedia->payloadType;
+  pBuffer->slot       [s].block = pMedia;
+
+  pBuffer->arrivalNx = sMediaNo_to_sMediaNx (no);
 
   return true;
 }
 
 // Retourne un pointeur vers le paquet média portant un certain médiaNo --------
-//> Pointeur sur le paquet média lié à key=pMediaNo ou 0 si aucun de trouvé
+//> Pointeur sur le paquet média lié à pMediaNo ou 0 si aucun de trouvé
 sPaquetMedia* sBufferMedia_Find
   (const sBufferMedia* pBuffer,  //: Buffer à traiter
          sMediaNo      pMediaNo) //: Paramètre de recherche
 {
   ASSERTpc (pBuffer, 0, cExNullPtr)
 
-  return sRbTree_Lookup (&pBuffer->rbtree, pMediaNo);
+  return sBufferMedia_IsPresent (pBuffer, pMediaNo) ?
+           pBuffer->slot[MEDIA_SLOT (pBuffer, pMediaNo)].block : 0;
+}
+
+// Indique si le paquet média portant un certain médiaNo est présent -----------
+// (ne touche que le bitmap de présence, pas le paquet lui-même)     -----------
+//> Le paquet média lié à pMediaNo est-il dans le buffer ?
+bool sBufferMedia_IsPresent
+  (const sBufferMedia* pBuffer,  //: Buffer à traiter
+         sMediaNo      pMediaNo) //: Paramètre de recherche
+{
+  ASSERTpc (pBuffer, false, cExNullPtr)
+
+  unsigned s = MEDIA_SLOT (pBuffer, pMediaNo);
+
+  return (pBuffer->present[SLOT_MOT (s)] & SLOT_BIT (s)) &&
+         pBuffer->numero[s] == pMediaNo;
+}
+
+// Signale un paquet média manquant (attendu par du FEC) : crée son cross ------
+// Remarque : peut agrandir la fenêtre, les cross déjà retournés sont alors ----
+// déplacés (ne pas conserver leurs pointeurs, voir FindCross)              ----
+//> Pointeur sur le nouveau cross (dans le slot du médiaNo) ou 0 si existant
+sCrossFec* sBufferMedia_AddCross
+  (sBufferMedia* pBuffer,  //: Buffer à modifier
+   sMediaNo      pMediaNo) //: MédiaNo du paquet manquant
+{
+  ASSERTpc (pBuffer, 0, cExNullPtr)
+
+  signed   s = Reserve (pBuffer, pMediaNo);
+  ASSERTc (s != -1, 0, cExAllocateMemory)
+
+  IFNOT (!(pBuffer->lost[SLOT_MOT (s)] & SLOT_BIT (s)), 0)
+
+  pBuffer->lost[SLOT_MOT (s)] |= SLOT_BIT (s);
+  pBuffer->crossCount++;
+
+  MEMOIRE (pBuffer->memoire, MEM_CROSS, 1, sizeof (sCrossFec))
+
+  pBuffer->slot[s].cross = sCrossFec_New();
+
+  return &pBuffer->slot[s].cross;
 }
 
-// Initalise la boucle foreach like sur le buffer média ------------------------
+// Retrouve le cross lié au médiaNo donné en paramètre -------------------------
+//> Pointeur sur le cross lié au médiaNo ou 0 si inexistant
+sCrossFec* sBufferMedia_FindCross
+  (sBufferMedia* pBuffer,  //: Buffer à traiter
+   sMediaNo      pMediaNo) //: Paramètre de recherche
+{
+  ASSERTpc (pBuffer, 0, cExNullPtr)
+
+  unsigned s = MEDIA_SLOT (pBuffer, pMediaNo);
+
+  return pBuffer->lost[SLOT_MOT (s)] & SLOT_BIT (s) &&
+         pBuffer->numero[s] == pMediaNo ? &pBuffer->slot[s].cross : 0;
+}
+
+// Supprime le cross lié au médiaNo donné en paramètre -------------------------
+//> Status de l'opération / suppression réussie ?
+bool sBufferMedia_DeleteCross
+  (sBufferMedia* pBuffer,  //: Buffer à modifier
+   sMediaNo      pMediaNo) //: MédiaNo du cross à supprimer
+{
+  ASSERTpc (pBuffer, false, cExNullPtr)
+  IFNOT    (sBufferMedia_FindCross (pBuffer, pMediaNo), false)
+
+  unsigned s = MEDIA_SLOT (pBuffer, pMediaNo);
+
+  pBuffer->lost[SLOT_MOT (s)] &= ~SLOT_BIT (s);
+  pBuffer->crossCount--;
+
+  MEMOIRE (pBuffer->memoire, MEM_CROSS, -1, -(int64_t)sizeof (sCrossFec))
+
+  return true;
+}
+
+// Affiche les cross (paquets manquants attendus) du buffer --------------------
+void sBufferMedia_PrintCross
+  (const sBufferMedia* pBuffer,  //: Buffer à afficher
+         bool          pBuffers) //: Faut-il afficher le contenu des buffers ?
+{
+  ASSERTpc (pBuffer,, cExNullPtr)
+
+  PRINT1 ("count=%u ", pBuffer->crossCount)
+
+  if (pBuffers && pBuffer->crossCount > 0)
+  {
+    unsigned no;
+
+    for (no = 0; no <= pBuffer->masque; no++)
+    {
+      if (!(pBuffer->lost[SLOT_MOT (no)] & SLOT_BIT (no))) continue;
+
+      PRINT1 ("\n  %u ", pBuffer->numero[no])
+      sCrossFec_Print (&pBuffer->slot[no].cross);
+    }
+  }
+
+  PRINT1 ("\n")
+}
+
+// Réserve le slot d'un médiaNo manquant pour y lier les waits d'un décodeur ---
+// spécialisé. Peut agrandir la fenêtre (voir sBufferMedia_AddCross)         ---
+//> Pointeur sur les liens [COL/ROW] du médiaNo ou 0 si problème
+uint16_t* sBufferMedia_AddLien
+  (sBufferMedia* pBuffer,  //: Buffer à modifier
+   sMediaNo      pMediaNo) //: MédiaNo du paquet manquant
+{
+  ASSERTpc (pBuffer, 0, cExNullPtr)
+
+  signed   s = Reserve (pBuffer, pMediaNo);
+  ASSERTc (s != -1, 0, cExAllocateMemory)
+
+  return pBuffer->lien[s];
+}
+
+// Retrouve les liens [COL/ROW] d'un médiaNo (remis à 0 pour libérer le slot) --
+//> Pointeur sur les liens du médiaNo ou 0 si son slot est à un autre médiaNo
+uint16_t* sBufferMedia_FindLien
+  (sBufferMedia* pBuffer,  //: Buffer à traiter
+   sMediaNo      pMediaNo) //: Paramètre de recherche
+{
+  ASSERTpc (pBuffer, 0, cExNullPtr)
+
+  unsigned s = MEDIA_SLOT (pBuffer, pMediaNo);
+
+  return pBuffer->numero[s] == pMediaNo ? pBuffer->lien[s] : 0;
+}
+
+// Initalise la boucle foreach like sur le buffer média (ordre des slots) ------
 //> Status de l'opération / Est-ce que ForeachData est (un paquet) valide ?
 bool sBufferMedia_InitForeach
   (sBufferMedia* pBuffer,  //: Buffer à traiter
@@ -123,7 +526,14 @@ bool sBufferMedia_InitForeach
 {
   ASSERTpc (pBuffer, false, cExNullPtr)
 
-  return sRbTree_InitForeach (&pBuffer->rbtree, pReverse);
+  signed no = FindPresentSlot (pBuffer, pReverse ? pBuffer->masque : 0,
+                               pReverse);
+
+  pBuffer->foreachReverse = pReverse;
+  pBuffer->foreachNx      = no != -1 ? sMediaNo_to_sMediaNx (no) :
+                                       MEDIA_NX_NULL;
+
+  return !pBuffer->foreachNx.null;
 }
 
 // Continue la boucle foreach like sur le buffer média -------------------------
@@ -132,8 +542,15 @@ bool sBufferMedia_NextForeach
   (sBufferMedia* pBuffer) //: Buffer à traiter
 {
   ASSERTpc (pBuffer, false, cExNullPtr)
+  IFNOT    (!pBuffer->foreachNx.null, false) // Boucle terminée ?
+
+  signed no = pBuffer->foreachReverse ?
+    FindPresentSlot (pBuffer, (signed)pBuffer->foreachNx.v - 1, true) :
+    FindPresentSlot (pBuffer, (signed)pBuffer->foreachNx.v + 1, false);
 
-  return sRbTree_NextForeach (&pBuffer->rbtree);
+  pBuffer->foreachNx = no != -1 ? sMediaNo_to_sMediaNx (no) : MEDIA_NX_NULL;
+
+  return !pBuffer->foreachNx.null;
 }
 
 // Retourne le médiaNo du paquet média (pointé) par la boucle foreach ----------
@@ -143,7 +560,8 @@ sMediaNo sBufferMedia_ForeachKey
 {
   ASSERTpc (pBuffer, 0, cExNullPtr)
 
-  return sRbTree_ForeachKey (&pBuffer->rbtree);
+  return pBuffer->foreachNx.null ? 0 :
+                                   pBuffer->numero[pBuffer->foreachNx.v];
 }
 
 // Retourne un pointeur sur le paquet média (pointé) par la boucle foreach -----
@@ -153,7 +571,8 @@ sPaquetMedia* sBufferMedia_ForeachValue
 {
   ASSERTpc (pBuffer, 0, cExNullPtr)
 
-  return sRbTree_ForeachValue (&pBuffer->rbtree);
+  return pBuffer->foreachNx.null ? 0 :
+                                   pBuffer->slot[pBuffer->foreachNx.v].block;
 }
 
 // Calcule si un médiaNo se situe entre les limites d'arrivalNx & readingNx ----
@@ -195,50 +614,52 @@ bool sBufferMedia_ReadMedia
 {
   ASSERTpc (pBuffer, false, cExNullPtr)
 
-  // Initialise la position de lecture si nécessaire
-  if (pBuffer->reading == 0)
+  // Initialise le médiaNo de lecture si nécessaire : plus petit médiaNo
+  // présent, comparé modulo 2^16 (la fenêtre est plus courte que 2^15)
+  if (pBuffer->readingNx.null)
   {
-    pBuffer->reading = sRbTree_First (&pBuffer->rbtree);
-  }
+    signed   s = FindPresentSlot (pBuffer, 0, false);
+    ASSERTc (s != -1, false, cExLectureNxValue)
 
-  ASSERTc (pBuffer->reading, false, cExRbTreeFirst)
+    sMediaNo _first = pBuffer->numero[s];
 
-  // Initialise le médiaNo de lecture si nécessaire
-  if (pBuffer->readingNx.null)
-  {
-    sPaquetMedia* _media = pBuffer->reading->value;
-    ASSERTc      (_media, false, cExRbTreeValue)
+    for (; s != -1; s = FindPresentSlot (pBuffer, s + 1, false))
+    {
+      if ((int16_t)(pBuffer->numero[s] - _first) < 0)
+      {
+        _first = pBuffer->numero[s];
+      }
+    }
 
-    pBuffer->readingNx = sMediaNo_to_sMediaNx (_media->mediaNo);
+    pBuffer->readingNx = sMediaNo_to_sMediaNx (_first);
   }
 
-  ASSERTc (!pBuffer->readingNx.null, false, cExLectureNxValue)
+  // Point sur le médiaNo suivant (pour la lecture)
+  sMediaNo no = pBuffer->readingNx.v;
 
-  // Point sur l'élément suivant (pour la lecture)
-  sRbNode* _oldNd = pBuffer->reading;
-  sMediaNx _oldNx = pBuffer->readingNx;
+  *pReadedNo = no;
 
-  *pReadedNo = _oldNx.v;
+  pBuffer->readingNx = sMediaNo_to_sMediaNx (no + 1);
 
-  pBuffer->reading   = sRbNode_Next         (pBuffer->reading);
-  pBuffer->readingNx = sMediaNo_to_sMediaNx (pBuffer->readingNx.v + 1);
+  // Le paquet devrait être présent !
+  IFNOT (sBufferMedia_IsPresent (pBuffer, no), false) // Paquet manquant ?
 
-  // Recherche le noeud qui devrait être présent !
-  bool   _trouve = sRbTree_Lookup (&pBuffer->rbtree, _oldNx.v) != 0;
-  IFNOT (_trouve, false) // Noeud introuvable ?
-
-  // L'élément est présent !
+  unsigned s = MEDIA_SLOT (pBuffer, no);
 
   // Enregistre le payload du paquet média dans un fichier si demandé
   if (pDestFile != 0)
   {
-    bool ok = sPaquetMedia_ToFile (sRbNode_GetValue (_oldNd), pDestFile, false);
-    ASSERT (ok, false, cExMediaToFile, _oldNx.v)
+    bool ok = sPaquetMedia_ToFile (pBuffer->slot[s].block, pDestFile, false);
+    ASSERT (ok, false, cExMediaToFile, no)
   }
 
-  // Supprime l'élément du buffer
-  bool    ok = sRbTree_Delete (&pBuffer->rbtree, _oldNx.v);
-  ASSERT (ok, false, cExMediaDelete, _oldNx.v)
+  // Supprime le paquet du buffer
+  MEMOIRE (pBuffer->memoire, MEM_MEDIA, -1, -BLOC (pBuffer->payloadSize[s]))
+  sPaquetMedia_Release (pBuffer->slot[s].block);
+
+  pBuffer->present[SLOT_MOT (s)] &= ~SLOT_BIT (s);
+  pBuffer->slot   [s].block = 0;
+  pBuffer->count--;
 
   return true;
 }
@@ -30,31 +30,85 @@
 
 // Types de données ============================================================
 
-// Structure stockant les paquets média dans un arbre rouge-noire. Le buffer ---
-// média de VLC est une liste chaînée, ce qui n'est pas optimal lors de      ---
-// nombreuses manipulations du buffer. Une ancienne version avec liste       ---
-// doublement chaînée est disponible au cas où (version précédente).         ---
+// Fenêtre de slots (puissance de 2) : slot d'un médiaNo = médiaNo & masque ----
+#define MEDIA_SLOTS     (UINT16_MAX+1) //. Fenêtre maximale (espace 16 bits)
+#define MEDIA_SLOTS_MIN 64             //. Fenêtre minimale (un mot du bitmap)
+
+// Slot d'un paquet média présent (accès direct aux tableaux parallèles) -------
+#define MEDIA_SLOT(buffer, no) ((no) & (buffer)->masque)
+
+// Liens [COL/ROW] d'un médiaNo manquant vers les waits des décodeurs ----------
+// spécialisés (index+1 du wait, 0 = aucun), déplacés avec le slot   -----------
+typedef uint16_t sMediaLien[2];
+
+// Slot de la table : ce qui concerne un médiaNo, qu'il soit présent ou perdu --
+// (paquet média présent, ou cross vers les FEC colonne/ligne l'attendant)   ---
 typedef struct
 {
-  sRbTree rbtree; //. Key = paquetMedia.mediaNo, Value = paquetMedia
-
-  sRbNode* reading; //. Position de la lecture   (dernier lu)
-  sRbNode* arrival; //. Position de la réception (dernier réceptionné)
+  sPaquetMedia* block; //. Paquet média (entête+payload) ou 0 si absent
+  sCrossFec     cross; //. FEC colonne et ligne liés au paquet (si perdu)
+}
+  sMediaSlot;
+
+STATIC_ASSERT (sizeof (sMediaSlot) == sizeof (void*) + sizeof (sCrossFec),
+               sMediaSlot)
+
+// Structure stockant les paquets média par slot (slot = médiaNo & masque) -----
+// Le buffer média de VLC est une liste chaînée, ce qui n'est pas optimal    ---
+// lors de nombreuses manipulations du buffer. Les méta-données utiles aux   ---
+// boucles de l'algorithme sont rangées dans des tableaux parallèles         ---
+// (denses), les blocs (entête+payload) ne sont accédés que pour le xor.     ---
+// La table de slots unifie paquet média et cross (ex bufferFec.cross) : un  ---
+// paquet perdu, retrouvé ou récupéré ne touche qu'une entrée de la table.   ---
+// La fenêtre est dimensionnée d'après L×D (voir Dimensionne) et doublée si  ---
+// un médiaNo tombe sur un slot encore occupé par un autre médiaNo.          ---
+typedef struct
+{
+  uint64_t*   present;     //. [slot/64] Bitmap de présence des paquets
+  uint64_t*   lost;        //. [slot/64] Bitmap des cross existants
+  sMediaSlot* slot;        //. [slot] Paquet média et cross
+  uint32_t*   timeStamp;   //. [slot] TimeStamp lié au flux
+  uint32_t*   payloadSize; //. [slot] Taille du payload
+  sMediaLien* lien;        //. [slot] Liens des décodeurs spécialisés
+  sMediaNo*   numero;      //. [slot] MédiaNo occupant le slot
+  uint8_t*    payloadType; //. [slot] Type de payload
+  unsigned    masque;      //. Nombre de slots - 1 (fenêtre en puissance de 2)
+
+  unsigned count;      //. Nombre de paquets média présents
+  unsigned overCount;  //. Nombre d'overwrite(s) de paquets média
+  unsigned crossCount; //. Nombre de cross (paquets manquants attendus)
 
   sMediaNx readingNx; //. Position de la lecture   (dernier médiaNo lu)
   sMediaNx arrivalNx; //. Position de la réception (dernier médiaNo réceptionné)
+
+  sMediaNx foreachNx;      //. Slot en cours du foreach (pas un médiaNo)
+  bool     foreachReverse; //. Foreach parcouru à l'envers ?
+
+  sMemoire* memoire; //. Comptabilité mémoire (0 = aucune, voir Comptabilise)
 }
   sBufferMedia;
 
 // Déclaration des fonctions ===================================================
 
-sBufferMedia  sBufferMedia_New     ();
+sBufferMedia  sBufferMedia_New     (unsigned pPaquets);
 void          sBufferMedia_Release (      sBufferMedia*);
 void          sBufferMedia_Print   (const sBufferMedia*, bool pBuffers);
 
+void sBufferMedia_Comptabilise (sBufferMedia*, sMemoire*);
+bool sBufferMedia_Dimensionne  (sBufferMedia*, unsigned pPaquets);
+
 bool sBufferMedia_AddByReference (sBufferMedia*, sPaquetMedia*, bool pOver);
 
-sPaquetMedia* sBufferMedia_Find (const sBufferMedia*, sMediaNo);
+sPaquetMedia* sBufferMedia_Find      (const sBufferMedia*, sMediaNo);
+bool          sBufferMedia_IsPresent (const sBufferMedia*, sMediaNo);
+
+sCrossFec* sBufferMedia_AddCross    (      sBufferMedia*, sMediaNo);
+sCrossFec* sBufferMedia_FindCross   (      sBufferMedia*, sMediaNo);
+bool       sBufferMedia_DeleteCross (      sBufferMedia*, sMediaNo);
+void       sBufferMedia_PrintCross  (const sBufferMedia*, bool pBuffers);
+
+uint16_t* sBufferMedia_AddLien  (sBufferMedia*, sMediaNo);
+uint16_t* sBufferMedia_FindLien (sBufferMedia*, sMediaNo);
 
 bool          sBufferMedia_InitForeach  (      sBufferMedia*, bool pReverse);
 bool          sBufferMedia_NextForeach  (      sBufferMedia*);
@@ -29,30 +29,62 @@
 
 // Constantes privées ==========================================================
 
-const sCrossFec INIT_CROSS_FEC= //. Valeur par défaut d'un cross (à FEC_NX_NULL)
-  {{0, true}, {0, true}};
+const sCrossFec INIT_CROSS_FEC= //. Valeur par défaut d'un cross (aucun lien)
+  {{0, 0}, {0, 0}};
 
 // Fonctions publiques =========================================================
 
-// Création d'un nouveau cross                                           -------
-// Remarque : ne pas oublier de faire le ménage avec sCrossFec_Release ! -------
-//> Pointeur sur le nouveau cross ou 0 si problème
-sCrossFec* sCrossFec_New()
+// Création d'un nouveau cross (stocké par valeur dans le slot du médiaNo) -----
+//> Nouveau cross (aucun wait lié)
+sCrossFec sCrossFec_New()
 {
-  sCrossFec* _cross = malloc (sizeof (sCrossFec));
-  IFNOT     (_cross, 0) // Allocation ratée ?
+  return INIT_CROSS_FEC;
+}
+
+// Indique si le cross ne lie plus aucun paquet de FEC -------------------------
+//> Est-ce que les liens colonne et ligne sont tous deux vides ?
+bool sCrossFec_IsNull
+  (const sCrossFec* pCross) //: Cross à tester
+{
+  ASSERTpc (pCross, true, cExNullPtr)
 
-  *_cross = INIT_CROSS_FEC; // Initialise le contenu du cross
+  return pCross->wait[COL] == 0 && pCross->wait[ROW] == 0;
+}
+
+// Lie le cross au wait (dans la direction du wait) ----------------------------
+void sCrossFec_Link
+  (sCrossFec* pCross, //: Cross à modifier
+   sWaitFec * pWait)  //: Wait ayant remarqué la perte du paquet média
+{
+  ASSERTpc (pCross,, cExNullPtr)
+  ASSERTpc (pWait,,  cExNullPtr)
 
-  return _cross;
+  pCross->wait      [pWait->D] = pWait;
+  pCross->generation[pWait->D] = pWait->generation;
 }
 
-// Libère la mémoire allouée par un cross --------------------------------------
-void sCrossFec_Release
-  (sCrossFec* pCross) //: Cross à vider
+// Retire le lien du cross vers le wait d'une direction ------------------------
+void sCrossFec_Unlink
+  (sCrossFec* pCross, //: Cross à modifier
+   eFecD      pD)     //: Direction du lien à retirer (COL ou ROW)
 {
   ASSERTpc (pCross,, cExNullPtr)
-  free     (pCross);
+
+  pCross->wait[pD] = 0;
+}
+
+// Suit le lien du cross vers le wait d'une direction (sans recherche) ---------
+//> Pointeur sur le wait lié ou 0 si aucun (ou si le wait a été recyclé)
+sWaitFec* sCrossFec_GetWait
+  (const sCrossFec* pCross, //: Cross à traiter
+         eFecD      pD)     //: Direction du lien à suivre (COL ou ROW)
+{
+  ASSERTpc (pCross, 0, cExNullPtr)
+
+  sWaitFec* _wait = pCross->wait[pD];
+  IFNOT    (_wait, 0) // Aucun lien ?
+
+  return _wait->generation == pCross->generation[pD] ? _wait : 0;
 }
 
 // Affiche le contenu d'un cross -----------------------------------------------
@@ -61,8 +93,13 @@ void sCrossFec_Print
 {
   ASSERTpc (pCross,, cExNullPtr)
 
+  const sWaitFec* _col = sCrossFec_GetWait (pCross, COL);
+  const sWaitFec* _row = sCrossFec_GetWait (pCross, ROW);
+
   PRINT1 ("cross {")
-  PRINT1 ("colNx=") sFecNx_Print (pCross->colNx);
-  PRINT1 ("rowNx=") sFecNx_Print (pCross->rowNx);
+  PRINT1 ("colNx=") sFecNx_Print (_col ? sFecNo_to_sFecNx (_col->fecNo) :
+                                          FEC_NX_NULL);
+  PRINT1 ("rowNx=") sFecNx_Print (_row ? sFecNo_to_sFecNx (_row->fecNo) :
+                                          FEC_NX_NULL);
   PRINT1 ("} ")
 }
@@ -30,17 +30,28 @@
 
 // Types de données ============================================================
 
-// Structure liant médiaNo et les paquets de FEC colonne + ligne liés ----------
+struct sWaitFec;
+
+// Structure liant médiaNo et les waits (FEC) colonne + ligne liés. Chaque  ----
+// lien est un pointeur direct accompagné de la génération du wait lors de  ----
+// la liaison : un wait recyclé entre-temps n'est donc jamais suivi à tort. ----
 typedef struct
 {
-  sFecNx colNx; //. fecNo du paquet de FEC colonne "lié" au médiaNo spécifique
-  sFecNx rowNx; //. fecNo du paquet de FEC ligne   "lié" au médiaNo spécifique
+  struct sWaitFec* wait[2];       //. [COL/ROW] Wait "lié" au médiaNo (0=aucun)
+  uint32_t         generation[2]; //. [COL/ROW] Génération du wait lors du lien
 }
   sCrossFec;
 
+STATIC_ASSERT (sizeof (sCrossFec) == 2 * sizeof (void*) + 8, sCrossFec)
+
 // Déclaration des Fonctions ===================================================
 
-sCrossFec* sCrossFec_New     ();
-void       sCrossFec_Release (      sCrossFec*);
-void       sCrossFec_Print   (const sCrossFec*);
+sCrossFec sCrossFec_New    ();
+bool      sCrossFec_IsNull (const sCrossFec*);
+void      sCrossFec_Print  (const sCrossFec*);
+
+void             sCrossFec_Link    (      sCrossFec*, struct sWaitFec*);
+void             sCrossFec_Unlink  (      sCrossFec*, eFecD);
+struct sWaitFec* sCrossFec_GetWait (const sCrossFec*, eFecD);
+
 #endif
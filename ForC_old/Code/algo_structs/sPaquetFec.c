@@ -30,7 +30,7 @@
 // Constantes privées ==========================================================
 
 const sPaquetFec INIT_PAQUET_FEC = //. Valeur par défaut d'un paquet de FEC (0)
-  {0, {0,0}, {0,0,0}, {0}, {0,0,0,0,0,0,0}, 0};
+  {0, {0,0}, {0,0,0}, {0}, {0,0,0,0,0,0,0}};
 
 const char*  cBegFecString = "THIS_IS_A_FEC_PK"; //. Entête parsing -> fichier
 const size_t cBegFecLength = 16;    //. Longueur de l'entête parsing
@@ -38,8 +38,7 @@ static char  cBegFecBuffer  [16+1]; //. Buffer lecture de l'entête parsing
 
 // Fonctions publiques =========================================================
 
-// Copie un paquet de FEC sans oublier de dupliquer (memcpy) le contenu   ------
-// pointé par resXor !                                                    ------
+// Copie un paquet de FEC (entête et resXor d'un seul bloc)               ------
 // Remarque : ne pas oublier de faire le ménage avec sPaquetFec_Release ! ------
 //> Pointeur sur le nouveau paquet de FEC ou 0 si problème
 sPaquetFec* sPaquetFec_Copy
@@ -47,20 +46,14 @@ sPaquetFec* sPaquetFec_Copy
 {
   ASSERTpc (pFec, 0, cExNullPtr)
 
-  sPaquetFec* _fec = malloc (sizeof (sPaquetFec));
-  IFNOT      (_fec, 0) // Allocation ratée ?
-
-  void*     ok = memcpy (_fec, pFec, sizeof (sPaquetFec));
-  IFNOT_OP (ok, free (_fec), 0) // Copie ratée ?
+  size_t _size = sizeof (sPaquetFec) + pFec->DWORD0.Length_recovery;
 
-  if (pFec->resXor == 0) return _fec;
-
-  _fec->resXor = malloc (pFec->DWORD0.Length_recovery);
-  IFNOT_OP (_fec->resXor, free (_fec), 0) // Allocation ratée
+  sPaquetFec* _fec = AlignedMalloc (_size);
+  IFNOT      (_fec, 0) // Allocation ratée ?
 
   // TODO Attention : trop grande confiance en le resXor donné en paramètre
-  ok = memcpy (_fec->resXor, pFec->resXor, pFec->DWORD0.Length_recovery);
-  IFNOT_OP (ok, sPaquetFec_Release (_fec), 0) // Copie ratée ?
+  void*     ok = memcpy (_fec, pFec, _size);
+  IFNOT_OP (ok, AlignedFree (_fec), 0) // Copie ratée ?
 
   return _fec;
 }
@@ -87,7 +80,7 @@ sPaquetFec* sPaquetFec_Forge
 
   pSNBase &= FEC_SNBASE_MASK;
 
-  sPaquetFec* _fec = malloc (sizeof (sPaquetFec));
+  sPaquetFec* _fec = AlignedMalloc (sizeof (sPaquetFec) + pLength_recovery);
   IFNOT      (_fec, 0) // Allocation ratée ?
 
   #ifdef OPTION_OVERWRITE_FEC_NO
@@ -110,13 +103,9 @@ sPaquetFec* sPaquetFec_Forge
   _fec->DWORD3.type            = XOR;
   _fec->DWORD3.D               = pD;
   _fec->DWORD3.X               = FEC_X_0;
-  _fec->resXor                 = 0;
 
   if (pLength_recovery == 0) return _fec;
 
-  _fec->resXor = malloc (pLength_recovery);
-  IFNOT_OP (_fec->resXor, free (_fec), 0) // Allocation ratée ?
-
   if (pResXor == 0)
   {
     memset (_fec->resXor, 0, pLength_recovery);
@@ -137,11 +126,7 @@ void sPaquetFec_Release
 {
   ASSERTpc (pFec,, cExNullPtr)
 
-  if (pFec->resXor)
-  {
-    free (pFec->resXor);
-  }
-  free (pFec);
+  AlignedFree (pFec);
 }
 
 // Affiche le contenu d'un paquet de FEC ---------------------------------------
@@ -150,7 +135,7 @@ void sPaquetFec_Print
 {
   ASSERTpc (pFec,, cExNullPtr)
 
-  PRINT1 ("{fecNo=%u, snb=%lu, off=%u, na=%u, d=%s} ",
+  PRINT1 ("{fecNo=%u, snb=%u, off=%u, na=%u, d=%s} ",
           pFec->fecNo,
           (uint32_t)pFec->DWORD0.SNBase_low_bits +
           (uint32_t)pFec->DWORD3.SNBase_ext_bits*256*256,
@@ -183,9 +168,11 @@ bool sPaquetFec_ToFile
 
 // Récupère le contenu d'un paquet de FEC depuis un fichier. Celui-ci doit -----
 // avoir été enregistré avec l'entête+parsing !                            -----
+// Si pPayload=false resXor est sauté (paquet sans payload, dry run)       -----
 //> Pointeur sur le paquet de FEC récupéré ou 0 si problème
 sPaquetFec* sPaquetFec_FromFile
-  (FILE* pFile) //: Fichier source
+  (FILE* pFile,    //: Fichier source
+   bool  pPayload) //: Faut-il lire resXor (sinon Length_recovery=0) ?
 {
   ASSERTpc (pFile, 0, cExNullPtr)
 
@@ -201,19 +188,28 @@ sPaquetFec* sPaquetFec_FromFile
   ok = strcmp (cBegFecBuffer, cBegFecString) == 0;
   IFNOT_OP (ok, fsetpos (pFile, &pos), 0) // Comparaison réussie ?
 
-  sPaquetFec* _fec = malloc (sizeof (sPaquetFec));
-  IFNOT_OP   (_fec, fsetpos (pFile, &pos), 0) // Allocation ratée ?
+  sPaquetFec _header;
 
-  ok = fread (_fec, 1, sizeof (sPaquetFec), pFile) == sizeof (sPaquetFec);
-  IFNOT_OP (ok, fsetpos (pFile, &pos); free (_fec), 0) // Lecture ratée ?
+  ok = fread (&_header, 1, sizeof (sPaquetFec), pFile) == sizeof (sPaquetFec);
+  IFNOT_OP (ok, fsetpos (pFile, &pos), 0) // Lecture ratée ?
+
+  if (!pPayload && _header.DWORD0.Length_recovery > 0)
+  {
+    ok = fseek (pFile, _header.DWORD0.Length_recovery, SEEK_CUR) == 0;
+    IFNOT_OP (ok, fsetpos (pFile, &pos), 0) // Saut raté ?
 
-  _fec->resXor = 0;
+    _header.DWORD0.Length_recovery = 0;
+  }
+
+  // Entête et resXor sont alloués d'un bloc (resXor à la suite)
+  sPaquetFec* _fec =
+    AlignedMalloc (sizeof (sPaquetFec) + _header.DWORD0.Length_recovery);
+  IFNOT_OP (_fec, fsetpos (pFile, &pos), 0) // Allocation ratée ?
+
+  *_fec = _header;
 
   if (_fec->DWORD0.Length_recovery > 0)
   {
-    _fec->resXor = malloc (_fec->DWORD0.Length_recovery);
-    IFNOT_OP (_fec->resXor, fsetpos(pFile,&pos); free(_fec), 0) // Allocation ?
-
     ok = fread (_fec->resXor, 1, _fec->DWORD0.Length_recovery, pFile)
           == _fec->DWORD0.Length_recovery;
 
@@ -36,7 +36,8 @@ typedef enum { COL = 0, ROW = 1 } eFecD;
 // Type d'algorithme correcteur d'erreur du paquet de FEC ----------------------
 typedef enum { XOR = 0, Hamming = 1, Reed_Solomon = 2 } eFecType;
 
-// Structure représentant un paquet de FEC -------------------------------------
+// Structure représentant un paquet de FEC. Le payload (resXor) suit   ---------
+// directement l'entête dans une seule allocation alignée (CACHE_LINE) ---------
 typedef struct
 {
   // TODO enlever fecNo du header FEC car fecNo = numéro de séquence RTP du
@@ -72,10 +73,17 @@ typedef struct
                   uint32_t D               : 1;
                   uint32_t X               : 1;  } DWORD3;
 
-  uint8_t* resXor; //. Résultat de l'op. de xor entre paquets média protégés
+  uint8_t resXor[]; //. Résultat de l'op. de xor entre paquets média protégés
 }
   sPaquetFec;
 
+// Chaque DWORD de l'entête RFC 2733 fait bien 32 bits (bitfields uint32_t)
+STATIC_ASSERT (sizeof (struct DWORD0) == 4, DWORD0)
+STATIC_ASSERT (sizeof (struct DWORD1) == 4, DWORD1)
+STATIC_ASSERT (sizeof (struct DWORD2) == 4, DWORD2)
+STATIC_ASSERT (sizeof (struct DWORD3) == 4, DWORD3)
+STATIC_ASSERT (sizeof (sPaquetFec)    == 4 + 4 * 4, sPaquetFec)
+
 // Déclaration des Constantes ==================================================
 
 #define FEC_SNBASE_MASK 0x00FFFFFF
@@ -101,5 +109,5 @@ void sPaquetFec_Release (      sPaquetFec*);
 void sPaquetFec_Print   (const sPaquetFec*);
 
 bool        sPaquetFec_ToFile   (const sPaquetFec*, FILE*);
-sPaquetFec* sPaquetFec_FromFile (FILE*);
+sPaquetFec* sPaquetFec_FromFile (FILE*, bool pPayload);
 #endif
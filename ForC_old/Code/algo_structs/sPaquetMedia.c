@@ -35,7 +35,7 @@ static char  cBegMediaBuffer  [16+1]; //. Buffer lecture de l'entête parsing
 
 // Fonctions publiques =========================================================
 
-// Copie un paquet média                                                    ----                                                  ------
+// Copie un paquet média (entête et payload d'un seul bloc)                 ----
 // Remarque : ne pas oublier de faire le ménage avec sPaquetMedia_Release ! ----
 //> Pointeur sur le nouveau paquet média ou 0 si problème
 sPaquetMedia* sPaquetMedia_Copy
@@ -43,22 +43,32 @@ sPaquetMedia* sPaquetMedia_Copy
 {
   ASSERTpc (pMedia, 0, cExNullPtr)
 
-  sPaquetMedia* _media = malloc (sizeof (sPaquetMedia));
+  size_t _size = sizeof (sPaquetMedia) + pMedia->payloadSize;
+
+  sPaquetMedia* _media = AlignedMalloc (_size);
   IFNOT        (_media, 0) // Allocation ratée ?
 
-  void*     ok = memcpy (_media, pMedia, sizeof (sPaquetMedia));
-  IFNOT_OP (ok, free (_media), 0) // Copie ratée ?
+  // TODO Attention : trop grande confiance en le payload donné en paramètre
+  void*     ok = memcpy (_media, pMedia, _size);
+  IFNOT_OP (ok, AlignedFree (_media), 0) // Copie ratée ?
 
-  if (pMedia->payload == 0) return _media;
+  _media->refCount = 1; // La copie est indépendante de l'original
 
-  _media->payload = malloc (pMedia->payloadSize);
-  IFNOT_OP (_media->payload, free (_media), 0) // Allocation ratée ?
+  return _media;
+}
 
-  // TODO Attention : trop grande confiance en le payload donné en paramètre
-  ok = memcpy (_media->payload, pMedia->payload, pMedia->payloadSize);
-  IFNOT_OP (ok, sPaquetMedia_Release (_media), 0) // Copie ratée ?
+// Partage un paquet média sans le copier (ajoute une référence sur le bloc) ---
+// Remarque : chaque partage doit être suivi d'un sPaquetMedia_Release !     ---
+//> Pointeur sur le même paquet média ou 0 si problème
+sPaquetMedia* sPaquetMedia_Share
+  (sPaquetMedia* pMedia) //: Paquet à partager
+{
+  ASSERTpc (pMedia,                0, cExNullPtr)
+  ASSERTpc (pMedia->refCount > 0, 0, cExNullPtr)
 
-  return _media;
+  pMedia->refCount++;
+
+  return pMedia;
 }
 
 // Forge un nouveau paquet média                                            ----
@@ -69,35 +79,42 @@ sPaquetMedia* sPaquetMedia_Forge
    uint32_t       pTimeStamp,   //: TimeStamp lié au flux
    uint8_t        pPayloadType, //: Type de payload
    size_t         pPayloadSize, //: Longueur du payload
-   const uint8_t* pPayload)     //: Contenu à copier dans payload
+   const uint8_t* pPayload)     //: Contenu à copier dans payload (0 = zéros)
 {
-  sPaquetMedia* _media = malloc (sizeof (sPaquetMedia));
+  sPaquetMedia* _media = AlignedMalloc (sizeof (sPaquetMedia) + pPayloadSize);
   IFNOT        (_media, 0) // Allocation ratée ?
 
   _media->mediaNo     = pMediaNo;
   _media->timeStamp   = pTimeStamp;
   _media->payloadType = pPayloadType;
   _media->payloadSize = pPayloadSize;
+  _media->refCount    = 1;
 
   if (pPayloadSize == 0) return _media;
 
-  _media->payload = malloc (pPayloadSize);
-  IFNOT_OP (_media->payload, free (_media), 0) // Allocation ratée ?
-
-  void*     ok = memcpy (_media->payload, pPayload, pPayloadSize);
-  IFNOT_OP (ok, sPaquetMedia_Release (_media), 0) // Copie ratée ?
+  if (pPayload == 0)
+  {
+    memset (_media->payload, 0, pPayloadSize);
+  }
+  else
+  {
+    void*     ok = memcpy (_media->payload, pPayload, pPayloadSize);
+    IFNOT_OP (ok, sPaquetMedia_Release (_media), 0) // Copie ratée ?
+  }
 
   return _media;
 }
 
-// Libère la mémoire allouée par un paquet média -------------------------------
+// Retire une référence sur un paquet média et libère la mémoire allouée -------
+// par celui-ci lorsque la dernière référence disparaît                  -------
 void sPaquetMedia_Release
   (sPaquetMedia* pMedia) //: Paquet à vider
 {
   ASSERTpc (pMedia,, cExNullPtr)
 
-  if (pMedia->payload) free (pMedia->payload);
-  free (pMedia);
+  if (--pMedia->refCount > 0) return; // Encore partagé ailleurs ?
+
+  AlignedFree (pMedia);
 }
 
 // Affiche le contenu d'un paquet média ----------------------------------------
@@ -143,9 +160,11 @@ bool sPaquetMedia_ToFile
 
 // Récupère le contenu d'un paquet média depuis un fichier. Celui-ci doit ------
 // avoir été enregistré avec l'entête+parsing (pHeader=true) !            ------
+// Si pPayload=false le payload est sauté (paquet sans payload, dry run)  ------
 //> Pointeur sur le paquet média récupéré ou 0 si problème
 sPaquetMedia* sPaquetMedia_FromFile
-  (FILE* pFile) //: Fichier source
+  (FILE* pFile,    //: Fichier source
+   bool  pPayload) //: Faut-il lire le payload (sinon payloadSize=0) ?
 {
   ASSERTpc (pFile, 0, cExNullPtr)
 
@@ -163,19 +182,30 @@ sPaquetMedia* sPaquetMedia_FromFile
   ok = strcmp (cBegMediaBuffer, cBegMediaString) == 0;
   IFNOT_OP (ok, fsetpos (pFile, &pos), 0) // Comparaison réussie ?
 
-  sPaquetMedia* _media = malloc (sizeof (sPaquetMedia));
-  IFNOT_OP     (_media, fsetpos (pFile, &pos), 0) // Allocation ratée ?
+  sPaquetMedia _header;
+
+  ok = fread (&_header, 1, sizeof (sPaquetMedia), pFile) ==
+        sizeof (sPaquetMedia);
+  IFNOT_OP (ok, fsetpos (pFile, &pos), 0) // Lecture ratée ?
+
+  if (!pPayload && _header.payloadSize > 0)
+  {
+    ok = fseek (pFile, _header.payloadSize, SEEK_CUR) == 0;
+    IFNOT_OP (ok, fsetpos (pFile, &pos), 0) // Saut raté ?
 
-  ok = fread (_media, 1, sizeof (sPaquetMedia), pFile) == sizeof (sPaquetMedia);
-  IFNOT_OP (ok, fsetpos (pFile, &pos); free (_media), 0) // Lecture ratée ?
+    _header.payloadSize = 0;
+  }
 
-  _media->payload = 0;
+  // Entête et payload sont alloués d'un bloc (payload à la suite)
+  sPaquetMedia* _media =
+    AlignedMalloc (sizeof (sPaquetMedia) + _header.payloadSize);
+  IFNOT_OP (_media, fsetpos (pFile, &pos), 0) // Allocation ratée ?
+
+  *_media = _header;
+  _media->refCount = 1; // Valeur enregistrée sans signification ici
 
   if (_media->payloadSize > 0)
   {
-    _media->payload = malloc (_media->payloadSize);
-    IFNOT_OP (_media->payload, fsetpos(pFile,&pos); free(_media), 0) // Alloc ?
-
     ok = fread (_media->payload, 1, _media->payloadSize, pFile) ==
           _media->payloadSize;
     IFNOT_OP (ok, fsetpos(pFile,&pos); sPaquetMedia_Release(_media), 0) // Lec ?
@@ -32,20 +32,29 @@
 
 // Types de données ============================================================
 
-// Structure représentant un paquet média (simplifié) --------------------------
+// Structure représentant un paquet média (simplifié). Le payload suit ---------
+// directement l'entête dans une seule allocation alignée (CACHE_LINE) ---------
+// Le bloc est partagé par compteur de références (sPaquetMedia_Share) et ------
+// ne doit donc plus être modifié une fois transmis à un tiers !          ------
 typedef struct
 {
-  sMediaNo mediaNo;     //. Numéro de séquence du paquet média
   uint32_t timeStamp;   //. TimeStamp lié au flux
+  uint32_t payloadSize; //. Taille du payload
+  uint32_t refCount;    //. Nombre de références sur le bloc (non atomique)
+  sMediaNo mediaNo;     //. Numéro de séquence du paquet média
   uint8_t  payloadType; //. Type de payload
-  unsigned payloadSize; //. Taille du payload
-  uint8_t* payload;     //. Payload (je dirais même playload :-p)
+  uint8_t  reserved;    //. Aligne payload sur 16 octets
+  uint8_t  payload[];   //. Payload (je dirais même playload :-p)
 }
   sPaquetMedia;
 
+STATIC_ASSERT (sizeof   (sPaquetMedia) == 16,                sPaquetMedia)
+STATIC_ASSERT (offsetof (sPaquetMedia, payload) == 16,       sPaquetMediaPld)
+
 // Déclaration des Fonctions ===================================================
 
 sPaquetMedia* sPaquetMedia_Copy  (const sPaquetMedia*);
+sPaquetMedia* sPaquetMedia_Share (      sPaquetMedia*);
 sPaquetMedia* sPaquetMedia_Forge (sMediaNo, uint32_t, uint8_t,
                                   size_t, const uint8_t*);
 
@@ -53,6 +62,6 @@ void sPaquetMedia_Release (      sPaquetMedia*);
 void sPaquetMedia_Print   (const sPaquetMedia*);
 
 bool          sPaquetMedia_ToFile   (const sPaquetMedia*, FILE*, bool pHeader);
-sPaquetMedia* sPaquetMedia_FromFile (FILE*);
+sPaquetMedia* sPaquetMedia_FromFile (FILE*, bool pPayload);
 
 #endif
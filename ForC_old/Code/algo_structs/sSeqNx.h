@@ -52,6 +52,9 @@ typedef struct
 }
   sFecNx;
 
+STATIC_ASSERT (sizeof (sMediaNx) == 4, sMediaNx)
+STATIC_ASSERT (sizeof (sFecNx)   == 4, sFecNx)
+
 // Déclaration des Constantes ==================================================
 
 extern const sMediaNx MEDIA_NX_NULL; //. médiaNx à NULL
@@ -33,10 +33,21 @@
 // Remarque : ne pas oublier de faire le ménage avec sWaitFec_Release ! --------
 //> Pointeur sur le nouveau wait ou 0 si problème
 sWaitFec* sWaitFec_New
-  (bool pInitParams) //: Faut-il initialiser les paramètres (à 0) ?
+  (uint16_t pLength_recovery, //: Longueur du payload (resXor) à réserver
+   bool     pInitParams)      //: Faut-il initialiser les paramètres (à 0) ?
 {
-  return pInitParams ? calloc (sizeof (sWaitFec), 1) :
-                       malloc (sizeof (sWaitFec));
+  size_t _size = sizeof (sWaitFec) + pLength_recovery;
+
+  sWaitFec* _wait = pInitParams ? AlignedCalloc (_size) :
+                                  AlignedMalloc (_size);
+  IFNOT    (_wait, 0) // Allocation ratée ?
+
+  _wait->Length_recovery = pLength_recovery;
+  _wait->capacity        = pLength_recovery;
+  _wait->generation      = 0;
+  _wait->next            = 0;
+
+  return _wait;
 }
 
 // Création d'un nouveau wait à partir d'un paquet de FEC               --------
@@ -47,32 +58,43 @@ sWaitFec* sWaitFec_Forge
 {
   ASSERTpc (pFec, 0, cExNullPtr)
 
-  sWaitFec* _wait = sWaitFec_New (false);
+  sWaitFec* _wait = sWaitFec_New (pFec->DWORD0.Length_recovery, false);
   IFNOT    (_wait, 0) // Allocation ratée ?
 
-  _wait->fecNo           = pFec->fecNo;
-  _wait->Length_recovery = pFec->DWORD0.Length_recovery;
-  _wait->PT_recovery     = pFec->DWORD1.PT_recovery;
-  _wait->TS_recovery     = pFec->DWORD2.TS_recovery;
-  _wait->SNBase          = pFec->DWORD0.SNBase_low_bits/*+
-                           pFec->DWORD3.SNBase_ext_bits*256*256*/;
-  _wait->Offset          = pFec->DWORD3.Offset;
-  _wait->NA              = pFec->DWORD3.NA;
-  _wait->number          = 0;
-  _wait->missing         = sChampBits_New();
-  _wait->D               = pFec->DWORD3.D;
-  _wait->resXor          = pFec->resXor;
+  bool      ok = sWaitFec_Fill (_wait, pFec);
+  IFNOT_OP (ok, sWaitFec_Release (_wait), 0) // Copie ratée ?
 
-  if (_wait->resXor == 0) return _wait;
+  return _wait;
+}
 
-  _wait->resXor = malloc (_wait->Length_recovery);
-  IFNOT_OP (_wait->resXor, sWaitFec_Release (_wait), 0) // Allocation ratée ?
+// Remplit un wait (neuf ou recyclé) à partir d'un paquet de FEC ---------------
+//> Status de l'opération / remplissage réussi ?
+bool sWaitFec_Fill
+  (      sWaitFec  * pWait, //: Wait à remplir (capacité suffisante)
+   const sPaquetFec* pFec)  //: Le paquet d'où prendre les paramètres
+{
+  ASSERTpc (pWait, false, cExNullPtr)
+  ASSERTpc (pFec,  false, cExNullPtr)
+  IFNOT    (pWait->capacity >= pFec->DWORD0.Length_recovery, false)
+
+  pWait->fecNo           = pFec->fecNo;
+  pWait->Length_recovery = pFec->DWORD0.Length_recovery;
+  pWait->PT_recovery     = pFec->DWORD1.PT_recovery;
+  pWait->TS_recovery     = pFec->DWORD2.TS_recovery;
+  pWait->SNBase          = pFec->DWORD0.SNBase_low_bits/*+
+                           pFec->DWORD3.SNBase_ext_bits*256*256*/;
+  pWait->Offset          = pFec->DWORD3.Offset;
+  pWait->NA              = pFec->DWORD3.NA;
+  pWait->number          = 0;
+  pWait->missing         = sChampBits_New();
+  pWait->D               = pFec->DWORD3.D;
+
+  if (pWait->Length_recovery == 0) return true;
 
   // Attention : trop grande confiance en le p...Fec.resXor donné en paramètre
-  void*     ok = memcpy (_wait->resXor, pFec->resXor, _wait->Length_recovery);
-  IFNOT_OP (ok, sWaitFec_Release (_wait), 0) // Copie ratée ?
+  void* ok = memcpy (pWait->resXor, pFec->resXor, pWait->Length_recovery);
 
-  return _wait;
+  return ok != 0;
 }
 
 // Libère la mémoire allouée par un wait ---------------------------------------
@@ -81,12 +103,7 @@ void sWaitFec_Release
 {
   ASSERTpc (pWait,, cExNullPtr)
 
-  if (pWait->resXor)
-  {
-    free (pWait->resXor);
-  }
-
-  free (pWait);
+  AlignedFree (pWait);
 }
 
 // Affiche le contenu d'un wait ------------------------------------------------
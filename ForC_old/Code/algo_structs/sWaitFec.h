@@ -30,27 +30,39 @@
 
 // Types de données ============================================================
 
-// Structure stockant un paquet de FEC en attente d'être utilisé ---------------
-typedef struct
+// Structure stockant un paquet de FEC en attente d'être utilisé. Le    --------
+// payload (resXor) suit directement l'entête dans une seule allocation --------
+// Les champs lus à chaque paquet média sont en tête, triés par taille  --------
+// décroissante (pas de padding), l'entête tient dans une CACHE_LINE    --------
+typedef struct sWaitFec
 {
-  sFecNo     fecNo;           //. FecNo du paquet de FEC
-  uint16_t   Length_recovery; //. Longueur du payload (pResXor)
-  uint8_t    PT_recovery;     //. Permet de récupérer PloadType des paq. média
-  uint32_t   TS_recovery;     //. Permet de récupérer TimeStamp des paq. média
+  sChampBits missing; //. Chaque bit = flag (perdu/non) d'un paquet média
+  sFecNo     fecNo;   //. FecNo du paquet de FEC
   sMediaNo   SNBase;  //. MédiaNo du 1er paquet média protégé
-  sMediaNo   Offset;  //. MédiaNo médias protégés = SNBase + j*Offset
-  sMediaNo   NA;      //. J est entre [0 ; NA[
+  uint8_t    Offset;  //. MédiaNo médias protégés = SNBase + j*Offset
+  uint8_t    NA;      //. J est entre [0 ; NA[
   uint8_t    number;  //. Nombre de paquet média manquants
-  sChampBits missing; //. Chaque bit = flag (perdu/non) d'un paquet média
-  eFecD      D;       //. Direction : colonne ou ligne (col,row)
-  uint8_t*   resXor;  //. Résultat de l'op. xor entre paquets média protégés
+  uint8_t    D;       //. Direction : colonne ou ligne (eFecD : col,row)
+
+  uint32_t   TS_recovery;     //. Permet de récupérer TimeStamp des paq. média
+  uint32_t   generation;      //. Incrémenté à chaque recyclage (liens cross)
+  uint16_t   Length_recovery; //. Longueur du payload (pResXor)
+  uint16_t   capacity;        //. Longueur allouée pour le payload (pResXor)
+  uint8_t    PT_recovery;     //. Permet de récupérer PloadType des paq. média
+
+  struct sWaitFec* next; //. Suivant dans la liste des waits recyclés
+
+  uint8_t    resXor[]; //. Résultat de l'op. xor entre paquets média protégés
 }
   sWaitFec;
 
+STATIC_ASSERT (sizeof (sWaitFec) <= CACHE_LINE, sWaitFec)
+
 // Déclaration des Fonctions ===================================================
 
-sWaitFec* sWaitFec_New     (bool pInitParams);
+sWaitFec* sWaitFec_New     (uint16_t pLength_recovery, bool pInitParams);
 sWaitFec* sWaitFec_Forge   (const sPaquetFec*);
+bool      sWaitFec_Fill    (      sWaitFec*, const sPaquetFec*);
 void      sWaitFec_Release (      sWaitFec*);
 void      sWaitFec_Print   (const sWaitFec*);
 
@@ -49,7 +49,7 @@ sBruteSmpte sBruteSmpte_New
 {
   sBruteSmpte _brute;
 
-  _brute.media = sBufferMedia_New();
+  _brute.media = sBufferMedia_New (0);
   _brute.fec   = sLinkedList_New (ReleasePaquetFunc, PrintPaquetFunc);
   _brute.overwriteMedia       = pOverwriteMedia;
   _brute.recovered            = 0;
@@ -59,9 +59,12 @@ sBruteSmpte sBruteSmpte_New
   _brute.nbLePaMedia          = 0;
   _brute.nbApFec              = 0;
   _brute.maxF                 = 0;
-  _brute.chronoTotal          = 0;
-  _brute.chronoMedia          = 0;
-  _brute.chronoFec            = 0;
+
+#ifdef OPTION_CHRONO_IS_NULL
+  _brute.chrono = 0;
+#else
+  _brute.chrono = sChrono_New();
+#endif
 
   return _brute;
 }
@@ -74,6 +77,9 @@ void sBruteSmpte_Release
 
   sBufferMedia_Release (&pBrute->media);
   sLinkedList_Release  (&pBrute->fec);
+
+  if (pBrute->chrono) sChrono_Release (pBrute->chrono);
+  pBrute->chrono = 0;
 }
 
 // Affiche le contenu d'un Brute SMPTE -----------------------------------------
@@ -89,23 +95,20 @@ void sBruteSmpte_Print
   PRINT1 (cMsgPrintBruteFec)
   sLinkedList_Print (&pBrute->fec, pBuffers);
 
-  clock_t ct = pBrute->chronoTotal / TICKS_TO_MS;
-  clock_t cm = pBrute->chronoMedia / TICKS_TO_MS;
-  clock_t cf = pBrute->chronoFec   / TICKS_TO_MS;
-
   PRINT1 (cMsgPrintBrute,
           pBrute->overwriteMedia ? cMsgOverwriteMediaYes : cMsgOverwriteMediaNo,
-          pBrute->media.rbtree.overCount,
+          pBrute->media.overCount,
           pBrute->recovered,
           pBrute->unrecoveredOnReading,
           pBrute->media.readingNx.v,
           pBrute->media.arrivalNx.v,
-          ct, cm, cf,
           pBrute->nbArPaMedia,
           pBrute->nbArPaFec,
           pBrute->nbLePaMedia,
           pBrute->nbApFec,
           pBrute->maxF)
+
+  if (pBrute->chrono) sChrono_Print (pBrute->chrono);
 }
 /*******************************************************************************
 *                    GÈRE L'ARRIVÉE DE PAQUETS (MEDIA ou FEC)                  *
@@ -121,17 +124,15 @@ void sBruteSmpte_ArriveePaquetMedia
 
   PRINT2 ("Brute ArriveePaquetMedia mediaNo=%u\n", pMedia->mediaNo)
 
-  clock_t add = 0;
-  clock_t now = clock();
+  uint64_t _debut = CHRONO_DEBUT (pBrute->chrono);
 
   bool ok = sBufferMedia_AddByReference
               (&pBrute->media, pMedia, pBrute->overwriteMedia);
   ASSERT (ok,, cExMediaAdd, pMedia->mediaNo)
 
-  add = clock() - now;
+  CHRONO_FIN (pBrute->chrono, PHASE_MEDIA, _debut)
+
   pBrute->nbArPaMedia++;
-  pBrute->chronoTotal += add;
-  pBrute->chronoMedia += add;
 }
 
 // Gère l'arrivée d'un paquet de FEC -------------------------------------------
@@ -146,8 +147,7 @@ void sBruteSmpte_ArriveePaquetFec
   DETAILS2 (sPaquetFec_Print (pFec);)
   PRINT2   ("\n")
 
-  clock_t add = 0;
-  clock_t now = clock();
+  uint64_t _debut = CHRONO_DEBUT (pBrute->chrono);
 
   sLinkedList_AppendByReference (&pBrute->fec, pFec);
 
@@ -156,10 +156,9 @@ void sBruteSmpte_ArriveePaquetFec
      pBrute->maxF = pBrute->fec.count;
   }
 
-  add = clock() - now;
+  CHRONO_FIN (pBrute->chrono, PHASE_SCAN, _debut)
+
   pBrute->nbArPaFec++;
-  pBrute->chronoTotal += add;
-  pBrute->chronoFec   += add;
 }
 
 // Imite la lecture du buffer média et en profite pour nettoyer les buffers ----
@@ -172,19 +171,16 @@ bool sBruteSmpte_LecturePaquetMedia
   ASSERTpc (pBrute, false, cExNullPtr)
 
   // Le buffer média n'a pas dépassé la capacité demandée
-  if (pBrute->media.rbtree.count <= pBufferSize) return false;
+  if (pBrute->media.count <= pBufferSize) return false;
 
-  clock_t add = 0;
-  clock_t now = clock();
+  uint64_t _debut = CHRONO_DEBUT (pBrute->chrono);
 
   sMediaNo _readedNo;
 
   bool ok = sBufferMedia_ReadMedia (&pBrute->media, pDestFile, &_readedNo);
 
-  add = clock() - now;
-  pBrute->chronoTotal += add;
-  pBrute->chronoMedia += add;
-  now = clock();
+  CHRONO_FIN (pBrute->chrono, PHASE_LECTURE, _debut)
+  _debut = CHRONO_DEBUT (pBrute->chrono);
 
   PRINT2 ("Brute LecturePaquetMedia %u\n", _readedNo)
 
@@ -224,11 +220,10 @@ bool sBruteSmpte_LecturePaquetMedia
     }
   }
 
-  add = clock() - now;
+  CHRONO_FIN (pBrute->chrono, PHASE_NETTOYAGE, _debut)
+
   pBrute->nbLePaMedia++;
   if (!ok) pBrute->unrecoveredOnReading++;
-  pBrute->chronoTotal += add;
-  pBrute->chronoFec   += add;
 
   return true;
 }
@@ -243,8 +238,7 @@ void sBruteSmpte_AppliqueFec
 {
   ASSERTpc (pBrute,, cExNullPtr)
 
-  clock_t add = 0;
-  clock_t now = clock();
+  uint64_t _debut = CHRONO_DEBUT (pBrute->chrono);
 
   unsigned no;
 
@@ -274,7 +268,7 @@ void sBruteSmpte_AppliqueFec
       // Paquet média protégés : médiaNo = SNBase + j*offset, avec j entre [0;NA[
       for (; _mediaNo != _mediaMax; _mediaNo += _Offset)
       {
-        if (sBufferMedia_Find (&pBrute->media, _mediaNo) != NULL)
+        if (sBufferMedia_IsPresent (&pBrute->media, _mediaNo))
         {
           PRINT2 (cMsgBruteApFecPresent, _mediaNo)
         }
@@ -296,6 +290,9 @@ void sBruteSmpte_AppliqueFec
       // Récupération possible
       else if (_nbMiss == 1)
       {
+        CHRONO_FIN (pBrute->chrono, PHASE_SCAN, _debut)
+        _debut = CHRONO_DEBUT (pBrute->chrono);
+
         PRINT2 (cMsgBruteApFecRecover, _mediaLast)
 
         // Etapes de la récupération (2 étapes) :
@@ -318,15 +315,19 @@ void sBruteSmpte_AppliqueFec
         {
           if (_mediaNo == _mediaLast) continue;
 
-          sPaquetMedia* _ami = sBufferMedia_Find (&pBrute->media, _mediaNo);
+          // Méta-données lues dans les slots, seul le payload touche au bloc
+          unsigned _slot = MEDIA_SLOT (&pBrute->media, _mediaNo);
+
+          _recup->timeStamp   ^= pBrute->media.timeStamp  [_slot];
+          _recup->payloadType ^= pBrute->media.payloadType[_slot];
 
-          _recup->timeStamp   ^= _ami->timeStamp;
-          _recup->payloadType ^= _ami->payloadType;
+          const uint8_t* _ami = pBrute->media.slot[_slot].block->payload;
 
-          unsigned _size = MIN (_recup->payloadSize, _ami->payloadSize);
+          unsigned _size =
+            MIN (_recup->payloadSize, pBrute->media.payloadSize[_slot]);
           for (no = 0; no < _size; no++)
           {
-            _recup->payload[no] ^= _ami->payload[no];
+            _recup->payload[no] ^= _ami[no];
           }
         }
 
@@ -338,12 +339,14 @@ void sBruteSmpte_AppliqueFec
         // Recommence le scan du début ( ça c de la force brute ! )
         sLinkedList_DeleteOnForeach (&pBrute->fec);
         sLinkedList_InitForeach     (&pBrute->fec, false);
+
+        CHRONO_FIN (pBrute->chrono, PHASE_RECUP, _debut)
+        _debut = CHRONO_DEBUT (pBrute->chrono);
       }
     }
   }
 
-  add = clock() - now;
+  CHRONO_FIN (pBrute->chrono, PHASE_SCAN, _debut)
+
   pBrute->nbApFec++;
-  pBrute->chronoTotal += add;
-  pBrute->chronoFec   += add;
 }
@@ -48,9 +48,7 @@ typedef struct
 
   unsigned maxF; //. Nombre max d'éléments stockés dans FEC
 
-  clock_t chronoTotal; //. Temps d'exécution total en TICKS
-  clock_t chronoMedia; //. Temps d'exécution total pour média en TICKS
-  clock_t chronoFec;   //. Temps d'exécution total pour FEC   en TICKS
+  sChrono* chrono; //. Durées des phases (0 = non chronométré)
 }
   sBruteSmpte;
 
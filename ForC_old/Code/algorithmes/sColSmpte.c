@@ -0,0 +1,364 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Dedicated 1D (column-only) decoder
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+#define MIN(a,b) (a <= b ? a : b)
+
+// Constantes privées ==========================================================
+
+#define COL_WAITS 2048 //. Nombre de slots de colonne (paquets de FEC attendant)
+
+// Fonctions privées ===========================================================
+
+// Rend un slot de colonne (et le paquet de FEC conservé) ----------------------
+static void sColSmpte_LibereWait
+  (sColSmpte* pCol,    //: Décodeur à mettre à jour
+   unsigned   pWaitNo) //: Index du slot à libérer
+{
+  sPaquetFec_Release (pCol->wait[pWaitNo].fec);
+
+  pCol->wait[pWaitNo].fec = 0;
+  pCol->libre[pCol->nbLibres++] = pWaitNo;
+  pCol->nbWaits--;
+}
+
+// Supprime un slot de colonne et les liens des paquets média manquants --------
+static void sColSmpte_DeleteLienAndWait
+  (sColSmpte* pCol,    //: Décodeur à mettre à jour
+   unsigned   pWaitNo) //: Index du slot à supprimer
+{
+  sColWait* _wait = &pCol->wait[pWaitNo];
+
+  uint32_t _missing = _wait->missing;
+
+  while (_missing)
+  {
+    sMediaNo _mediaNo =
+      _wait->SNBase + __builtin_ctz (_missing) * _wait->Offset;
+
+    uint16_t* _lien = sBufferMedia_FindLien (&pCol->media, _mediaNo);
+
+    if (_lien) _lien[COL] = 0;
+
+    _missing &= _missing - 1;
+  }
+
+  sColSmpte_LibereWait (pCol, pWaitNo);
+}
+
+// Récupère le seul paquet média manquant d'une colonne, puis libère cette -----
+// dernière. Le paquet récupéré n'est attendu par aucun autre paquet de    -----
+// FEC (1D) : pas de cascade possible                                      -----
+static void sColSmpte_Recupere
+  (sColSmpte* pCol,    //: Décodeur à mettre à jour
+   unsigned   pWaitNo) //: Index du slot n'attendant plus qu'un paquet média
+{
+  sColWait*   _wait = &pCol->wait[pWaitNo];
+  sPaquetFec* _fec  = _wait->fec;
+
+  ASSERTc (_wait->number == 1,, cExAlgorithmCaller)
+
+  sMediaNo _recupNo = _wait->SNBase +
+    __builtin_ctz (_wait->missing) * _wait->Offset;
+
+  // > payloadRecup = paquetFec.resXor
+
+  sPaquetMedia* _recup = sPaquetMedia_Forge
+      (_recupNo, _fec->DWORD2.TS_recovery,     _fec->DWORD1.PT_recovery,
+                 _fec->DWORD0.Length_recovery, _fec->resXor);
+  ASSERTc (_recup,, cExMediaForge)
+
+  // > payloadRecup ^= (tous les autres paquets média de la colonne)
+
+  unsigned j, no;
+
+  for (j = 0; j < _wait->NA; j++)
+  {
+    sMediaNo _mediaNo = _wait->SNBase + j * _wait->Offset;
+
+    if (_mediaNo == _recupNo) continue;
+
+    unsigned _slot = MEDIA_SLOT (&pCol->media, _mediaNo);
+
+    _recup->timeStamp   ^= pCol->media.timeStamp  [_slot];
+    _recup->payloadType ^= pCol->media.payloadType[_slot];
+
+    const uint8_t* _ami = pCol->media.slot[_slot].block->payload;
+
+    unsigned _size =
+      MIN (_recup->payloadSize, pCol->media.payloadSize[_slot]);
+    for (no = 0; no < _size; no++)
+    {
+      _recup->payload[no] ^= _ami[no];
+    }
+  }
+
+  bool ok = sBufferMedia_AddByReference
+              (&pCol->media, _recup, pCol->overwriteMedia);
+  ASSERT (ok,, cExMediaAdd, _recupNo)
+
+  pCol->recovered++;
+  pCol->nbRePaMedia++;
+
+  uint16_t* _lien = sBufferMedia_FindLien (&pCol->media, _recupNo);
+  if (_lien) _lien[COL] = 0;
+
+  sColSmpte_LibereWait (pCol, pWaitNo);
+}
+
+// Fonctions publiques =========================================================
+
+// Création d'un nouveau décodeur 1D, reprend le buffer média (par valeur) -----
+// Remarque : ne pas oublier de faire le ménage avec sColSmpte_Release !   -----
+//> Nouveau décodeur 1D
+sColSmpte sColSmpte_New
+  (sBufferMedia pMedia,          //: Buffer média (nouveau ou déjà alimenté)
+   bool         pOverwriteMedia) //: Ecrasage des doublons autorisé ?
+{
+  sColSmpte _col;
+
+  memset (&_col, 0, sizeof (sColSmpte));
+
+  _col.media          = pMedia;
+  _col.overwriteMedia = pOverwriteMedia;
+
+  size_t _sizeWait  = COL_WAITS * sizeof (sColWait);
+  size_t _sizeLibre = COL_WAITS * sizeof (uint16_t);
+
+  uint8_t* _slots = AlignedCalloc (_sizeWait + _sizeLibre);
+
+  _col.wait = (sColWait*)_slots;
+  ASSERTc (_slots, _col, cExAllocateMemory)
+
+  _col.libre = (uint16_t*) (_slots += _sizeWait);
+
+  // Pile des libres : le slot 0 est au sommet
+  for (_col.nbLibres = 0; _col.nbLibres < COL_WAITS; _col.nbLibres++)
+  {
+    _col.libre[_col.nbLibres] = COL_WAITS-1 - _col.nbLibres;
+  }
+
+  return _col;
+}
+
+// Libère la mémoire allouée par le décodeur 1D --------------------------------
+void sColSmpte_Release
+  (sColSmpte* pCol) //: Décodeur à vider
+{
+  ASSERTpc (pCol,, cExNullPtr)
+
+  unsigned no;
+
+  if (pCol->wait)
+  {
+    for (no = 0; no < COL_WAITS; no++)
+    {
+      if (pCol->wait[no].fec) sPaquetFec_Release (pCol->wait[no].fec);
+    }
+  }
+
+  sBufferMedia_Release (&pCol->media);
+  AlignedFree          (pCol->wait);
+
+  pCol->wait  = 0;
+  pCol->libre = 0;
+}
+
+// Affiche le contenu du décodeur 1D -------------------------------------------
+void sColSmpte_Print
+  (const sColSmpte* pCol,     //: Décodeur à afficher
+   bool             pBuffers) //: Faut-il afficher les détails (mémoire vars?)
+{
+  ASSERTpc (pCol,, cExNullPtr)
+
+  PRINT1 (cMsgPrintColMedia)
+  sBufferMedia_Print (&pCol->media, pBuffers);
+
+  PRINT1 (cMsgPrintCol,
+          pCol->overwriteMedia ? cMsgOverwriteMediaYes : cMsgOverwriteMediaNo,
+          pCol->media.overCount,
+          pCol->recovered,
+          pCol->unrecoveredOnReading,
+          pCol->rejected,
+          pCol->poolFull,
+          pCol->nbArPaMedia,
+          pCol->nbArPaFec,
+          pCol->nbLePaMedia,
+          pCol->nbPePaMedia,
+          pCol->nbRePaMedia,
+          pCol->maxW, COL_WAITS)
+}
+
+// Un paquet média vient d'arriver : s'il manquait à une colonne, celle-ci -----
+// n'en attend plus qu'un autre peut-être et le récupère immédiatement     -----
+void sColSmpte_ArriveePaquetMedia
+  (sColSmpte*    pCol,   //: Décodeur à mettre à jour
+   sPaquetMedia* pMedia) //: Paquet média arrivant (du réseau)
+{
+  ASSERTpc (pCol,,   cExNullPtr)
+  ASSERTpc (pMedia,, cExNullPtr)
+
+  sMediaNo _mediaNo = pMedia->mediaNo;
+
+  bool ok = sBufferMedia_AddByReference
+              (&pCol->media, pMedia, pCol->overwriteMedia);
+  ASSERT (ok,, cExMediaAdd, _mediaNo)
+
+  pCol->nbArPaMedia++;
+
+  uint16_t* _lien = sBufferMedia_FindLien (&pCol->media, _mediaNo);
+  if (!_lien || _lien[COL] == 0) return;
+
+  unsigned  _waitNo = _lien[COL] - 1;
+  sColWait* _wait   = &pCol->wait[_waitNo];
+  unsigned  j       = (sMediaNo)(_mediaNo - _wait->SNBase) / _wait->Offset;
+  uint32_t  _bit    = 1u << j;
+
+  ASSERTc (_wait->missing & _bit,, cExWaitSetManque)
+
+  _lien[COL] = 0;
+  pCol->nbRePaMedia++;
+
+  _wait->missing &= ~_bit;
+  _wait->number--;
+
+  if (_wait->number == 1) sColSmpte_Recupere (pCol, _waitNo);
+}
+
+// Un paquet de FEC colonne vient d'arriver (voir ArriveePaquetFec de     ------
+// sDavidSmpte pour les 3 cas). Les paquets de FEC ligne ou hors norme    ------
+// sont ignorés (comptés), de même que ceux protégeant plus de 32 paquets ------
+void sColSmpte_ArriveePaquetFec
+  (sColSmpte*  pCol, //: Décodeur à mettre à jour
+   sPaquetFec* pFec) //: Paquet de FEC arrivant (du réseau)
+{
+  ASSERTpc (pCol,, cExNullPtr)
+  ASSERTpc (pFec,, cExNullPtr)
+
+  pCol->nbArPaFec++;
+
+  bool ok = pFec->DWORD1.Mask   == FEC_MASK_0 &&
+            pFec->DWORD3.X      == FEC_X_0 &&
+            pFec->DWORD3.type   == XOR &&
+            pFec->DWORD3.index  == FEC_INDEX_XOR &&
+            pFec->DWORD3.D      == COL &&
+            pFec->DWORD3.Offset >  0 &&
+            pFec->DWORD3.NA     >  0 &&
+            pFec->DWORD3.NA     <= UINT32_BITS;
+
+  // La fenêtre du buffer média suit la matrice annoncée (L×D)
+  if (ok)
+  {
+    ok = sBufferMedia_Dimensionne
+           (&pCol->media, pFec->DWORD3.NA * pFec->DWORD3.Offset);
+    ASSERTc (ok,, cExAllocateMemory)
+  }
+
+  // Paquet de FEC non 1D ou plus de place : ignoré
+  if (!ok || pCol->nbLibres == 0)
+  {
+    if (ok) pCol->poolFull++;
+    else    pCol->rejected++;
+
+    sPaquetFec_Release (pFec);
+    return;
+  }
+
+  unsigned  _waitNo = pCol->libre[--pCol->nbLibres];
+  sColWait* _wait   = &pCol->wait[_waitNo];
+
+  pCol->nbWaits++;
+
+  _wait->fec     = pFec;
+  _wait->missing = 0;
+  _wait->number  = 0;
+  _wait->SNBase  = pFec->DWORD0.SNBase_low_bits;
+  _wait->Offset  = pFec->DWORD3.Offset;
+  _wait->NA      = pFec->DWORD3.NA;
+
+  unsigned j;
+
+  // Paquet média protégés : médiaNo = SNBase + j*offset, avec j entre [0;NA[
+  for (j = 0; j < _wait->NA; j++)
+  {
+    sMediaNo _mediaNo = _wait->SNBase + j * _wait->Offset;
+
+    if (sBufferMedia_IsPresent (&pCol->media, _mediaNo)) continue;
+
+    uint16_t* _lien = sBufferMedia_AddLien (&pCol->media, _mediaNo);
+    ASSERTc  (_lien && _lien[COL] == 0,, cExAlgorithmCaller)
+
+    _lien[COL] = _waitNo + 1;
+
+    _wait->missing |= 1u << j;
+    _wait->number++;
+
+    pCol->nbPePaMedia++;
+  }
+
+  // [1] Aucun paquet média manquant : paquet de FEC inutile à conserver
+
+  if (_wait->number == 0)
+  {
+    sColSmpte_LibereWait (pCol, _waitNo);
+    return;
+  }
+
+  if (pCol->nbWaits > pCol->maxW) pCol->maxW = pCol->nbWaits;
+
+  // [2] Qu'un seul paquet média manquant : récupération immédiate
+  // [3] Sinon la colonne attend l'arrivée des paquets média manquants
+
+  if (_wait->number == 1) sColSmpte_Recupere (pCol, _waitNo);
+}
+
+// Imite la lecture du buffer média et en profite pour nettoyer les slots ------
+//> Est-ce qu'une lecture a eu lieu ?
+bool sColSmpte_LecturePaquetMedia
+  (sColSmpte* pCol,        //: Décodeur à mettre à jour
+   sMediaNo   pBufferSize, //: Nombre de paquets média à garder dans le buffer
+   FILE*      pDestFile)   //: Pour enregistrer le payload média (0=pas enreg)
+{
+  ASSERTpc (pCol, false, cExNullPtr)
+
+  if (pCol->media.count <= pBufferSize) return false;
+
+  sMediaNo _readedNo;
+
+  bool ok = sBufferMedia_ReadMedia (&pCol->media, pDestFile, &_readedNo);
+
+  // Une colonne attendant un paquet média supprimé est devenue inutile
+  uint16_t* _lien = sBufferMedia_FindLien (&pCol->media, _readedNo);
+
+  if (_lien && _lien[COL]) sColSmpte_DeleteLienAndWait (pCol, _lien[COL]-1);
+
+  pCol->nbLePaMedia++;
+  if (!ok) pCol->unrecoveredOnReading++;
+
+  return true;
+}
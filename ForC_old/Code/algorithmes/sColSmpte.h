@@ -0,0 +1,87 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Dedicated 1D (column-only) decoder
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SCOLSMPTE__
+#define __SCOLSMPTE__
+
+// Types de données ============================================================
+
+// Un paquet de FEC colonne en attente (état d'une colonne de la matrice). -----
+// En 1D chaque paquet média n'est protégé que par une seule colonne : pas -----
+// de cross, pas de cascade, le paquet de FEC est conservé tel quel.       -----
+typedef struct
+{
+  sPaquetFec* fec;     //. Paquet de FEC conservé (resXor, 0 = slot libre)
+  uint32_t    missing; //. Bit j = paquet média SNBase + j*Offset manquant
+  sMediaNo    SNBase;  //. MédiaNo du 1er paquet média protégé
+  uint8_t     Offset;  //. MédiaNo médias protégés = SNBase + j*Offset (L)
+  uint8_t     NA;      //. J est entre [0 ; NA[ (D)
+  uint8_t     number;  //. Nombre de paquet média manquants
+}
+  sColWait;
+
+// Structure de l'algorithme SMPTE 2022-1 réduit aux matrices 1D (colonnes) ----
+// Un paquet média manquant est lié (lien COL de son slot du buffer média)  ----
+// à l'unique colonne l'attendant, il est récupéré dès qu'il manque seul.   ----
+typedef struct
+{
+  sBufferMedia media; //. Stockage des paquets de média
+
+  bool overwriteMedia; //. Ecrasage des doublons dans buffer média autorisé ?
+
+  unsigned recovered;            //. Nombre de paquets média récupérés
+  unsigned unrecoveredOnReading; //. Nb paq. média manquants lors de la lecture
+  unsigned rejected;             //. Nb paquets de FEC non 1D (ignorés)
+  unsigned poolFull;             //. Nb paquets de FEC ignorés (slots pleins)
+
+  unsigned nbArPaMedia; //. Nombre d'appels à ArriveePaquetMedia
+  unsigned nbArPaFec;   //. Nombre d'appels à ArriveePaquetFec
+  unsigned nbLePaMedia; //. Nombre d'appels à LecturePaquetMedia
+  unsigned nbPePaMedia; //. Nombre de paquets média signalés perdus
+  unsigned nbRePaMedia; //. Nombre de paquets média récupérés ou retrouvés
+
+  unsigned nbWaits; //. Nombre de slots de colonne utilisés
+  unsigned maxW;    //. Nombre max de slots de colonne utilisés
+
+  unsigned  nbLibres; //. Nombre de slots de colonne libres
+  uint16_t* libre;    //. [COL_WAITS] Pile des index de slots libres
+  sColWait* wait;     //. [COL_WAITS] Slots de colonne
+}
+  sColSmpte;
+
+// Déclaration des fonctions ===================================================
+
+sColSmpte sColSmpte_New (sBufferMedia, bool pOverwriteMedia);
+
+void sColSmpte_Release (      sColSmpte*);
+void sColSmpte_Print   (const sColSmpte*, bool pBuffers);
+
+void sColSmpte_ArriveePaquetMedia (sColSmpte*, sPaquetMedia*);
+void sColSmpte_ArriveePaquetFec   (sColSmpte*, sPaquetFec*);
+bool sColSmpte_LecturePaquetMedia (sColSmpte*, sMediaNo pBufferSize, FILE*);
+
+#endif
@@ -29,6 +29,31 @@
 
 #define MIN(a,b) (a <= b ? a : b)
 
+#define METRIQUES_PREFIXE "smpte2022_david_" /* Préfixe des noms exportés */
+
+// Constantes publiques ========================================================
+
+const sMetrique cDavidMetriques[DAVID_METRIQUES] =
+{
+  {"recovered_total",   "Media packets recovered by FEC",          false},
+  {"unrecovered_total", "Media packets missing when read out",     false},
+  {"media_total",       "Media packets received",                  false},
+  {"fec_total",         "FEC packets received",                    false},
+  {"read_total",        "Media packets read out of the buffer",    false},
+  {"lost_total",        "Media packets declared lost by FEC",      false},
+  {"recup_total",       "Recovery attempts (incl. cascades)",      false},
+  {"overwrite_total",   "Media packets overwritten (duplicates)",  false},
+  {"cross_max",         "High-water mark of cross entries",        true},
+  {"wait_max",          "High-water mark of wait entries",         true},
+  {"memory_bytes",      "Bytes allocated by the session",          true},
+  {"memory_max_bytes",  "High-water mark of allocated bytes",      true},
+  {"media_buffered",    "Media packets currently buffered",        true},
+  {"cross_current",     "Cross entries currently stored",          true},
+  {"wait_current",      "Wait entries currently stored",           true},
+  {"reading_media_no",  "Media number of the last read-out",       true},
+  {"arrival_media_no",  "Media number of the last arrival",        true}
+};
+
 // Déclaration de Fonctions privées ============================================
 
 sCrossFec* sDavidSmpte_PerduPaquetMedia (sDavidSmpte*, sMediaNo, sWaitFec*);
@@ -37,16 +62,22 @@ void sDavidSmpte_RecupPaquetMedia (sDavidSmpte*,sMediaNo,sCrossFec*,sWaitFec*);
 // Fonctions publiques =========================================================
 
 // Création d'un nouveau David SMPTE                                       -----
+// En dry run seule la comptabilité est faite (cross, waits, cascades) :   -----
+// les paquets de FEC perdent leur payload, les paquets média récupérés    -----
+// n'en ont pas (aucun xor), les statistiques restent identiques (hormis  -----
+// les chronos, non alloués)                                               -----
 // Remarque : ne pas oublier de faire le ménage avec sDavidSmpte_Release ! -----
 //> Nouveau David SMPTE
 sDavidSmpte sDavidSmpte_New
-  (bool pOverwriteMedia) //: Ecrasage des doublons dans buffer média autorisé ?
+  (bool pOverwriteMedia, //: Ecrasage des doublons dans buffer média autorisé ?
+   bool pDryRun)         //: Métadonnées seules (aucun payload) ?
 {
   sDavidSmpte _david;
 
-  _david.media                = sBufferMedia_New();
+  _david.media                = sBufferMedia_New (0);
   _david.fec                  = sBufferFec_New();
   _david.overwriteMedia       = pOverwriteMedia;
+  _david.dryRun               = pDryRun;
   _david.recovered            = 0;
   _david.unrecoveredOnReading = 0;
   _david.nbArPaMedia          = 0;
@@ -56,9 +87,21 @@ sDavidSmpte sDavidSmpte_New
   _david.nbRePaMedia          = 0;
   _david.maxC                 = 0;
   _david.maxW                 = 0;
-  _david.chronoTotal          = 0;
-  _david.chronoMedia          = 0;
-  _david.chronoFec            = 0;
+
+  // Comptabilité partagée par les deux buffers (pointeur : survit aux copies)
+  _david.memoire = sMemoire_New();
+
+  if (_david.memoire)
+  {
+    sBufferMedia_Comptabilise (&_david.media, _david.memoire);
+    sBufferFec_Comptabilise   (&_david.fec,   _david.memoire);
+  }
+
+#ifdef OPTION_CHRONO_IS_NULL
+  _david.chrono = 0;
+#else
+  _david.chrono = pDryRun ? 0 : sChrono_New();
+#endif
 
   return _david;
 }
@@ -71,6 +114,12 @@ void sDavidSmpte_Release
 
   sBufferMedia_Release (&pDavid->media);
   sBufferFec_Release   (&pDavid->fec);
+
+  if (pDavid->memoire) sMemoire_Release (pDavid->memoire);
+  pDavid->memoire = 0;
+
+  if (pDavid->chrono) sChrono_Release (pDavid->chrono);
+  pDavid->chrono = 0;
 }
 
 // Affiche le contenu d'un David SMPTE -----------------------------------------
@@ -84,7 +133,7 @@ void sDavidSmpte_Print
   sBufferMedia_Print (&pDavid->media, pBuffers);
 
   PRINT1 (cMsgPrintDavidCross)
-  sBufferFec_PrintCross (&pDavid->fec, pBuffers);
+  sBufferMedia_PrintCross (&pDavid->media, pBuffers);
 
   PRINT1 (cMsgPrintDavidWaitCol)
   sBufferFec_PrintWait (&pDavid->fec, COL, pBuffers);
@@ -92,18 +141,14 @@ void sDavidSmpte_Print
   PRINT1 (cMsgPrintDavidWaitRow)
   sBufferFec_PrintWait (&pDavid->fec, ROW, pBuffers);
 
-  clock_t ct = pDavid->chronoTotal / TICKS_TO_MS;
-  clock_t cm = pDavid->chronoMedia / TICKS_TO_MS;
-  clock_t cf = pDavid->chronoFec   / TICKS_TO_MS;
-
   PRINT1 (cMsgPrintDavid,
           pDavid->overwriteMedia ? cMsgOverwriteMediaYes : cMsgOverwriteMediaNo,
-          pDavid->media.rbtree.overCount,
+          pDavid->dryRun         ? cMsgDryRunYes         : cMsgDryRunNo,
+          pDavid->media.overCount,
           pDavid->recovered,
           pDavid->unrecoveredOnReading,
           pDavid->media.readingNx.v,
           pDavid->media.arrivalNx.v,
-          ct, cm, cf,
           pDavid->nbArPaMedia,
           pDavid->nbArPaFec,
           pDavid->nbLePaMedia,
@@ -111,6 +156,82 @@ void sDavidSmpte_Print
           pDavid->nbRePaMedia,
           pDavid->maxC,
           pDavid->maxW)
+
+  if (pDavid->memoire) sMemoire_Print (pDavid->memoire);
+  if (pDavid->chrono)  sChrono_Print  (pDavid->chrono);
+}
+
+/*******************************************************************************
+*                            EXPORT DES MÉTRIQUES                              *
+*******************************************************************************/
+
+// Prend un instantané des statistiques (thread du décodeur) -------------------
+void sDavidSmpte_Metriques
+  (const sDavidSmpte* pDavid,     //: David SMPTE à lire
+   sDavidMetriques*   pMetriques) //: Instantané à remplir
+{
+  ASSERTpc (pDavid,,     cExNullPtr)
+  ASSERTpc (pMetriques,, cExNullPtr)
+
+  pMetriques->recovered            = pDavid->recovered;
+  pMetriques->unrecoveredOnReading = pDavid->unrecoveredOnReading;
+  pMetriques->nbArPaMedia          = pDavid->nbArPaMedia;
+  pMetriques->nbArPaFec            = pDavid->nbArPaFec;
+  pMetriques->nbLePaMedia          = pDavid->nbLePaMedia;
+  pMetriques->nbPePaMedia          = pDavid->nbPePaMedia;
+  pMetriques->nbRePaMedia          = pDavid->nbRePaMedia;
+  pMetriques->overCount            = pDavid->media.overCount;
+  pMetriques->maxC                 = pDavid->maxC;
+  pMetriques->maxW                 = pDavid->maxW;
+  pMetriques->memoire              =
+    pDavid->memoire ? pDavid->memoire->total.octets    : 0;
+  pMetriques->maxMemoire           =
+    pDavid->memoire ? pDavid->memoire->total.maxOctets : 0;
+  pMetriques->mediaCount           = pDavid->media.count;
+  pMetriques->crossCount           = pDavid->media.crossCount;
+  pMetriques->waitCount            = pDavid->fec.wait[0].count +
+                                     pDavid->fec.wait[1].count;
+  pMetriques->readingNo            = pDavid->media.readingNx.v;
+  pMetriques->arrivalNo            = pDavid->media.arrivalNx.v;
+}
+
+// Publie un instantané pour un thread de supervision (thread du décodeur) -----
+// Remarque : ne bloque jamais, à appeler aussi souvent que la fraîcheur   -----
+//            voulue le demande (coût : une copie de l'instantané)         -----
+void sDavidSmpte_Publie
+  (const sDavidSmpte* pDavid,     //: David SMPTE à publier
+   sMetriques*        pMetriques) //: Publication à mettre à jour
+{
+  ASSERTpc (pDavid,,     cExNullPtr)
+  ASSERTpc (pMetriques,, cExNullPtr)
+
+  sDavidMetriques _instantane;
+
+  sDavidSmpte_Metriques (pDavid, &_instantane);
+  sMetriques_Publie
+    (pMetriques, (const uint64_t*)&_instantane, DAVID_METRIQUES);
+}
+
+// Exporte la dernière publication (depuis n'importe quel thread) --------------
+// Remarque : Prometheus texte, ou JSON si la destination finit par .json  -----
+//> Export réussi ?
+bool sDavidSmpte_ExporteMetriques
+  (const sMetriques* pMetriques,   //: Publication à exporter
+   const char*       pDestination) //: Fichier ou unix:chemin de la socket
+{
+  ASSERTpc (pMetriques,   false, cExNullPtr)
+  ASSERTpc (pDestination, false, cExNullPtr)
+
+  uint64_t _valeurs[METRIQUES_MAX];
+
+  unsigned _nombre = sMetriques_Lit (pMetriques, _valeurs);
+
+  // Rien encore publié : l'export attendra la première publication
+  IFNOT (_nombre == DAVID_METRIQUES, false)
+
+  return sMetriques_Exporte
+    (pDestination, sMetriques_Format (pDestination), METRIQUES_PREFIXE,
+     cDavidMetriques, _valeurs, _nombre);
 }
 
 /*******************************************************************************
@@ -131,20 +252,17 @@ void sDavidSmpte_ArriveePaquetMedia
 
   PRINT2 ("David ArriveePaquetMedia mediaNo=%u : ", pMedia->mediaNo)
 
-  clock_t add = 0;
-  clock_t now = clock();
+  uint64_t _debut = CHRONO_DEBUT (pDavid->chrono);
 
   bool ok = sBufferMedia_AddByReference
               (&pDavid->media, pMedia, pDavid->overwriteMedia);
   ASSERT (ok,, cExMediaAdd, pMedia->mediaNo)
 
-  add = clock() - now;
-  pDavid->chronoTotal += add;
-  pDavid->chronoMedia += add;
-  now = clock();
-
   // Le paquet média est signalé comme perdu dans FEC : simuler la récup. !
-  sCrossFec* _cross = sBufferFec_FindCross (&pDavid->fec, pMedia->mediaNo);
+  sCrossFec* _cross =
+    sBufferMedia_FindCross (&pDavid->media, pMedia->mediaNo);
+
+  CHRONO_FIN (pDavid->chrono, PHASE_MEDIA, _debut)
 
   if (_cross != 0)
   {
@@ -158,10 +276,7 @@ void sDavidSmpte_ArriveePaquetMedia
     PRINT2 ("aucun paquet de FEC ne cite ce paquet media\n")
   }
 
-  add = clock() - now;
   pDavid->nbArPaMedia++;
-  pDavid->chronoTotal += add;
-  pDavid->chronoFec   += add;
 }
 
 // Un paquet de FEC vient d'arriver, liste les paquets média manquants que   ---
@@ -181,8 +296,7 @@ void sDavidSmpte_ArriveePaquetFec
   DETAILS2 (sPaquetFec_Print (pFec);)
   PRINT2   ("\n")
 
-  clock_t add = 0;
-  clock_t now = clock();
+  uint64_t _debut = CHRONO_DEBUT (pDavid->chrono);
 
   // Lecture des champs du paquet SMPTE 2022-1 FEC
 
@@ -191,12 +305,19 @@ void sDavidSmpte_ArriveePaquetFec
   if (pFec->DWORD3.type  != XOR)           return; // doit être XOR
   if (pFec->DWORD3.index != FEC_INDEX_XOR) return; // doit être 0
 
-  sWaitFec* _wait = sWaitFec_Forge (pFec);
+  // Dry run : le wait ne copie pas resXor, la récupération ne xor rien
+  if (pDavid->dryRun) pFec->DWORD0.Length_recovery = 0;
+
+  sWaitFec* _wait = sBufferFec_ForgeWait (&pDavid->fec, pFec);
   ASSERTc  (_wait,, cExFecForge)
 
   sPaquetFec_Release (pFec);
 
-  sCrossFec* _crossLast = 0;
+  // La fenêtre du buffer média suit la matrice annoncée (L×D en colonne)
+  bool     ok = sBufferMedia_Dimensionne
+                  (&pDavid->media, _wait->NA * _wait->Offset);
+  ASSERTc (ok,, cExAllocateMemory)
+
   sMediaNo   _mediaLast = 0;
   sMediaNo   _mediaTest = _wait->SNBase;
   sMediaNo   _mediaMax  = _wait->SNBase + _wait->NA * _wait->Offset;
@@ -204,7 +325,7 @@ void sDavidSmpte_ArriveePaquetFec
   // Paquet média protégés : médiaNo = SNBase + j*offset, avec j entre [0;NA[
   for (; _mediaTest != _mediaMax; _mediaTest += _wait->Offset)
   {
-    if (sBufferMedia_Find (&pDavid->media, _mediaTest) != NULL)
+    if (sBufferMedia_IsPresent (&pDavid->media, _mediaTest))
     {
       PRINT2 (cMsgDavidArPaFecPresent, _mediaTest)
     }
@@ -212,8 +333,8 @@ void sDavidSmpte_ArriveePaquetFec
     {
       PRINT2 (cMsgDavidArPaFecMissing, _mediaTest)
 
-      _crossLast =
-        sDavidSmpte_PerduPaquetMedia (pDavid, _mediaLast = _mediaTest, _wait);
+      // Le cross est relu après la boucle (un AddCross peut le déplacer)
+      sDavidSmpte_PerduPaquetMedia (pDavid, _mediaLast = _mediaTest, _wait);
     }
   }
 
@@ -223,13 +344,16 @@ void sDavidSmpte_ArriveePaquetFec
   {
     PRINT2 ("David ArriveePaquetFec : paquet de FEC est inutile\n\n")
 
-    sWaitFec_Release (_wait);
-    goto __fin_chrono;
+    sBufferFec_RecycleWait (&pDavid->fec, _wait);
+    CHRONO_FIN             (pDavid->chrono, PHASE_SCAN, _debut)
+
+    pDavid->nbArPaFec++;
+    return;
   }
 
   // Enregistre le paquet de FEC dans bufferFec.wait[D]
 
-  bool    ok = sBufferFec_AddWaitByReference (&pDavid->fec, _wait, false);
+  ok = sBufferFec_AddWaitByReference (&pDavid->fec, _wait, false);
   ASSERT (ok,, cExWaitAdd, _wait->fecNo)
 
   if (pDavid->fec.wait[_wait->D].count > pDavid->maxW)
@@ -237,12 +361,18 @@ void sDavidSmpte_ArriveePaquetFec
     pDavid->maxW = pDavid->fec.wait[_wait->D].count;
   }
 
+  CHRONO_FIN (pDavid->chrono, PHASE_SCAN, _debut)
+
   // [2] Qu'un seul paquet média manquant : récupération possible
 
   if (_wait->number == 1)
   {
     PRINT2("David ArriveePaquetFec : paquet de FEC va recuperer paquet media\n")
 
+    sCrossFec* _crossLast =
+      sBufferMedia_FindCross (&pDavid->media, _mediaLast);
+    ASSERT (_crossLast,, cExFecFindCross, _mediaLast)
+
     sDavidSmpte_RecupPaquetMedia (pDavid, _mediaLast, _crossLast, _wait);
   }
 
@@ -254,11 +384,7 @@ void sDavidSmpte_ArriveePaquetFec
     ("David ArriveePaquetFec : paquet de FEC conserve pour cascade future\n\n")
   }
 
-__fin_chrono:
-  add = clock() - now;
   pDavid->nbArPaFec++;
-  pDavid->chronoTotal += add;
-  pDavid->chronoFec   += add;
 }
 
 // Imite la lecture du buffer média et en profite pour nettoyer les buffers ----
@@ -271,58 +397,51 @@ bool sDavidSmpte_LecturePaquetMedia
   ASSERTpc (pDavid, false, cExNullPtr)
 
   // Le buffer média n'a pas dépassé la capacité demandée
-  if (pDavid->media.rbtree.count <= pBufferSize) return false;
+  if (pDavid->media.count <= pBufferSize) return false;
 
-  clock_t add = 0;
-  clock_t now = clock();
+  uint64_t _debut = CHRONO_DEBUT (pDavid->chrono);
 
   sMediaNo _readedNo;
 
   bool ok = sBufferMedia_ReadMedia (&pDavid->media, pDestFile, &_readedNo);
 
-  add = clock() - now;
-  pDavid->chronoTotal += add;
-  pDavid->chronoMedia += add;
-  now = clock();
+  CHRONO_FIN (pDavid->chrono, PHASE_LECTURE, _debut)
+  _debut = CHRONO_DEBUT (pDavid->chrono);
 
   PRINT2 ("David LecturePaquetMedia %u\n", _readedNo)
 
   // Nettoye le buffer de FEC
 
-  sCrossFec* _cross = sBufferFec_FindCross (&pDavid->fec, _readedNo);
+  sCrossFec* _cross = sBufferMedia_FindCross (&pDavid->media, _readedNo);
 
   if (_cross)
   {
     // Un paquet de FEC dépendant d'un paquet média supprimé est inutile car
     // l'opération de récuperation ne peut réussire (xor)
 
-    sFecNx _colNx = _cross->colNx;
-    sFecNx _rowNx = _cross->rowNx;
+    // Les liens du cross mènent directement aux waits (sans recherche)
 
-    // TODO -> optimisation (éviter doublons de code ?)
+    sWaitFec* _colWait = sCrossFec_GetWait (_cross, COL);
+    sWaitFec* _rowWait = sCrossFec_GetWait (_cross, ROW);
 
-    if (!_colNx.null)
-    {
-      // Utilise wait pour retrouver les entrées dans cross qui doivent
-      // êtres supprimées (nettoyage)
+    // Utilise wait pour retrouver les entrées dans cross qui doivent
+    // êtres supprimées (nettoyage)
 
-      sBufferFec_DeleteCrossAndWait (&pDavid->fec, COL, _colNx.v);
+    if (_colWait)
+    {
+      sBufferFec_DeleteCrossAndWait (&pDavid->fec, &pDavid->media, _colWait);
     }
 
-    if (!_rowNx.null)
+    if (_rowWait)
     {
-      // Utilise wait pour retrouver les entrées dans cross qui doivent
-      // êtres supprimées (nettoyage)
-
-      sBufferFec_DeleteCrossAndWait (&pDavid->fec, ROW, _rowNx.v);
+      sBufferFec_DeleteCrossAndWait (&pDavid->fec, &pDavid->media, _rowWait);
     }
   }
 
-  add = clock() - now;
+  CHRONO_FIN (pDavid->chrono, PHASE_NETTOYAGE, _debut)
+
   pDavid->nbLePaMedia++;
   if (!ok) pDavid->unrecoveredOnReading++;
-  pDavid->chronoTotal += add;
-  pDavid->chronoFec   += add;
 
   return true;
 }
@@ -349,37 +468,24 @@ sCrossFec* sDavidSmpte_PerduPaquetMedia
   // ajoute la nouvelle entrée [lie paquet média manquant <-> paquet de FEC]
 
   // Recherche si l'entrée est déjà existante ...
-  sCrossFec* _cross = sBufferFec_FindCross (&pDavid->fec, pMediaNo);
+  sCrossFec* _cross = sBufferMedia_FindCross (&pDavid->media, pMediaNo);
 
   if (_cross == 0)
   {
-    _cross = sCrossFec_New();
-    ASSERTc (_cross, 0, cExCrossNew)
-
-    bool ok =
-      sBufferFec_AddCrossByReference (&pDavid->fec, pMediaNo, _cross, false);
-    ASSERT (ok, 0, cExCrossAdd, pMediaNo)
+    _cross = sBufferMedia_AddCross (&pDavid->media, pMediaNo);
+    ASSERT (_cross, 0, cExCrossAdd, pMediaNo)
 
-    if (pDavid->fec.cross.count > pDavid->maxC)
+    if (pDavid->media.crossCount > pDavid->maxC)
     {
-      pDavid->maxC = pDavid->fec.cross.count;
+      pDavid->maxC = pDavid->media.crossCount;
     }
   }
 
   // Met à jour l'élément dans pBufferFec.cross
 
-  if (pWait->D == COL)
-  {
-    ASSERTc (_cross->colNx.null, 0, cExAlgorithmCaller)
+  ASSERTc (!sCrossFec_GetWait (_cross, pWait->D), 0, cExAlgorithmCaller)
 
-    _cross->colNx = sFecNo_to_sFecNx (pWait->fecNo);
-  }
-  else
-  {
-    ASSERTc (_cross->rowNx.null, 0, cExAlgorithmCaller)
-
-    _cross->rowNx = sFecNo_to_sFecNx (pWait->fecNo);
-  }
+  sCrossFec_Link (_cross, pWait);
 
   sMediaNx j = sWaitFec_ComputeJ (pWait, pMediaNo);
   ASSERTc (!j.null, 0, cExWaitComputeJ)
@@ -420,23 +526,30 @@ void sDavidSmpte_RecupPaquetMedia
 
   unsigned no;
 
+  // Chaque portion est chronométrée à part : les appels récursifs de la
+  // cascade ajoutent leurs propres durées
+  uint64_t _debut = CHRONO_DEBUT (pDavid->chrono);
+
   // [1 ou 2 ou 3] Lecture des données du cross et suppression de ce dernier
 
-  sFecNx _cascadeFecNx[2];
-  _cascadeFecNx[COL] = pCross->colNx;
-  _cascadeFecNx[ROW] = pCross->rowNx;
+  // Copie des liens (le cross est supprimé), revalidés à chaque usage car
+  // une cascade peut entre-temps avoir recyclé l'un des waits liés
+  sCrossFec _cascade = *pCross;
 
-  bool     ok = sBufferFec_DeleteCross (&pDavid->fec, pMediaNo);
+  bool     ok = sBufferMedia_DeleteCross (&pDavid->media, pMediaNo);
   ASSERTc (ok,, cExCrossDelete)
 
   // [2 ou 3] Récupère le paquet média
   //          Supprime les trace du paquet de FEC devenu inutile
 
+  CHRONO_FIN (pDavid->chrono, PHASE_CASCADE, _debut)
+  _debut = CHRONO_DEBUT (pDavid->chrono);
+
   if (_parFec)
   {
-    ASSERTc (pWait->number == 1,,                        cExAlgorithmCaller)
-    ASSERTc (!_cascadeFecNx[pWait->D].null,,             cExAlgorithmCaller)
-    ASSERTc (pWait->fecNo == _cascadeFecNx[pWait->D].v,, cExAlgorithmCaller)
+    ASSERTc (pWait->number == 1,, cExAlgorithmCaller)
+    ASSERTc (sCrossFec_GetWait (&_cascade, pWait->D) == pWait,,
+             cExAlgorithmCaller)
 
     PRINT2 (cMsgDavidRePaMediaRecover, pMediaNo)
 
@@ -458,15 +571,19 @@ void sDavidSmpte_RecupPaquetMedia
     {
       if (_mediaNo == pMediaNo) continue;
 
-      sPaquetMedia* _ami = sBufferMedia_Find (&pDavid->media, _mediaNo);
+      // Méta-données lues dans les slots, seul le payload touche au bloc
+      unsigned _slot = MEDIA_SLOT (&pDavid->media, _mediaNo);
 
-      _recup->timeStamp   ^= _ami->timeStamp;
-      _recup->payloadType ^= _ami->payloadType;
+      _recup->timeStamp   ^= pDavid->media.timeStamp  [_slot];
+      _recup->payloadType ^= pDavid->media.payloadType[_slot];
 
-      unsigned _size = MIN (_recup->payloadSize, _ami->payloadSize);
+      const uint8_t* _ami = pDavid->media.slot[_slot].block->payload;
+
+      unsigned _size =
+        MIN (_recup->payloadSize, pDavid->media.payloadSize[_slot]);
       for (no = 0; no < _size; no++)
       {
-        _recup->payload[no] ^= _ami->payload[no];
+        _recup->payload[no] ^= _ami[no];
       }
     }
 
@@ -476,56 +593,61 @@ void sDavidSmpte_RecupPaquetMedia
 
     pDavid->recovered++;
 
-    _cascadeFecNx[pWait->D] = FEC_NX_NULL;
+    sCrossFec_Unlink (&_cascade, pWait->D);
 
-    ok = sBufferFec_DeleteWait (&pDavid->fec, pWait->D, pWait->fecNo);
+    ok = sBufferFec_DeleteWait (&pDavid->fec, pWait);
     ASSERTc (ok,, cExWaitDelete)
+
+    CHRONO_FIN (pDavid->chrono, PHASE_RECUP, _debut)
+    _debut = CHRONO_DEBUT (pDavid->chrono);
   }
 
   // [1 ou 2 ou 3] Vérifie s'il y a une cascade ...
 
-  sWaitFec* _cascadeWait[2] = {0, 0};
-
   for (no = 0; no < 2; no++)
   {
-    if (_cascadeFecNx[no].null) continue;
-
-    // Recherche dans buffer de FEC si le paquet de FEC lié au paquet média
-    // vient de se faire débloquer (il attendait sur 2 paquet média et
+    // Suit le lien vers le paquet de FEC lié au paquet média qui vient
+    // peut-être de se faire débloquer (il attendait sur 2 paquet média et
     // maintenant sur un seul) et dans ce cas, l'activerait en cascade ...
 
-    _cascadeWait[no] =
-      sBufferFec_FindWait (&pDavid->fec, no, _cascadeFecNx[no].v);
-    ASSERTc (_cascadeWait[no],, cExFecFindWait)
+    sWaitFec* _cascadeWait = sCrossFec_GetWait (&_cascade, no);
+    if (!_cascadeWait) continue;
 
-    sMediaNx j = sWaitFec_ComputeJ (_cascadeWait[no], pMediaNo);
+    sMediaNx j = sWaitFec_ComputeJ (_cascadeWait, pMediaNo);
     ASSERTc (!j.null,, cExWaitComputeJ)
 
     // Ne retire que le paquet média médiaNo = (no_bit_dans_tab_manque) manque
-    sWaitFec_SetManque (_cascadeWait[no], j.v, false);
+    sWaitFec_SetManque (_cascadeWait, j.v, false);
   }
 
   for (no = 0; no < 2; no++)
   {
-    if (_cascadeFecNx[no].null) continue;
+    sWaitFec* _cascadeWait = sCrossFec_GetWait (&_cascade, no);
+    if (!_cascadeWait) continue;
 
-    if (_cascadeWait[no]->number == 1)
+    if (_cascadeWait->number == 1)
     {
       // Cascade !
       PRINT2 ("RecupPaquetMedia : Cascade !\n")
 
-      sMediaNx _cascadeMediaNx = sWaitFec_GetManque (_cascadeWait[no], 1);
+      sMediaNx _cascadeMediaNx = sWaitFec_GetManque (_cascadeWait, 1);
       ASSERTc (!_cascadeMediaNx.null,, cExWaitComputeNo)
 
       sCrossFec* _cascadeCross =
-        sBufferFec_FindCross (&pDavid->fec, _cascadeMediaNx.v);
+        sBufferMedia_FindCross (&pDavid->media, _cascadeMediaNx.v);
       ASSERT (_cascadeCross,, cExFecFindCross, _cascadeMediaNx.v)
 
+      CHRONO_FIN (pDavid->chrono, PHASE_CASCADE, _debut)
+
       sDavidSmpte_RecupPaquetMedia
-        (pDavid, _cascadeMediaNx.v, _cascadeCross, _cascadeWait[no]);
+        (pDavid, _cascadeMediaNx.v, _cascadeCross, _cascadeWait);
+
+      _debut = CHRONO_DEBUT (pDavid->chrono);
     }
   }
 
+  CHRONO_FIN (pDavid->chrono, PHASE_CASCADE, _debut)
+
   PRINT2   ("David RecupPaquetMedia ")
   DETAILS2 (if (_parFec) { PRINT2 ("[2 ou 3] ") }
             else         { PRINT2 ("[1] ") }
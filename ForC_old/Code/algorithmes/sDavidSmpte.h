@@ -37,6 +37,7 @@ typedef struct
   sBufferFec   fec;   //. Stockage des paquets de FEC et FEC <-> média
 
   bool overwriteMedia; //. Ecrasage des doublons dans buffer média autorisé ?
+  bool dryRun;         //. Métadonnées seules : payloads ignorés (voir New)
 
   unsigned recovered;            //. Nombre de paquets média récupérés
   unsigned unrecoveredOnReading; //. Nb paq. média manquants lors de la lecture !
@@ -50,15 +51,43 @@ typedef struct
   unsigned maxC; //. Nombre max d'éléments stockés dans Cross
   unsigned maxW; //. Nombre max d'éléments stockés dans Wait
 
-  clock_t chronoTotal; //. Temps d'exécution total en TICKS
-  clock_t chronoMedia; //. Temps d'exécution total pour média en TICKS
-  clock_t chronoFec;   //. Temps d'exécution total pour FEC   en TICKS
+  sMemoire* memoire; //. Mémoire allouée par catégorie (0 = non comptée)
+  sChrono*  chrono;  //. Durées des phases (0 = non chronométré, ex. dry run)
 }
   sDavidSmpte;
 
+// Instantané des statistiques d'un David SMPTE (export de métriques)      -----
+// Remarque : que des uint64_t, dans l'ordre des descriptions de           -----
+//            cDavidMetriques (publiés tels quels par sMetriques_Publie)   -----
+typedef struct
+{
+  uint64_t recovered;            //. Nombre de paquets média récupérés
+  uint64_t unrecoveredOnReading; //. Nb paq. média manquants lors de la lecture
+  uint64_t nbArPaMedia;          //. Nombre d'appels à ArriveePaquetMedia
+  uint64_t nbArPaFec;            //. Nombre d'appels à ArriveePaquetFec
+  uint64_t nbLePaMedia;          //. Nombre d'appels à LecturePaquetMedia
+  uint64_t nbPePaMedia;          //. Nombre d'appels à PerduPaquetMedia
+  uint64_t nbRePaMedia;          //. Nombre d'appels à RecupPaquetMedia
+  uint64_t overCount;            //. Nombre d'overwrite(s) de paquets média
+  uint64_t maxC;                 //. Nombre max d'éléments stockés dans Cross
+  uint64_t maxW;                 //. Nombre max d'éléments stockés dans Wait
+  uint64_t memoire;              //. Octets alloués (voir sMemoire)
+  uint64_t maxMemoire;           //. Maximum atteint par les octets alloués
+  uint64_t mediaCount;           //. Nombre de paquets média présents
+  uint64_t crossCount;           //. Nombre de cross actuels
+  uint64_t waitCount;            //. Nombre de waits actuels (2 dimensions)
+  uint64_t readingNo;            //. Position de la lecture   (médiaNo)
+  uint64_t arrivalNo;            //. Position de la réception (médiaNo)
+}
+  sDavidMetriques;
+
+#define DAVID_METRIQUES (sizeof (sDavidMetriques) / sizeof (uint64_t))
+
+extern const sMetrique cDavidMetriques[DAVID_METRIQUES]; //. Noms exportés
+
 // Déclaration des fonctions ===================================================
 
-sDavidSmpte sDavidSmpte_New (bool pOverwriteMedia);
+sDavidSmpte sDavidSmpte_New (bool pOverwriteMedia, bool pDryRun);
 
 void sDavidSmpte_Release (      sDavidSmpte*);
 void sDavidSmpte_Print   (const sDavidSmpte*, bool pBuffers);
@@ -67,6 +96,10 @@ void sDavidSmpte_ArriveePaquetMedia (sDavidSmpte*, sPaquetMedia*);
 void sDavidSmpte_ArriveePaquetFec   (sDavidSmpte*, sPaquetFec*);
 bool sDavidSmpte_LecturePaquetMedia (sDavidSmpte*, sMediaNo pBufferSize, FILE*);
 
+void sDavidSmpte_Metriques (const sDavidSmpte*, sDavidMetriques*);
+void sDavidSmpte_Publie    (const sDavidSmpte*, sMetriques*);
+bool sDavidSmpte_ExporteMetriques (const sMetriques*, const char* pDestination);
+
 /*http://yarchive.net/comp/ansic_broken_unsigned.html
 
 	unsigned short s = USHRT_MAX;
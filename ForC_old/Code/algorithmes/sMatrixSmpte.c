@@ -0,0 +1,357 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Fixed L x D decoders and dispatcher
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Constantes privées ==========================================================
+
+#define MATRIX_WAITS 2048 //. Taille du pool de waits de chaque spécialisation
+
+// Types de données privés =====================================================
+
+// Fonctions d'un décodeur spécialisé (une table par profil) -------------------
+typedef struct sMatrixOps
+{
+  uint8_t  L;      //. Nombre de colonnes du profil
+  uint8_t  D;      //. Nombre de lignes   du profil
+  uint16_t Lrecov; //. Longueur du payload protégé
+
+  void*    (*New)                (sBufferMedia, bool pOverwriteMedia);
+  void     (*Release)            (void*);
+  void     (*Print)              (const void*, bool pBuffers);
+  void     (*ArriveePaquetMedia) (void*, sPaquetMedia*);
+  void     (*ArriveePaquetFec)   (void*, sPaquetFec*);
+  bool     (*LecturePaquetMedia) (void*, sMediaNo pBufferSize, FILE*);
+  unsigned (*MediaCount)         (const void*);
+}
+  sMatrixOps;
+
+// Spécialisations (gabarit instancié une fois par profil) =====================
+
+#define MATRIX_NOM    5x5
+#define MATRIX_L      5
+#define MATRIX_D      5
+#define MATRIX_LRECOV PLDS
+#include "sMatrixSmpte_template.h"
+
+#define MATRIX_NOM    10x10
+#define MATRIX_L      10
+#define MATRIX_D      10
+#define MATRIX_LRECOV PLDS
+#include "sMatrixSmpte_template.h"
+
+#define MATRIX_NOM    20x5
+#define MATRIX_L      20
+#define MATRIX_D      5
+#define MATRIX_LRECOV PLDS
+#include "sMatrixSmpte_template.h"
+
+// Profils, dans l'ordre de eMatrixProfil (à partir de MATRIX_5x5) -------------
+static const sMatrixOps* cMatrixProfils[] =
+{
+  &cMatrixOps_5x5, &cMatrixOps_10x10, &cMatrixOps_20x5
+};
+
+#define MATRIX_NB_PROFILS (sizeof (cMatrixProfils) / sizeof (cMatrixProfils[0]))
+
+// Fonctions privées ===========================================================
+
+// L'algorithme générique cède son buffer média au décodeur choisi : libère ----
+// ce qu'il garde (buffer FEC, comptabilité mémoire et chronos). Le buffer  ----
+// média a été détaché de la comptabilité avant d'être copié (voir Choix)   ----
+static void sMatrixSmpte_Cede
+  (sMatrixSmpte* pMatrix) //: Décodeur dont le générique est remplacé
+{
+  sBufferFec_Release (&pMatrix->david.fec);
+
+  if (pMatrix->david.memoire) sMemoire_Release (pMatrix->david.memoire);
+  pMatrix->david.memoire = 0;
+
+  if (pMatrix->david.chrono) sChrono_Release (pMatrix->david.chrono);
+  pMatrix->david.chrono = 0;
+}
+
+// Choisit le profil d'après le dernier paquet de FEC colonne reçu         -----
+// (L=Offset, D=NA) : un paquet de FEC ligne ne donne que L (NA), 5x7      -----
+// passerait alors pour 5x5. Voir sMatrixSmpte_Choix, qui attend ce paquet -----
+static void sMatrixSmpte_ChoixProfil
+  (sMatrixSmpte* pMatrix) //: Décodeur à mettre à jour
+{
+  unsigned no, _trouve = 0, _nb = 0;
+
+  for (no = 0; no < MATRIX_NB_PROFILS; no++)
+  {
+    const sMatrixOps* _ops = cMatrixProfils[no];
+
+    if (pMatrix->colLrecov == _ops->Lrecov &&
+        pMatrix->colL      == _ops->L &&
+        pMatrix->colD      == _ops->D)
+    {
+      _trouve = no;
+      _nb++;
+    }
+  }
+
+  pMatrix->profil = MATRIX_GENERIQUE;
+
+  if (_nb != 1) return;
+
+  const sMatrixOps* _ops = cMatrixProfils[_trouve];
+
+  // La spécialisation reprend le buffer média alimenté jusqu'ici (copie
+  // détachée de la comptabilité, qui ne survit pas au changement)
+  sBufferMedia_Comptabilise (&pMatrix->david.media, 0);
+
+  void* _special = _ops->New (pMatrix->david.media, pMatrix->overwriteMedia);
+
+  if (!_special) // Allocation ratée ? alors reste générique
+  {
+    sBufferMedia_Comptabilise (&pMatrix->david.media, pMatrix->david.memoire);
+    return;
+  }
+
+  sMatrixSmpte_Cede (pMatrix);
+
+  pMatrix->profil  = MATRIX_5x5 + _trouve;
+  pMatrix->special = _special;
+  pMatrix->ops     = _ops;
+}
+
+// Décide (ou reporte) le choix du décodeur à l'arrivée d'un paquet de FEC -----
+// Les deux décisions portent sur le dernier paquet de FEC colonne (L, D)  -----
+// [1] FEC ligne reçu (ou 1D désactivé) : profil L x D ou générique        -----
+// [2] matrices1D matrices sans FEC ligne : décodeur 1D (sColSmpte)        -----
+// [3] Sinon (ou aucun FEC colonne encore) : choix reporté, l'algorithme   -----
+//     générique continue                                                  -----
+static void sMatrixSmpte_Choix
+  (sMatrixSmpte*     pMatrix, //: Décodeur à mettre à jour
+   const sPaquetFec* pFec)    //: Paquet de FEC reçu
+{
+  if (pFec->DWORD3.D == ROW)
+  {
+    pMatrix->ligneVue = true;
+  }
+  else
+  {
+    pMatrix->nbFecCol++;
+    pMatrix->colL      = pFec->DWORD3.Offset;
+    pMatrix->colD      = pFec->DWORD3.NA;
+    pMatrix->colLrecov = pFec->DWORD0.Length_recovery;
+  }
+
+  IFNOT (pMatrix->nbFecCol > 0,) // [3] L x D encore inconnus
+
+  bool _2D = pMatrix->ligneVue || pMatrix->matrices1D == 0;
+  bool _1D = !_2D &&
+    pMatrix->nbFecCol >= pMatrix->matrices1D * pMatrix->colL;
+
+  IFNOT (_2D || _1D,) // [3]
+
+  // Les waits de l'algorithme générique ne sont pas transférés : attendre
+  // qu'il n'en reste plus (lecture ou récupération) avant de changer
+  IFNOT (pMatrix->david.fec.wait[COL].count == 0 &&
+         pMatrix->david.fec.wait[ROW].count == 0,)
+
+  if (_2D) // [1]
+  {
+    sMatrixSmpte_ChoixProfil (pMatrix);
+    return;
+  }
+
+  // [2] Le décodeur 1D reprend le buffer média alimenté jusqu'ici (copie
+  // détachée de la comptabilité, qui ne survit pas au changement)
+  sBufferMedia_Comptabilise (&pMatrix->david.media, 0);
+
+  pMatrix->col = sColSmpte_New (pMatrix->david.media, pMatrix->overwriteMedia);
+
+  if (!pMatrix->col.wait) // Allocation ratée ? alors choix reporté
+  {
+    sBufferMedia_Comptabilise (&pMatrix->david.media, pMatrix->david.memoire);
+    return;
+  }
+
+  sMatrixSmpte_Cede (pMatrix);
+
+  pMatrix->profil = MATRIX_1D;
+}
+
+// Fonctions publiques =========================================================
+
+// Création d'un nouveau décodeur à dispatch                                ----
+// Remarque : ne pas oublier de faire le ménage avec sMatrixSmpte_Release ! ----
+//> Nouveau décodeur
+sMatrixSmpte sMatrixSmpte_New
+  (bool     pOverwriteMedia, //: Ecrasage des doublons dans buffer média ?
+   unsigned pMatrices1D)     //: Nb matrices sans FEC ligne => 1D (0=jamais)
+{
+  sMatrixSmpte _matrix;
+
+  memset (&_matrix.col, 0, sizeof (sColSmpte));
+
+  _matrix.profil         = MATRIX_INDECIS;
+  _matrix.david          = sDavidSmpte_New (pOverwriteMedia, false);
+  _matrix.special        = 0;
+  _matrix.ops            = 0;
+  _matrix.overwriteMedia = pOverwriteMedia;
+  _matrix.ligneVue       = false;
+  _matrix.matrices1D     = pMatrices1D;
+  _matrix.nbFecCol       = 0;
+  _matrix.colL           = 0;
+  _matrix.colD           = 0;
+  _matrix.colLrecov      = 0;
+
+  return _matrix;
+}
+
+// Libère la mémoire allouée par le décodeur -----------------------------------
+void sMatrixSmpte_Release
+  (sMatrixSmpte* pMatrix) //: Décodeur à vider
+{
+  ASSERTpc (pMatrix,, cExNullPtr)
+
+  // Le buffer média de david appartient à la spécialisation (si choisie)
+  if (pMatrix->profil == MATRIX_1D)
+  {
+    sColSmpte_Release (&pMatrix->col);
+  }
+  else if (pMatrix->special)
+  {
+    pMatrix->ops->Release (pMatrix->special);
+    pMatrix->special = 0;
+  }
+  else
+  {
+    sDavidSmpte_Release (&pMatrix->david);
+  }
+}
+
+// Affiche le contenu du décodeur ----------------------------------------------
+void sMatrixSmpte_Print
+  (const sMatrixSmpte* pMatrix,  //: Décodeur à afficher
+   bool                pBuffers) //: Faut-il afficher les détails ?
+{
+  ASSERTpc (pMatrix,, cExNullPtr)
+
+  if (pMatrix->profil == MATRIX_1D)
+  {
+    sColSmpte_Print (&pMatrix->col, pBuffers);
+  }
+  else if (pMatrix->special)
+  {
+    pMatrix->ops->Print (pMatrix->special, pBuffers);
+  }
+  else
+  {
+    PRINT1 (cMsgPrintMatrixGenerique)
+    sDavidSmpte_Print (&pMatrix->david, pBuffers);
+  }
+}
+
+// Un paquet média vient d'arriver (voir sDavidSmpte_ArriveePaquetMedia) -------
+void sMatrixSmpte_ArriveePaquetMedia
+  (sMatrixSmpte* pMatrix, //: Décodeur à mettre à jour
+   sPaquetMedia* pMedia)  //: Paquet média arrivant (du réseau)
+{
+  ASSERTpc (pMatrix,, cExNullPtr)
+  ASSERTpc (pMedia,,  cExNullPtr)
+
+  if (pMatrix->profil == MATRIX_1D)
+  {
+    sColSmpte_ArriveePaquetMedia (&pMatrix->col, pMedia);
+  }
+  else if (pMatrix->special)
+  {
+    pMatrix->ops->ArriveePaquetMedia (pMatrix->special, pMedia);
+  }
+  else
+  {
+    sDavidSmpte_ArriveePaquetMedia (&pMatrix->david, pMedia);
+  }
+}
+
+// Un paquet de FEC vient d'arriver (détermine le profil, voir Choix) ----------
+void sMatrixSmpte_ArriveePaquetFec
+  (sMatrixSmpte* pMatrix, //: Décodeur à mettre à jour
+   sPaquetFec  * pFec)    //: Paquet de FEC arrivant (du réseau)
+{
+  ASSERTpc (pMatrix,, cExNullPtr)
+  ASSERTpc (pFec,,    cExNullPtr)
+
+  if (pMatrix->profil == MATRIX_INDECIS) sMatrixSmpte_Choix (pMatrix, pFec);
+
+  if (pMatrix->profil == MATRIX_1D)
+  {
+    sColSmpte_ArriveePaquetFec (&pMatrix->col, pFec);
+  }
+  else if (pMatrix->special)
+  {
+    pMatrix->ops->ArriveePaquetFec (pMatrix->special, pFec);
+  }
+  else
+  {
+    sDavidSmpte_ArriveePaquetFec (&pMatrix->david, pFec);
+  }
+}
+
+// Imite la lecture du buffer média (voir sDavidSmpte_LecturePaquetMedia) ------
+//> Est-ce qu'une lecture a eu lieu ?
+bool sMatrixSmpte_LecturePaquetMedia
+  (sMatrixSmpte* pMatrix,     //: Décodeur à mettre à jour
+   sMediaNo      pBufferSize, //: Nombre de paquets média à garder (buffer)
+   FILE*         pDestFile)   //: Pour enregistrer le payload (0=pas enreg)
+{
+  ASSERTpc (pMatrix, false, cExNullPtr)
+
+  if (pMatrix->profil == MATRIX_1D)
+  {
+    return sColSmpte_LecturePaquetMedia
+             (&pMatrix->col, pBufferSize, pDestFile);
+  }
+
+  if (pMatrix->special)
+  {
+    return pMatrix->ops->LecturePaquetMedia
+             (pMatrix->special, pBufferSize, pDestFile);
+  }
+
+  return sDavidSmpte_LecturePaquetMedia
+           (&pMatrix->david, pBufferSize, pDestFile);
+}
+
+// Nombre de paquets média dans le buffer --------------------------------------
+//> Nombre de paquets média présents
+unsigned sMatrixSmpte_MediaCount
+  (const sMatrixSmpte* pMatrix) //: Décodeur à interroger
+{
+  ASSERTpc (pMatrix, 0, cExNullPtr)
+
+  if (pMatrix->profil == MATRIX_1D) return pMatrix->col.media.count;
+
+  if (pMatrix->special) return pMatrix->ops->MediaCount (pMatrix->special);
+
+  return pMatrix->david.media.count;
+}
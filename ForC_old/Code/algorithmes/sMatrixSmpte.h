@@ -0,0 +1,89 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Fixed L x D decoders and dispatcher
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SMATRIXSMPTE__
+#define __SMATRIXSMPTE__
+
+// Types de données ============================================================
+
+// Profils de matrice pour lesquels un décodeur spécialisé est compilé    ------
+// (L, D et longueur du payload connus à la compilation, voir le gabarit) ------
+typedef enum
+{
+  MATRIX_INDECIS   = -1, //. Aucun paquet de FEC reçu, profil pas encore choisi
+  MATRIX_GENERIQUE =  0, //. Autre matrice : algorithme générique (david)
+  MATRIX_5x5       =  1, //. L=5,  D=5
+  MATRIX_10x10     =  2, //. L=10, D=10 (ou 1D L=10 D=10 : colonnes seules)
+  MATRIX_20x5      =  3, //. L=20, D=5
+  MATRIX_1D        =  4  //. Aucun FEC ligne reçu : colonnes seules (sColSmpte)
+}
+  eMatrixProfil;
+
+struct sMatrixOps;
+
+// Décodeur choisissant une spécialisation d'après L×D d'un paquet de      -----
+// FEC colonne (L=Offset, D=NA, une fois du FEC ligne reçu), ou            -----
+// l'algorithme générique (sDavidSmpte) si aucune ne correspond. Si aucun  -----
+// paquet de FEC ligne n'est reçu durant matrices1D matrices (L paquets de -----
+// FEC colonne chacune), le flux est considéré 1D et confié au décodeur    -----
+// sColSmpte. Avant ce choix, les paquets sont confiés à l'algorithme      -----
+// générique dont le buffer média est ensuite repris, le changement n'a    -----
+// lieu que lorsque ce dernier n'attend plus aucun paquet de FEC (ses      -----
+// waits ne sont pas transférés).                                          -----
+typedef struct
+{
+  eMatrixProfil profil; //. Profil choisi (ou MATRIX_INDECIS)
+  sDavidSmpte   david;  //. Algorithme générique (et buffer avant le choix)
+  sColSmpte     col;    //. Décodeur 1D (si profil MATRIX_1D)
+
+  void*                    special; //. Décodeur spécialisé (0 = générique)
+  const struct sMatrixOps* ops;     //. Fonctions du décodeur spécialisé
+
+  bool     overwriteMedia; //. Ecrasage des doublons dans buffer média ?
+  bool     ligneVue;       //. Un paquet de FEC ligne a-t-il été reçu ?
+  unsigned matrices1D;     //. Nb matrices sans FEC ligne => 1D (0=jamais)
+  unsigned nbFecCol;       //. Nb paquets de FEC colonne reçus avant le choix
+  uint8_t  colL;           //. L (Offset) du dernier paquet de FEC colonne
+  uint8_t  colD;           //. D (NA)     du dernier paquet de FEC colonne
+  uint16_t colLrecov;      //. Longueur du payload protégé (idem)
+}
+  sMatrixSmpte;
+
+// Déclaration des fonctions ===================================================
+
+sMatrixSmpte sMatrixSmpte_New (bool pOverwriteMedia, unsigned pMatrices1D);
+
+void sMatrixSmpte_Release (      sMatrixSmpte*);
+void sMatrixSmpte_Print   (const sMatrixSmpte*, bool pBuffers);
+
+void sMatrixSmpte_ArriveePaquetMedia (sMatrixSmpte*, sPaquetMedia*);
+void sMatrixSmpte_ArriveePaquetFec   (sMatrixSmpte*, sPaquetFec*);
+bool sMatrixSmpte_LecturePaquetMedia (sMatrixSmpte*, sMediaNo pBuffer, FILE*);
+
+unsigned sMatrixSmpte_MediaCount (const sMatrixSmpte*);
+
+#endif
@@ -0,0 +1,517 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Fixed L x D decoder template
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+// Gabarit d'un décodeur SMPTE 2022-1 spécialisé pour une matrice L x D fixe.
+// Inclus plusieurs fois par sMatrixSmpte.c, une fois par profil, après avoir
+// défini les paramètres suivants (tous annulés à la fin du gabarit) :
+//
+// MATRIX_NOM    = suffixe des types et fonctions générés (ex. 5x5)
+// MATRIX_L      = nombre de colonnes (Offset des paquets de FEC colonne)
+// MATRIX_D      = nombre de lignes   (NA     des paquets de FEC colonne)
+// MATRIX_LRECOV = longueur du payload protégé (Length recovery)
+//
+// Par rapport à sDavidSmpte, la géométrie n'est plus lue dans chaque paquet
+// de FEC : les waits sont de taille fixe (missing sur 32 bits, resXor de
+// MATRIX_LRECOV octets) et rangés dans un pool, les liens média -> wait sont
+// des index dans ce pool et j = (médiaNo - SNBase) / Offset est une division
+// par une constante. Les paquets de FEC hors profil sont rejetés (comptés),
+// hormis ceux tronqués (NA inférieur) comme en fin de flux.
+
+#define MATRIX_CAT2(a,b) a##_##b
+#define MATRIX_CAT(a,b)  MATRIX_CAT2(a,b)
+
+#define MATRIX_T    MATRIX_CAT (sMatrix,     MATRIX_NOM)
+#define MATRIX_WAIT MATRIX_CAT (sMatrixWait, MATRIX_NOM)
+#define MATRIX_F(f) MATRIX_CAT (MATRIX_T, f)
+
+#define MATRIX_NA(pD)     ((pD) == COL ? MATRIX_D : MATRIX_L)
+#define MATRIX_OFFSET(pD) ((pD) == COL ? MATRIX_L : 1)
+#define MATRIX_J(pD,pMediaNo,pSNBase) \
+  ((sMediaNo)((pMediaNo) - (pSNBase)) / MATRIX_OFFSET (pD))
+
+// Assertion statique (voir STATIC_ASSERT) : missing tient sur 32 bits
+typedef char MATRIX_CAT (STATIC_ASSERT_MatrixMissing, MATRIX_NOM)
+  [(MATRIX_L <= UINT32_BITS && MATRIX_D <= UINT32_BITS) ? 1 : -1];
+
+// Types de données ============================================================
+
+// Paquet de FEC en attente (taille fixe, payload inclus) ----------------------
+typedef struct
+{
+  uint32_t missing;     //. Bit j = paquet média SNBase + j*Offset manquant
+  uint32_t TS_recovery; //. Permet de récupérer TimeStamp des paq. média
+  sFecNo   fecNo;       //. FecNo du paquet de FEC
+  sMediaNo SNBase;      //. MédiaNo du 1er paquet média protégé
+  uint8_t  NA;          //. J est entre [0 ; NA[ (NA du profil sauf tronqué)
+  uint8_t  number;      //. Nombre de paquet média manquants
+  uint8_t  D;           //. Direction : colonne ou ligne (eFecD : col,row)
+  uint8_t  PT_recovery; //. Permet de récupérer PloadType des paq. média
+  bool     actif;       //. Wait utilisé (sinon dans la pile des libres)
+
+  uint8_t  resXor[MATRIX_LRECOV]; //. Résultat du xor des paq. média protégés
+}
+  MATRIX_WAIT;
+
+// Décodeur spécialisé : tout est dimensionné à la compilation et alloué -------
+// d'un bloc (pool de waits, pile des waits libres, liens média -> wait) -------
+typedef struct
+{
+  sBufferMedia media; //. Stockage des paquets de média
+
+  bool overwriteMedia; //. Ecrasage des doublons dans buffer média autorisé ?
+
+  unsigned recovered;            //. Nombre de paquets média récupérés
+  unsigned unrecoveredOnReading; //. Nb paq. média manquants lors de la lecture
+  unsigned rejected;             //. Nb paquets de FEC hors profil (ignorés)
+  unsigned poolFull;             //. Nb paquets de FEC ignorés (pool plein)
+
+  unsigned nbArPaMedia; //. Nombre d'appels à ArriveePaquetMedia
+  unsigned nbArPaFec;   //. Nombre d'appels à ArriveePaquetFec
+  unsigned nbLePaMedia; //. Nombre d'appels à LecturePaquetMedia
+  unsigned nbPePaMedia; //. Nombre de paquets média signalés perdus
+  unsigned nbRePaMedia; //. Nombre d'appels à RecupPaquetMedia
+
+  unsigned nbWaits; //. Nombre de waits utilisés
+  unsigned maxW;    //. Nombre max de waits utilisés
+
+  unsigned nbLibres;                     //. Nombre de waits libres
+  uint16_t libre[MATRIX_WAITS];          //. Pile des index de waits libres
+  MATRIX_WAIT wait[MATRIX_WAITS];        //. Pool de waits
+}
+  MATRIX_T;
+
+// Fonctions privées ===========================================================
+
+// Rend un wait au pool --------------------------------------------------------
+static void MATRIX_F (LibereWait)
+  (MATRIX_T* pMatrix, //: Décodeur à mettre à jour
+   unsigned  pWaitNo) //: Index du wait à libérer
+{
+  pMatrix->wait[pWaitNo].actif = false;
+  pMatrix->libre[pMatrix->nbLibres++] = pWaitNo;
+  pMatrix->nbWaits--;
+}
+
+// Supprime un wait et les liens des paquets média qu'il attendait encore ------
+static void MATRIX_F (DeleteLienAndWait)
+  (MATRIX_T* pMatrix, //: Décodeur à mettre à jour
+   unsigned  pWaitNo) //: Index du wait à supprimer
+{
+  MATRIX_WAIT* _wait = &pMatrix->wait[pWaitNo];
+
+  uint32_t _missing = _wait->missing;
+
+  while (_missing)
+  {
+    sMediaNo _mediaNo = _wait->SNBase +
+      __builtin_ctz (_missing) * MATRIX_OFFSET (_wait->D);
+
+    uint16_t* _lien = sBufferMedia_FindLien (&pMatrix->media, _mediaNo);
+
+    if (_lien && _lien[_wait->D] == pWaitNo + 1) _lien[_wait->D] = 0;
+
+    _missing &= _missing - 1;
+  }
+
+  MATRIX_F (LibereWait) (pMatrix, pWaitNo);
+}
+
+// Forge le paquet média récupéré : resXor ^ (tous les autres paquets média) ---
+// pD est une constante à l'appel, NA, Offset et longueur le sont donc aussi ---
+//> Pointeur sur le paquet média récupéré ou 0 si problème
+static inline sPaquetMedia* MATRIX_F (Recupere)
+  (const MATRIX_T   * pMatrix,  //: Décodeur contenant les paquets média
+         sMediaNo     pMediaNo, //: MédiaNo du paquet média à récupérer
+   const MATRIX_WAIT* pWait,    //: Wait (FEC) permettant la récupération
+         eFecD        pD)       //: Direction du wait (constante)
+{
+  sPaquetMedia* _recup = sPaquetMedia_Forge
+      (pMediaNo, pWait->TS_recovery, pWait->PT_recovery,
+                 MATRIX_LRECOV,      pWait->resXor);
+  IFNOT (_recup, 0)
+
+  unsigned j, no;
+
+  for (j = 0; j < MATRIX_NA (pD); j++)
+  {
+    if (j == pWait->NA) break; // Paquet de FEC tronqué
+
+    sMediaNo _mediaNo = pWait->SNBase + j * MATRIX_OFFSET (pD);
+
+    if (_mediaNo == pMediaNo) continue;
+
+    unsigned _slot = MEDIA_SLOT (&pMatrix->media, _mediaNo);
+
+    _recup->timeStamp   ^= pMatrix->media.timeStamp  [_slot];
+    _recup->payloadType ^= pMatrix->media.payloadType[_slot];
+
+    const uint8_t* _ami = pMatrix->media.slot[_slot].block->payload;
+
+    uint32_t _size = pMatrix->media.payloadSize[_slot];
+
+    if (_size >= MATRIX_LRECOV)
+    {
+      // Longueur connue à la compilation : boucle déroulée / vectorisée
+      for (no = 0; no < MATRIX_LRECOV; no++) _recup->payload[no] ^= _ami[no];
+    }
+    else
+    {
+      for (no = 0; no < _size; no++) _recup->payload[no] ^= _ami[no];
+    }
+  }
+
+  return _recup;
+}
+
+// Même rôle que sDavidSmpte_RecupPaquetMedia (voir ce dernier) : mise à -------
+// jour des waits liés au paquet média, récupération et cascade          -------
+static void MATRIX_F (RecupPaquetMedia)
+  (MATRIX_T* pMatrix,  //: Décodeur à mettre à jour
+   sMediaNo  pMediaNo, //: médiaNo du paquet média à récupérer (ou récupéré)
+   signed    pWaitNo)  //: Wait (FEC) ayant remarqué la perte (-1 = arrivé)
+{
+  unsigned no;
+
+  // Copie des liens du paquet média puis suppression de ces derniers
+  uint16_t  _lien[2] = { 0, 0 };
+  uint16_t* _liens   = sBufferMedia_FindLien (&pMatrix->media, pMediaNo);
+
+  if (_liens)
+  {
+    _lien[COL] = _liens[COL]; _liens[COL] = 0;
+    _lien[ROW] = _liens[ROW]; _liens[ROW] = 0;
+  }
+
+  if (pWaitNo >= 0)
+  {
+    MATRIX_WAIT* _wait = &pMatrix->wait[pWaitNo];
+
+    ASSERTc (_wait->number == 1,,               cExAlgorithmCaller)
+    ASSERTc (_lien[_wait->D] == pWaitNo + 1,,   cExAlgorithmCaller)
+
+    sPaquetMedia* _recup = _wait->D == COL ?
+      MATRIX_F (Recupere) (pMatrix, pMediaNo, _wait, COL) :
+      MATRIX_F (Recupere) (pMatrix, pMediaNo, _wait, ROW);
+    ASSERTc (_recup,, cExMediaForge)
+
+    bool ok = sBufferMedia_AddByReference
+                (&pMatrix->media, _recup, pMatrix->overwriteMedia);
+    ASSERT (ok,, cExMediaAdd, _recup->mediaNo)
+
+    pMatrix->recovered++;
+
+    _lien[_wait->D] = 0;
+
+    MATRIX_F (LibereWait) (pMatrix, pWaitNo);
+  }
+
+  // Le paquet média ne manque plus aux waits liés ...
+
+  for (no = 0; no < 2; no++)
+  {
+    if (_lien[no] == 0) continue;
+
+    MATRIX_WAIT* _wait = &pMatrix->wait[_lien[no]-1];
+    uint32_t     _bit  = 1u << MATRIX_J (no, pMediaNo, _wait->SNBase);
+
+    ASSERTc (_wait->missing & _bit,, cExWaitSetManque)
+
+    _wait->missing &= ~_bit;
+    _wait->number--;
+  }
+
+  // ... ce qui les débloque peut-être (cascade)
+
+  for (no = 0; no < 2; no++)
+  {
+    if (_lien[no] == 0) continue;
+
+    MATRIX_WAIT* _wait = &pMatrix->wait[_lien[no]-1];
+
+    // Wait récupéré entre-temps par une cascade ?
+    if (!_wait->actif || _wait->number != 1) continue;
+
+    sMediaNo _cascadeNo = _wait->SNBase +
+      __builtin_ctz (_wait->missing) * MATRIX_OFFSET (no);
+
+    uint16_t* _cascade = sBufferMedia_FindLien (&pMatrix->media, _cascadeNo);
+    ASSERTc  (_cascade && _cascade[no] == _lien[no],, cExFecFindCross)
+
+    MATRIX_F (RecupPaquetMedia) (pMatrix, _cascadeNo, _lien[no]-1);
+  }
+
+  pMatrix->nbRePaMedia++;
+}
+
+// Fonctions du profil (appelées via sMatrixOps) ===============================
+
+// Création du décodeur spécialisé, reprend le buffer média (par valeur) -------
+//> Pointeur sur le nouveau décodeur ou 0 si problème
+static void* MATRIX_F (New)
+  (sBufferMedia pMedia,          //: Buffer média repris (déjà alimenté)
+   bool         pOverwriteMedia) //: Ecrasage des doublons autorisé ?
+{
+  MATRIX_T* _matrix = AlignedCalloc (sizeof (MATRIX_T));
+  IFNOT    (_matrix, 0) // Allocation ratée ?
+
+  _matrix->media          = pMedia;
+  _matrix->overwriteMedia = pOverwriteMedia;
+  _matrix->nbLibres       = MATRIX_WAITS;
+
+  // Fenêtre du buffer média : L×D connus à la compilation
+  if (!sBufferMedia_Dimensionne (&_matrix->media, MATRIX_L * MATRIX_D))
+  {
+    AlignedFree (_matrix);
+    return 0;
+  }
+
+  unsigned no;
+
+  // Pile des libres : le wait 0 est au sommet
+  for (no = 0; no < MATRIX_WAITS; no++)
+  {
+    _matrix->libre[no] = MATRIX_WAITS-1 - no;
+  }
+
+  return _matrix;
+}
+
+// Libère la mémoire allouée par le décodeur spécialisé ------------------------
+static void MATRIX_F (Release)
+  (void* pSpecial) //: Décodeur à vider
+{
+  MATRIX_T* _matrix = pSpecial;
+
+  sBufferMedia_Release (&_matrix->media);
+  AlignedFree          (_matrix);
+}
+
+// Affiche le contenu du décodeur spécialisé -----------------------------------
+static void MATRIX_F (Print)
+  (const void* pSpecial, //: Décodeur à afficher
+   bool        pBuffers) //: Faut-il afficher les détails (mémoire vars?)
+{
+  const MATRIX_T* _matrix = pSpecial;
+
+  PRINT1 (cMsgPrintMatrixMedia)
+  sBufferMedia_Print (&_matrix->media, pBuffers);
+
+  PRINT1 (cMsgPrintMatrix,
+          MATRIX_L, MATRIX_D, MATRIX_LRECOV,
+          _matrix->overwriteMedia ? cMsgOverwriteMediaYes:cMsgOverwriteMediaNo,
+          _matrix->media.overCount,
+          _matrix->recovered,
+          _matrix->unrecoveredOnReading,
+          _matrix->rejected,
+          _matrix->poolFull,
+          _matrix->nbArPaMedia,
+          _matrix->nbArPaFec,
+          _matrix->nbLePaMedia,
+          _matrix->nbPePaMedia,
+          _matrix->nbRePaMedia,
+          _matrix->maxW, MATRIX_WAITS)
+}
+
+// Un paquet média vient d'arriver (voir sDavidSmpte_ArriveePaquetMedia) -------
+static void MATRIX_F (ArriveePaquetMedia)
+  (void*         pSpecial, //: Décodeur à mettre à jour
+   sPaquetMedia* pMedia)   //: Paquet média arrivant (du réseau)
+{
+  MATRIX_T* _matrix = pSpecial;
+
+  sMediaNo _mediaNo = pMedia->mediaNo;
+
+  bool ok = sBufferMedia_AddByReference
+              (&_matrix->media, pMedia, _matrix->overwriteMedia);
+  ASSERT (ok,, cExMediaAdd, _mediaNo)
+
+  // Le paquet média est signalé comme perdu dans FEC : simuler la récup. !
+  uint16_t* _lien = sBufferMedia_FindLien (&_matrix->media, _mediaNo);
+
+  if (_lien && (_lien[COL] || _lien[ROW]))
+  {
+    MATRIX_F (RecupPaquetMedia) (_matrix, _mediaNo, -1);
+  }
+
+  _matrix->nbArPaMedia++;
+}
+
+// Un paquet de FEC vient d'arriver (voir sDavidSmpte_ArriveePaquetFec) --------
+static void MATRIX_F (ArriveePaquetFec)
+  (void*       pSpecial, //: Décodeur à mettre à jour
+   sPaquetFec* pFec)     //: Paquet de FEC arrivant (du réseau)
+{
+  MATRIX_T* _matrix = pSpecial;
+
+  _matrix->nbArPaFec++;
+
+  eFecD _D = pFec->DWORD3.D;
+
+  bool ok = pFec->DWORD1.Mask            == FEC_MASK_0 &&
+            pFec->DWORD3.X               == FEC_X_0 &&
+            pFec->DWORD3.type            == XOR &&
+            pFec->DWORD3.index           == FEC_INDEX_XOR &&
+            pFec->DWORD3.Offset          == MATRIX_OFFSET (_D) &&
+            pFec->DWORD3.NA              <= MATRIX_NA     (_D) &&
+            pFec->DWORD3.NA              >  0 &&
+            pFec->DWORD0.Length_recovery == MATRIX_LRECOV;
+
+  // Paquet de FEC hors profil ou plus de place : ignoré
+  if (!ok || _matrix->nbLibres == 0)
+  {
+    if (ok) _matrix->poolFull++;
+    else    _matrix->rejected++;
+
+    sPaquetFec_Release (pFec);
+    return;
+  }
+
+  unsigned     _waitNo = _matrix->libre[--_matrix->nbLibres];
+  MATRIX_WAIT* _wait   = &_matrix->wait[_waitNo];
+
+  _matrix->nbWaits++;
+
+  _wait->missing     = 0;
+  _wait->number      = 0;
+  _wait->actif       = true;
+  _wait->D           = _D;
+  _wait->NA          = pFec->DWORD3.NA;
+  _wait->fecNo       = pFec->fecNo;
+  _wait->SNBase      = pFec->DWORD0.SNBase_low_bits;
+  _wait->TS_recovery = pFec->DWORD2.TS_recovery;
+  _wait->PT_recovery = pFec->DWORD1.PT_recovery;
+
+  memcpy (_wait->resXor, pFec->resXor, MATRIX_LRECOV);
+
+  sPaquetFec_Release (pFec);
+
+  sMediaNo _mediaLast = 0;
+  unsigned j;
+
+  // Paquet média protégés : médiaNo = SNBase + j*offset, avec j entre [0;NA[
+  for (j = 0; j < _wait->NA; j++)
+  {
+    sMediaNo _mediaNo = _wait->SNBase + j * MATRIX_OFFSET (_D);
+
+    if (sBufferMedia_IsPresent (&_matrix->media, _mediaNo)) continue;
+
+    uint16_t* _lien = sBufferMedia_AddLien (&_matrix->media, _mediaNo);
+    ASSERTc  (_lien && _lien[_D] == 0,, cExAlgorithmCaller)
+
+    _lien[_D] = _waitNo + 1;
+
+    _wait->missing |= 1u << j;
+    _wait->number++;
+
+    _matrix->nbPePaMedia++;
+    _mediaLast = _mediaNo;
+  }
+
+  // [1] Aucun paquet média manquant : paquet de FEC inutile à conserver
+
+  if (_wait->number == 0)
+  {
+    MATRIX_F (LibereWait) (_matrix, _waitNo);
+    return;
+  }
+
+  if (_matrix->nbWaits > _matrix->maxW) _matrix->maxW = _matrix->nbWaits;
+
+  // [2] Qu'un seul paquet média manquant : récupération possible
+  // [3] Sinon le paquet de FEC est conservé pour une cascade future
+
+  if (_wait->number == 1)
+  {
+    MATRIX_F (RecupPaquetMedia) (_matrix, _mediaLast, _waitNo);
+  }
+}
+
+// Lecture du buffer média et nettoyage (voir sDavidSmpte_LecturePaquetMedia) --
+//> Est-ce qu'une lecture a eu lieu ?
+static bool MATRIX_F (LecturePaquetMedia)
+  (void*    pSpecial,    //: Décodeur à mettre à jour
+   sMediaNo pBufferSize, //: Nombre de paquets média à garder dans le buffer
+   FILE*    pDestFile)   //: Pour enregistrer le payload média (0=pas enreg)
+{
+  MATRIX_T* _matrix = pSpecial;
+
+  if (_matrix->media.count <= pBufferSize) return false;
+
+  sMediaNo _readedNo;
+
+  bool ok = sBufferMedia_ReadMedia (&_matrix->media, pDestFile, &_readedNo);
+
+  // Un paquet de FEC dépendant d'un paquet média supprimé est inutile
+
+  unsigned no;
+
+  for (no = 0; no < 2; no++)
+  {
+    uint16_t* _lien = sBufferMedia_FindLien (&_matrix->media, _readedNo);
+
+    if (_lien && _lien[no]) MATRIX_F (DeleteLienAndWait) (_matrix, _lien[no]-1);
+  }
+
+  _matrix->nbLePaMedia++;
+  if (!ok) _matrix->unrecoveredOnReading++;
+
+  return true;
+}
+
+// Nombre de paquets média dans le buffer --------------------------------------
+static unsigned MATRIX_F (MediaCount)
+  (const void* pSpecial) //: Décodeur à interroger
+{
+  return ((const MATRIX_T*)pSpecial)->media.count;
+}
+
+// Table des fonctions du profil -----------------------------------------------
+static const sMatrixOps MATRIX_CAT (cMatrixOps, MATRIX_NOM) =
+{
+  MATRIX_L, MATRIX_D, MATRIX_LRECOV,
+  MATRIX_F (New),
+  MATRIX_F (Release),
+  MATRIX_F (Print),
+  MATRIX_F (ArriveePaquetMedia),
+  MATRIX_F (ArriveePaquetFec),
+  MATRIX_F (LecturePaquetMedia),
+  MATRIX_F (MediaCount)
+};
+
+#undef MATRIX_J
+#undef MATRIX_OFFSET
+#undef MATRIX_NA
+#undef MATRIX_F
+#undef MATRIX_WAIT
+#undef MATRIX_T
+#undef MATRIX_CAT
+#undef MATRIX_CAT2
+
+#undef MATRIX_LRECOV
+#undef MATRIX_D
+#undef MATRIX_L
+#undef MATRIX_NOM
@@ -0,0 +1,241 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Bit-parallel recoverability oracle
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Fonctions privées ===========================================================
+
+// Masque des L bits de poids faible d'un mot de ligne -------------------------
+static inline uint32_t sOracleSmpte_Masque
+  (uint8_t pN) //: Nombre de bits (1 à 32)
+{
+  return pN >= UINT32_BITS ? UINT32_MAX : (1u << pN) - 1;
+}
+
+// Fonctions publiques =========================================================
+
+// Création d'un motif sans aucune perte (si p2D=false, la matrice est 1D ------
+// et tous ses paquets de FEC ligne sont considérés perdus)               ------
+//> Nouveau motif de pertes
+sOracleSmpte sOracleSmpte_New
+  (uint8_t pL,  //: Nombre de colonnes
+   uint8_t pD,  //: Nombre de lignes
+   bool    p2D) //: Matrice 2D (FEC ligne) ou 1D (FEC colonne seulement) ?
+{
+  sOracleSmpte _oracle;
+
+  memset (&_oracle, 0, sizeof (sOracleSmpte));
+
+  ASSERTpc (pL >= 1 && pL <= ORACLE_MAX, _oracle, cExMatrixMax)
+  ASSERTpc (pD >= 1 && pD <= ORACLE_MAX, _oracle, cExMatrixMax)
+
+  _oracle.L      = pL;
+  _oracle.D      = pD;
+  _oracle.fecRow = p2D ? 0 : sOracleSmpte_Masque (pD);
+
+  return _oracle;
+}
+
+// Création d'un motif depuis un champ de bits (bit no = paquet média no, ------
+// no = r*L + c) comme les configurations énumérées par OldSimulator      ------
+//> Nouveau motif de pertes
+sOracleSmpte sOracleSmpte_FromChampBits
+  (uint8_t           pL,     //: Nombre de colonnes
+   uint8_t           pD,     //: Nombre de lignes
+   bool              p2D,    //: Matrice 2D ou 1D ?
+   const sChampBits* pChamp) //: Champ de bits (1 = paquet média perdu)
+{
+  sOracleSmpte _oracle = sOracleSmpte_New (pL, pD, p2D);
+
+  ASSERTpc (pChamp,                           _oracle, cExNullPtr)
+  ASSERTpc ((unsigned)pL * pD <= CHAMP_NO_MAX, _oracle, cExMatrixMax)
+
+  uint32_t _masque = sOracleSmpte_Masque (pL);
+  unsigned r;
+
+  // Chaque ligne est extraite d'un (ou à cheval sur deux) mot(s) de 64 bits
+  for (r = 0; r < pD; r++)
+  {
+    unsigned _pos = r * pL;
+    unsigned _mot = _pos / CHAMP_TAILLE_UNITE;
+    unsigned _bit = _pos % CHAMP_TAILLE_UNITE;
+
+    uint64_t _v = pChamp->buffer[_mot] >> _bit;
+
+    if (_bit + pL > CHAMP_TAILLE_UNITE && _mot + 1 < CHAMP_NOMBRE_UNITE)
+    {
+      _v |= pChamp->buffer[_mot+1] << (CHAMP_TAILLE_UNITE - _bit);
+    }
+
+    _oracle.media[r] = (uint32_t)_v & _masque;
+  }
+
+  return _oracle;
+}
+
+// Déclare perdu (ou non) le paquet média no = r*L + c -------------------------
+void sOracleSmpte_SetPerte
+  (sOracleSmpte* pOracle, //: Motif à mettre à jour
+   unsigned      pNo,     //: Numéro du paquet média dans la matrice
+   bool          pPerdu)  //: Perdu ?
+{
+  ASSERTpc (pOracle,,                         cExNullPtr)
+  ASSERTpc (pNo < pOracle->L * pOracle->D,,   cExMatrixMax)
+
+  uint32_t _bit = 1u << (pNo % pOracle->L);
+
+  if (pPerdu) pOracle->media[pNo / pOracle->L] |=  _bit;
+  else        pOracle->media[pNo / pOracle->L] &= ~_bit;
+}
+
+// Le paquet média no = r*L + c est-il perdu ? ---------------------------------
+//> Paquet perdu ?
+bool sOracleSmpte_GetPerte
+  (const sOracleSmpte* pOracle, //: Motif à interroger
+   unsigned            pNo)     //: Numéro du paquet média dans la matrice
+{
+  ASSERTpc (pOracle,                          false, cExNullPtr)
+  ASSERTpc (pNo < pOracle->L * pOracle->D,    false, cExMatrixMax)
+
+  return (pOracle->media[pNo / pOracle->L] >> (pNo % pOracle->L)) & 1;
+}
+
+// Nombre de paquets média perdus du motif -------------------------------------
+//> Nombre de bits à 1 de media
+unsigned sOracleSmpte_Pertes
+  (const sOracleSmpte* pOracle) //: Motif à interroger
+{
+  ASSERTpc (pOracle, 0, cExNullPtr)
+
+  unsigned r, _nb = 0;
+
+  for (r = 0; r < pOracle->D; r++)
+  {
+    _nb += __builtin_popcount (pOracle->media[r]);
+  }
+
+  return _nb;
+}
+
+// Affiche le motif (X = paquet perdu, . = présent, c/l = FEC perdu) -----------
+void sOracleSmpte_Print
+  (const sOracleSmpte* pOracle) //: Motif à afficher
+{
+  ASSERTpc (pOracle,, cExNullPtr)
+
+  unsigned r, c;
+
+  for (r = 0; r < pOracle->D; r++)
+  {
+    for (c = 0; c < pOracle->L; c++)
+    {
+      PRINT1 ((pOracle->media[r] >> c) & 1 ? "X " : ". ")
+    }
+
+    PRINT1 ((pOracle->fecRow >> r) & 1 ? " l\n" : " .\n")
+  }
+
+  for (c = 0; c < pOracle->L; c++)
+  {
+    PRINT1 ((pOracle->fecCol >> c) & 1 ? "c " : ". ")
+  }
+
+  PRINT1 ("\n")
+}
+
+// Calcule les paquets média récupérables par le décodage itératif ligne / -----
+// colonne (xor) de SMPTE 2022-1, par épluchage sur les masques de bits :  -----
+// [1] Ligne à FEC reçu dont un seul paquet manque : récupéré              -----
+// [2] Colonnes à FEC reçu dont un seul paquet manque (mot à mot : bits    -----
+//     vus une fois et pas deux en cumulant les lignes) : récupérés        -----
+// [3] Jusqu'à ce qu'un tour ne récupère plus rien (cascades comprises)    -----
+// Remarque : résultat attendu de sDavidSmpte pour une matrice isolée      -----
+//> Nombre de paquets média récupérables (pRecup : lesquels, si non nul)
+unsigned sOracleSmpte_Recuperables
+  (const sOracleSmpte* pOracle, //: Motif de pertes
+   sOracleSmpte*       pRecup)  //: Paquets récupérables (0 = sans intérêt)
+{
+  ASSERTpc (pOracle, 0, cExNullPtr)
+
+  uint32_t _reste[ORACLE_MAX];
+  uint32_t _colOk = ~pOracle->fecCol & sOracleSmpte_Masque (pOracle->L);
+  uint32_t _rowOk = ~pOracle->fecRow & sOracleSmpte_Masque (pOracle->D);
+
+  unsigned r, _D = pOracle->D;
+
+  memcpy (_reste, pOracle->media, _D * sizeof (uint32_t));
+
+  bool _change = true;
+
+  while (_change)
+  {
+    _change = false;
+
+    // [1] Lignes : un seul bit à 1 (et un FEC ligne reçu)
+    for (r = 0; r < _D; r++)
+    {
+      uint32_t _w = _reste[r];
+
+      if (_w != 0 && (_w & (_w-1)) == 0 && ((_rowOk >> r) & 1))
+      {
+        _reste[r] = 0;
+        _change   = true;
+      }
+    }
+
+    // [2] Colonnes : bits vus exactement une fois sur l'ensemble des lignes
+    uint32_t _une = 0, _deux = 0;
+
+    for (r = 0; r < _D; r++)
+    {
+      _deux |= _une & _reste[r];
+      _une  |= _reste[r];
+    }
+
+    uint32_t _seules = _une & ~_deux & _colOk;
+
+    if (_seules)
+    {
+      for (r = 0; r < _D; r++) _reste[r] &= ~_seules;
+      _change = true;
+    }
+  }
+
+  unsigned _nb = 0;
+
+  if (pRecup) *pRecup = *pOracle;
+
+  for (r = 0; r < _D; r++)
+  {
+    uint32_t _recup = pOracle->media[r] & ~_reste[r];
+
+    if (pRecup) pRecup->media[r] = _recup;
+    _nb += __builtin_popcount (_recup);
+  }
+
+  return _nb;
+}
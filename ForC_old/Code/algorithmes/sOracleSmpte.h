@@ -0,0 +1,64 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Bit-parallel recoverability oracle
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SORACLESMPTE__
+#define __SORACLESMPTE__
+
+// Constantes ==================================================================
+
+#define ORACLE_MAX UINT32_BITS //. L et D max (une ligne = un mot de 32 bits)
+
+// Types de données ============================================================
+
+// Motif de pertes d'une matrice L x D : paquet média (ligne r, colonne c) -----
+// = médiaNo SNBase + r*L + c, perdu si le bit c du mot media[r] est à 1.  -----
+// Les paquets de FEC perdus sont donnés par colonne (fecCol) et par ligne -----
+// (fecRow), une matrice 1D n'a aucun FEC ligne (fecRow = tous perdus).    -----
+typedef struct
+{
+  uint8_t  L;                  //. Nombre de colonnes (1 à ORACLE_MAX)
+  uint8_t  D;                  //. Nombre de lignes   (1 à ORACLE_MAX)
+  uint32_t fecCol;             //. Bit c = paquet de FEC colonne c perdu
+  uint32_t fecRow;             //. Bit r = paquet de FEC ligne   r perdu
+  uint32_t media[ORACLE_MAX];  //. [r] Bit c = paquet média (r,c) perdu
+}
+  sOracleSmpte;
+
+// Déclaration des fonctions ===================================================
+
+sOracleSmpte sOracleSmpte_New           (uint8_t pL, uint8_t pD, bool p2D);
+sOracleSmpte sOracleSmpte_FromChampBits (uint8_t pL, uint8_t pD, bool p2D,
+                                         const sChampBits*);
+
+void     sOracleSmpte_SetPerte (      sOracleSmpte*, unsigned pNo, bool);
+bool     sOracleSmpte_GetPerte (const sOracleSmpte*, unsigned pNo);
+unsigned sOracleSmpte_Pertes   (const sOracleSmpte*);
+void     sOracleSmpte_Print    (const sOracleSmpte*);
+
+unsigned sOracleSmpte_Recuperables (const sOracleSmpte*, sOracleSmpte* pRecup);
+
+#endif
@@ -0,0 +1,73 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Aligned memory allocation
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Fonctions publiques =========================================================
+
+// Alloue un bloc mémoire aligné sur une ligne de cache. La taille est   -------
+// arrondie à un multiple de CACHE_LINE pour que deux blocs ne partagent -------
+// jamais la même ligne de cache                                         -------
+// Remarque : ne pas oublier de faire le ménage avec AlignedFree !       -------
+//> Pointeur sur le bloc alloué ou 0 si problème
+void* AlignedMalloc
+  (size_t pSize) //: Taille (en octets) du bloc à allouer
+{
+  #ifdef OPTION_OS_IS_WINDOWS
+  return _aligned_malloc (CACHE_ALIGN (pSize), CACHE_LINE);
+  #else
+  void* _block = 0;
+  IFNOT (posix_memalign (&_block, CACHE_LINE, CACHE_ALIGN (pSize)) == 0, 0)
+  return _block;
+  #endif
+}
+
+// Alloue un bloc mémoire aligné sur une ligne de cache (initialisé à 0) -------
+// Remarque : ne pas oublier de faire le ménage avec AlignedFree !       -------
+//> Pointeur sur le bloc alloué ou 0 si problème
+void* AlignedCalloc
+  (size_t pSize) //: Taille (en octets) du bloc à allouer
+{
+  void*  _block = AlignedMalloc (pSize);
+  IFNOT (_block, 0) // Allocation ratée ?
+
+  memset (_block, 0, CACHE_ALIGN (pSize));
+  return  _block;
+}
+
+// Libère un bloc mémoire alloué par AlignedMalloc ou AlignedCalloc ------------
+void AlignedFree
+  (void* pBlock) //: Bloc à libérer
+{
+  if (pBlock == 0) return;
+
+  #ifdef OPTION_OS_IS_WINDOWS
+  _aligned_free (pBlock);
+  #else
+  free (pBlock);
+  #endif
+}
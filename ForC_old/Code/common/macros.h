@@ -35,6 +35,11 @@ extern void AssertPrintError();
 #define POW2(n) (1 << n)
 #define RAND(n) ((double)rand()*((double)n/(double)RAND_MAX))
 
+// Assertion vérifiée à la compilation (taille des structures, etc.) ===========
+
+#define STATIC_ASSERT(condition,nom) \
+  typedef char STATIC_ASSERT_##nom[(condition) ? 1 : -1];
+
 // Macro de la barre d'avancement (pourcentage) ================================
 
 #define PCENT(value,cond100,logFile) \
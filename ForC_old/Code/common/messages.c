@@ -67,6 +67,8 @@ const char* cMsgSmpteStandard =
 
 const char* cMsgOverwriteMediaYes = "accepted";
 const char* cMsgOverwriteMediaNo  = "asserted";
+const char* cMsgDryRunYes         = "yes (metadata only, no payload)";
+const char* cMsgDryRunNo          = "no";
 
 const char* cMsgDavidArPaFecPresent =
   "David ArriveePaquetFec : media packet %u is present\n";
@@ -110,14 +112,12 @@ const char* cMsgPrintDavidWaitRow =
 const char* cMsgPrintDavid =
   "\n"
   "overwrite media        = %s\n"
+  "dry run                = %s\n"
   "overwrite count        = %u media packets\n"
   "recovered              = %u media packets\n"
   "unrecovered on reading = %u media packets\n"
   "reading no             = %u mediaNo\n"
-  "arrival no             = %u mediaNo\n"
-  "chrono total           = %lu ms\n"
-  "chrono media           = %lu ms\n"
-  "chrono FEC             = %lu ms\n\n"
+  "arrival no             = %u mediaNo\n\n"
   "nb ArriveePaquetMedia  = %u calls\n"
   "nb ArriveePaquetFec    = %u calls\n"
   "nb LecturePaquetMedia  = %u calls\n"
@@ -126,6 +126,53 @@ const char* cMsgPrintDavid =
   "maximum buffered cross = %u nodes\n"
   "maximum buffered wait  = %u nodes\n\n";
 
+const char* cMsgPrintMatrixMedia =
+  "\n\n"
+  "MATRIX (FIXED L x D) FEC ALGORITHM DETAILS\n\n"
+  "Content of the media buffer\n"
+  "***************************\n";
+
+const char* cMsgPrintMatrixGenerique =
+  "\n\n"
+  "MATRIX FEC ALGORITHM : NO PROFILE MATCHED, GENERIC (DAVID) USED\n";
+
+const char* cMsgPrintMatrix =
+  "\n"
+  "profile (L x D, lrecov) = %u x %u, %u bytes\n"
+  "overwrite media        = %s\n"
+  "overwrite count        = %u media packets\n"
+  "recovered              = %u media packets\n"
+  "unrecovered on reading = %u media packets\n"
+  "rejected (not profile) = %u FEC packets\n"
+  "ignored (pool full)    = %u FEC packets\n\n"
+  "nb ArriveePaquetMedia  = %u calls\n"
+  "nb ArriveePaquetFec    = %u calls\n"
+  "nb LecturePaquetMedia  = %u calls\n"
+  "nb lost media packets  = %u packets\n"
+  "nb RecupPaquetMedia    = %u calls\n"
+  "maximum buffered wait  = %u of %u slots\n\n";
+
+const char* cMsgPrintColMedia =
+  "\n\n"
+  "1D (COLUMN ONLY) FEC ALGORITHM DETAILS\n\n"
+  "Content of the media buffer\n"
+  "***************************\n";
+
+const char* cMsgPrintCol =
+  "\n"
+  "overwrite media        = %s\n"
+  "overwrite count        = %u media packets\n"
+  "recovered              = %u media packets\n"
+  "unrecovered on reading = %u media packets\n"
+  "rejected (not 1D)      = %u FEC packets\n"
+  "ignored (slots full)   = %u FEC packets\n\n"
+  "nb ArriveePaquetMedia  = %u calls\n"
+  "nb ArriveePaquetFec    = %u calls\n"
+  "nb LecturePaquetMedia  = %u calls\n"
+  "nb lost media packets  = %u packets\n"
+  "nb found/recovered     = %u packets\n"
+  "maximum buffered wait  = %u of %u slots\n\n";
+
 const char* cMsgPrintBruteMedia =
   "\n\n"
   "BRUTE FEC ALGORITHM DETAILS\n\n"
@@ -137,6 +184,13 @@ const char* cMsgPrintBruteFec =
   "2 of 2) Content of the fec buffer\n"
   "*********************************\n";
 
+const char* cMsgPrintChrono =
+  "chrono %-15s = %10.3f ms, %llu calls, p50 %.0f ns, p99 %.0f ns, "
+  "max %.0f ns\n";
+
+const char* cMsgPrintMemoire =
+  "memory %-15s = %10lld bytes (max %lld), %lld objects (max %lld)\n";
+
 const char* cMsgPrintBrute =
   "\n"
   "overwrite media        = %s\n"
@@ -144,10 +198,7 @@ const char* cMsgPrintBrute =
   "recovered              = %u media packets\n"
   "unrecovered on reading = %u media packets\n"
   "reading no             = %u mediaNo\n"
-  "arrival no             = %u mediaNo\n"
-  "chrono total           = %lu ms\n"
-  "chrono media           = %lu ms\n"
-  "chrono FEC             = %lu ms\n\n"
+  "arrival no             = %u mediaNo\n\n"
   "nb ArriveePaquetMedia  = %u calls\n"
   "nb ArriveePaquetFec    = %u calls\n"
   "nb LecturePaquetMedia  = %u calls\n"
@@ -166,6 +217,7 @@ const char* cLabelDest        = "dest";
 const char* cLabelDestRaw     = "destRaw";
 const char* cLabelDestDavid   = "destDavid";
 const char* cLabelDestBrute   = "destBrute";
+const char* cLabelDestMatrix  = "destMatrix";
 const char* cLabelLrecov      = "lrecov";
 const char* cLabel2DMatrix    = "matrix";
 const char* cLabelMedia0      = "media0";
@@ -180,6 +232,24 @@ const char* cLabelReorderVar  = "var";
 const char* cLabelReorderProb = "prob";
 const char* cLabelWindow      = "window";
 const char* cLabelFBrute      = "fbrute";
+const char* cLabelMatrices1D  = "matrices1D";
+const char* cLabelDryRun      = "dryrun";
+const char* cLabelPackets     = "packets";
+const char* cLabelThreads     = "threads";
+const char* cLabelSeed        = "seed";
+const char* cLabelPeriod      = "period";
+const char* cLabelDelayMedia  = "dmedia";
+const char* cLabelJitterMedia = "jmedia";
+const char* cLabelDelayCol    = "dcol";
+const char* cLabelJitterCol   = "jcol";
+const char* cLabelDelayRow    = "drow";
+const char* cLabelJitterRow   = "jrow";
+const char* cLabelHours       = "hours";
+const char* cLabelRate        = "rate";
+const char* cLabelInterval    = "interval";
+const char* cLabelTolerance   = "tolerance";
+const char* cLabelCounters    = "counters";
+const char* cLabelMetrics     = "metrics";
 
 // Constantes messages modules =================================================
 
@@ -195,6 +265,9 @@ const char* cMsgAboutTFunction =
 #define GENFEC "FecGenerator"
 #define GENERR "ErrorsGenerator"
 #define DECFEC "FecDecoder"
+#define ANAFEC "FecAnalyzer"
+#define BENFEC "FecBenchmark"
+#define SOAFEC "FecSoak"
 
 // Constantes messages GenerateurFec ===========================================
 
@@ -285,19 +358,26 @@ const char* cErrorsGeneratorMsgHelp =
   "dest:   name of the destination file\n\n"
   "p    [0.001] probability (maximum is 1) to have a RTP loss burst\n"
   "q    [2]     mean length (number of packets) of a RTP loss burst\n"
-  "var  [4]     length (number of packets) of a RTP reordering burst\n"
-  "prob [0.01]  probability (maximum is 1) to have a RTP reordering burst\n";
-
-const char* cErrorsGeneratorMsg1of3=  "[1 of 3] Reading&loosing in progress ";
-const char* cErrorsGeneratorMsg2of3="\n[2 of 3] Reordering      in progress ";
-const char* cErrorsGeneratorMsg3of3="\n[3 of 3] Writing         in progress ";
+  "var  [4]     length (number of packets) of a RTP reordering burst, the\n"
+  "             burst is delayed behind the same number of packets\n"
+  "prob [0.01]  probability (maximum is 1) to have a RTP reordering burst\n"
+  "seed [1]     seed of the random generator (same seed = same errors)\n\n"
+  "period [0]   time (us) between two sent packets, if not 0 each packet\n"
+  "             of the destination is preceded by its arrival time\n"
+  "dmedia [0]   fixed delay (us) of the path of the media packets\n"
+  "jmedia [0]   mean jitter (us, exponential) of the media packets\n"
+  "dcol / jcol  same for the column FEC packets\n"
+  "drow / jrow  same for the row FEC packets\n";
+
+const char* cErrorsGeneratorMsg1of1 = "[1 of 1] Work in progress... ";
 
 // Constantes messages DecodeurFec =============================================
 
-const char* cFecDecoderLogFile          = DECFEC ".log";
-const char* cFecDecoderDestSuffixeRaw   = "_resultat_sans_fec";
-const char* cFecDecoderDestSuffixeDavid = "_resultat_avec_david";
-const char* cFecDecoderDestSuffixeBrute = "_resultat_avec_brute";
+const char* cFecDecoderLogFile           = DECFEC ".log";
+const char* cFecDecoderDestSuffixeRaw    = "_resultat_sans_fec";
+const char* cFecDecoderDestSuffixeDavid  = "_resultat_avec_david";
+const char* cFecDecoderDestSuffixeBrute  = "_resultat_avec_brute";
+const char* cFecDecoderDestSuffixeMatrix = "_resultat_avec_matrix";
 
 const char* cFecDecoderMsgTitle =
   "\nDemo " DECFEC " by David Fischer!\n\n";
@@ -321,17 +401,160 @@ const char* cFecDecoderMsgHelp =
   "vv:        verbose level 1 if present\n"
   "vvv:       verbose level 2 if present\n"
   "auto:      console don't wait for a key press if this option is present\n"
+  "dryrun:    payloads skipped if present (statistics only, no payload in\n"
+  "           the destination files)\n"
   "source:    name of the source file (must contain RTP+FEC packets)\n"
   "destRaw:   name of the destination file generated without FEC recovery\n"
   "destDavid: name of the destination file generated by david's algorithm\n"
-  "destBrute: name of the destination file generated by brute's algorithm\n\n"
+  "destBrute: name of the destination file generated by brute's algorithm\n"
+  "destMatrix: if present, also decode with the fixed L x D decoders\n\n"
   "window [200] number (max) of media packets to have in buffer (0=infinite)\n"
   "fbrute [0]   periodicity of the 'brute' treatment (0=don't use this algo)\n"
-  "             ex. 6 mean: do the 'brute' treatment each 6 packets received\n";
+  "             ex. 6 mean: do the 'brute' treatment each 6 packets received\n"
+  "matrices1D [4] matrix decoder switches to the 1D (column only) decoder\n"
+  "             after this number of matrices without row FEC (0=never)\n"
+  "metrics:   if present, david's statistics are exported there while\n"
+  "           decoding (Prometheus text, JSON if the name ends by .json,\n"
+  "           unix:path to send them to a local Unix socket)\n"
+  "interval [1000] period of the metrics export (ms)\n";
+
+const char* cFecDecoderMsg1of3   =   "[1 of 3] Work             in progress ";
+const char* cFecDecoderMsg2of3   = "\n[2 of 3] Writing to david in progress ";
+const char* cFecDecoderMsg3of3   = "\n[3 of 3] Writing to brute in progress ";
+const char* cFecDecoderMsgMatrix = "\n[+]      Writing to matrix in progress ";
+
+// Constantes messages AnalyseurFec ============================================
+
+const char* cFecAnalyzerLogFile = ANAFEC ".log";
+const char* cFecAnalyzerDest    = ANAFEC ".csv";
+
+const char* cFecAnalyzerMsgTitle =
+  "\nDemo " ANAFEC " by David Fischer!\n\n";
+
+const char* cFecAnalyzerMsgSyntax =
+  "Please, call this program with those arguments (3 variants):\n\n";
+
+const char* cFecAnalyzerMsgAboutLFunction =
+  "  Simulate in memory (without any file) a SMPTE 2022-1 stream for each\n"
+  "  point of a grid of FEC profiles (L, D, 1D/2D) and network losses\n"
+  "  (Gilbert-Elliott p, q) and decode it with the metadata-level path of\n"
+  "  david's algorithm. Each point give residual losses, burst lengths and\n"
+  "  the required buffer depth as a line of a CSV file.\n\n";
+
+const char* cFecAnalyzerMsgHelp =
+  ANAFEC ".exe (vv(v) auto) about : about text and exit\n"
+  ANAFEC ".exe (vv(v) auto) help  : this text and exit\n"
+  ANAFEC ".exe (vv(v) auto) L=(list) D=(list) ... p=(list) ... *\n"
+  "* missing options are setted to default, a list is 'v1,v2,...'\n\n"
+  "vv:     verbose level 1 if present\n"
+  "vvv:    verbose level 2 if present\n"
+  "auto:   console don't wait for a key press if this option is present\n"
+  "dest:   name of the destination (CSV) file\n\n"
+  "l       [5]       list of L parameters of the FEC matrix\n"
+  "d       [5]       list of D parameters of the FEC matrix\n"
+  "matrix  [2]       list of types of FEC, 1=1D 2=2D\n"
+  "p       [0.001]   list of probabilities (maximum is 1) of a loss burst\n"
+  "q       [2]       list of mean lengths (in packets) of a loss burst\n"
+  "packets [1000000] number of media packets simulated by point\n"
+  "window  [0]       media packets in buffer before reading (0=2*L*D)\n"
+  "threads [0]       number of workers (0=number of processors)\n"
+  "seed    [1]       seed of the random generator (same seed = same CSV)\n";
+
+const char* cFecAnalyzerMsg1of1 = "[1 of 1] Work in progress... ";
 
-const char* cFecDecoderMsg1of3  =   "[1 of 3] Work             in progress ";
-const char* cFecDecoderMsg2of3  = "\n[2 of 3] Writing to david in progress ";
-const char* cFecDecoderMsg3of3  = "\n[3 of 3] Writing to brute in progress ";
+// Constantes messages BancFec =================================================
+
+const char* cFecBenchmarkLogFile = BENFEC ".log";
+const char* cFecBenchmarkDest    = BENFEC ".json";
+
+const char* cFecBenchmarkMsgTitle =
+  "\nDemo " BENFEC " by David Fischer!\n\n";
+
+const char* cFecBenchmarkMsgSyntax =
+  "Please, call this program with those arguments (3 variants):\n\n";
+
+const char* cFecBenchmarkMsgAboutLFunction =
+  "  Generate in memory (without any file) a SMPTE 2022-1 stream with its\n"
+  "  payloads for each point of a grid of FEC profiles (L, D), payload\n"
+  "  sizes and loss rates, protect it, lose some packets and decode it\n"
+  "  with david's algorithm. Each point give the sustained throughput, the\n"
+  "  time spent per media / FEC packet and the peak memory (JSON file).\n"
+  "  Every ingest call is timed with the cycle counter : percentiles by call\n"
+  "  type and by recovery cascade length, and the slowest calls with the\n"
+  "  decoder state (cross, waits, maxC, maxW) when they happened.\n"
+  "  The decoder memory is accounted by structure (slot table, media\n"
+  "  blocks, crosses, wait nodes, waits, resXor) : peaks of each point and\n"
+  "  their sum over the grid (all profiles decoded at once).\n\n";
+
+const char* cFecBenchmarkMsgHelp =
+  BENFEC ".exe (vv(v) auto counters) about : about text and exit\n"
+  BENFEC ".exe (vv(v) auto counters) help  : this text and exit\n"
+  BENFEC ".exe (vv(v) auto counters) L=(list) D=(list) ... p=(list) ... *\n"
+  "* missing options are setted to default, a list is 'v1,v2,...'\n\n"
+  "vv:     verbose level 1 if present\n"
+  "vvv:    verbose level 2 if present\n"
+  "auto:   console don't wait for a key press if this option is present\n"
+  "counters: read the performance counters (perf_event_open) of the\n"
+  "        decoding loop : cycles, instructions, L1D / LLC / branch misses\n"
+  "        (the calls are then not timed one by one, no latency is reported)\n"
+  "dest:   name of the destination (JSON) file\n\n"
+  "l       [5]       list of L parameters of the FEC matrix\n"
+  "d       [5]       list of D parameters of the FEC matrix\n"
+  "matrix  [2]       list of types of FEC, 1=1D 2=2D\n"
+  "lrecov  [1316]    list of payload sizes (bytes) of the media packets\n"
+  "p       [0.001]   list of probabilities (maximum is 1) of a loss burst\n"
+  "q       [2]       mean length (in packets) of a loss burst\n"
+  "packets [1000000] number of media packets generated by point\n"
+  "window  [0]       media packets in buffer before reading (0=2*L*D)\n"
+  "seed    [1]       seed of the random generator (same seed = same losses)\n";
+
+const char* cFecBenchmarkMsg1of1 = "[1 of 1] Work in progress... ";
+
+const char* cFecSoakLogFile = SOAFEC ".log";
+const char* cFecSoakDest    = SOAFEC ".csv";
+
+const char* cFecSoakMsgTitle =
+  "\nDemo " SOAFEC " by David Fischer!\n\n";
+
+const char* cFecSoakMsgSyntax =
+  "Please, call this program with those arguments (3 variants):\n\n";
+
+const char* cFecSoakMsgAboutLFunction =
+  "  Push in accelerated time (as fast as possible, in memory) hours of a\n"
+  "  SMPTE 2022-1 stream at a given bitrate through david's algorithm, with\n"
+  "  a Gilbert-Elliott channel. The resident memory, buffer counts (media,\n"
+  "  cross, waits, recycled waits), the height of the wait trees and the\n"
+  "  ingest call latency are sampled at regular stream time intervals (CSV\n"
+  "  file). The program fails (exit code 1) if a serie grows monotonically\n"
+  "  (sequence numbers wrap, waits that never expire, leaks, ...).\n\n";
+
+const char* cFecSoakMsgHelp =
+  SOAFEC ".exe (vv(v) auto dryrun) about : about text and exit\n"
+  SOAFEC ".exe (vv(v) auto dryrun) help  : this text and exit\n"
+  SOAFEC ".exe (vv(v) auto dryrun) hours=24 rate=20 ... *\n"
+  "* missing options are setted to default\n\n"
+  "vv:       verbose level 1 if present (log every sample)\n"
+  "vvv:      verbose level 2 if present\n"
+  "auto:     console don't wait for a key press if this option is present\n"
+  "dryrun:   metadata only, packets without payload (faster)\n"
+  "dest:     name of the destination (CSV) file\n\n"
+  "l         [5]     L parameter of the FEC matrix\n"
+  "d         [5]     D parameter of the FEC matrix\n"
+  "matrix    [2]     type of FEC, 1=1D 2=2D\n"
+  "lrecov    [1316]  payload size (bytes) of the media packets\n"
+  "p         [0.001] probability (maximum is 1) of a loss burst\n"
+  "q         [2]     mean length (in packets) of a loss burst\n"
+  "hours     [24]    stream time to simulate (hours)\n"
+  "rate      [20]    bitrate of the stream (Mb/s of payload)\n"
+  "interval  [15]    sampling period (minutes of stream time)\n"
+  "tolerance [10]    growth (%) of a serie tolerated between first and last\n"
+  "                  quarter of the run\n"
+  "seed      [1]     seed of the random generator (same seed = same losses)\n";
+
+const char* cFecSoakMsg1of1 = "[1 of 1] Work in progress... ";
+
+const char* cFecSoakMsgGrowth =
+  "\n%u serie(s) grow monotonically, see " SOAFEC ".log\n";
 
 // Constantes messages d'exception =============================================
 
@@ -388,3 +611,8 @@ const char* cExMatrixLD  = "LD must be equal to L*D";
 const char* cExMatrixMin = "Must be greater or equal to 1, that's logic";
 const char* cExMatrixMax = "Must be smaller, that's sChampBit fault";
 const char* cExMatrixGap = "Gap must be smaller than D";
+
+const char* cExSoakRate = "Rate and interval must be greater than 0";
+
+const char* cExMetricsThread = "Unable to start the metrics thread";
+const char* cExMetricsExport = "Unable to export metrics to %s";
@@ -50,6 +50,8 @@ extern const char* cMsgSmpteStandard;
 
 extern const char* cMsgOverwriteMediaYes;
 extern const char* cMsgOverwriteMediaNo;
+extern const char* cMsgDryRunYes;
+extern const char* cMsgDryRunNo;
 
 extern const char* cMsgDavidArPaFecPresent;
 extern const char* cMsgDavidArPaFecMissing;
@@ -65,6 +67,15 @@ extern const char* cMsgPrintDavidCross;
 extern const char* cMsgPrintDavidWaitCol;
 extern const char* cMsgPrintDavidWaitRow;
 
+extern const char* cMsgPrintMatrix;
+extern const char* cMsgPrintMatrixMedia;
+extern const char* cMsgPrintMatrixGenerique;
+
+extern const char* cMsgPrintCol;
+extern const char* cMsgPrintColMedia;
+
+extern const char* cMsgPrintChrono;
+extern const char* cMsgPrintMemoire;
 extern const char* cMsgPrintBrute;
 extern const char* cMsgPrintBruteMedia;
 extern const char* cMsgPrintBruteFec;
@@ -79,6 +90,7 @@ extern const char* cLabelDest;
 extern const char* cLabelDestRaw;
 extern const char* cLabelDestDavid;
 extern const char* cLabelDestBrute;
+extern const char* cLabelDestMatrix;
 extern const char* cLabelLrecov;
 extern const char* cLabel2DMatrix;
 extern const char* cLabelMedia0;
@@ -93,6 +105,24 @@ extern const char* cLabelReorderVar;
 extern const char* cLabelReorderProb;
 extern const char* cLabelWindow;
 extern const char* cLabelFBrute;
+extern const char* cLabelMatrices1D;
+extern const char* cLabelDryRun;
+extern const char* cLabelPackets;
+extern const char* cLabelThreads;
+extern const char* cLabelSeed;
+extern const char* cLabelPeriod;
+extern const char* cLabelDelayMedia;
+extern const char* cLabelJitterMedia;
+extern const char* cLabelDelayCol;
+extern const char* cLabelJitterCol;
+extern const char* cLabelDelayRow;
+extern const char* cLabelJitterRow;
+extern const char* cLabelHours;
+extern const char* cLabelRate;
+extern const char* cLabelInterval;
+extern const char* cLabelTolerance;
+extern const char* cLabelCounters;
+extern const char* cLabelMetrics;
 
 extern const char* cMsgAboutTGoal;
 extern const char* cMsgAboutLGoal;
@@ -114,14 +144,13 @@ extern const char* cErrorsGeneratorMsgTitle;
 extern const char* cErrorsGeneratorMsgSyntax;
 extern const char* cErrorsGeneratorMsgAboutLFunction;
 extern const char* cErrorsGeneratorMsgHelp;
-extern const char* cErrorsGeneratorMsg1of3;
-extern const char* cErrorsGeneratorMsg2of3;
-extern const char* cErrorsGeneratorMsg3of3;
+extern const char* cErrorsGeneratorMsg1of1;
 
 extern const char* cFecDecoderLogFile;
 extern const char* cFecDecoderDestSuffixeRaw;
 extern const char* cFecDecoderDestSuffixeDavid;
 extern const char* cFecDecoderDestSuffixeBrute;
+extern const char* cFecDecoderDestSuffixeMatrix;
 extern const char* cFecDecoderMsgTitle;
 extern const char* cFecDecoderMsgSyntax;
 extern const char* cFecDecoderMsgAboutLFunction;
@@ -129,6 +158,32 @@ extern const char* cFecDecoderMsgHelp;
 extern const char* cFecDecoderMsg1of3;
 extern const char* cFecDecoderMsg2of3;
 extern const char* cFecDecoderMsg3of3;
+extern const char* cFecDecoderMsgMatrix;
+
+extern const char* cFecAnalyzerLogFile;
+extern const char* cFecAnalyzerDest;
+extern const char* cFecAnalyzerMsgTitle;
+extern const char* cFecAnalyzerMsgSyntax;
+extern const char* cFecAnalyzerMsgAboutLFunction;
+extern const char* cFecAnalyzerMsgHelp;
+extern const char* cFecAnalyzerMsg1of1;
+
+extern const char* cFecBenchmarkLogFile;
+extern const char* cFecBenchmarkDest;
+extern const char* cFecBenchmarkMsgTitle;
+extern const char* cFecBenchmarkMsgSyntax;
+extern const char* cFecBenchmarkMsgAboutLFunction;
+extern const char* cFecBenchmarkMsgHelp;
+extern const char* cFecBenchmarkMsg1of1;
+
+extern const char* cFecSoakLogFile;
+extern const char* cFecSoakDest;
+extern const char* cFecSoakMsgTitle;
+extern const char* cFecSoakMsgSyntax;
+extern const char* cFecSoakMsgAboutLFunction;
+extern const char* cFecSoakMsgHelp;
+extern const char* cFecSoakMsg1of1;
+extern const char* cFecSoakMsgGrowth;
 
 extern const char* cExByeBye;
 extern const char* cExUndefined;
@@ -176,4 +231,9 @@ extern const char* cExMatrixLD;
 extern const char* cExMatrixMin;
 extern const char* cExMatrixMax;
 extern const char* cExMatrixGap;
+
+extern const char* cExSoakRate;
+
+extern const char* cExMetricsThread;
+extern const char* cExMetricsExport;
 #endif
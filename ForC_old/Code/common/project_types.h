@@ -34,17 +34,30 @@
 #include "../data_structs/sLinkedList.h"
 #include "../data_structs/sRbTree.h"
 
+#include "../utilities/sAlea.h"
 #include "../utilities/sTewfiq.h"
+#include "../utilities/sInstant.h"
+#include "../utilities/sHisto.h"
+#include "../utilities/sCompteurs.h"
+#include "../utilities/sChrono.h"
+#include "../utilities/sMetriques.h"
+#include "../utilities/sMemoire.h"
+#include "../utilities/sGrille.h"
 
 #include "../algo_structs/sSeqNx.h"
-#include "../algo_structs/sCrossFec.h"
 #include "../algo_structs/sPaquetFec.h"
+#include "../algo_structs/sCrossFec.h"
 #include "../algo_structs/sWaitFec.h"
 #include "../algo_structs/sPaquetMedia.h"
-#include "../algo_structs/sBufferFec.h"
 #include "../algo_structs/sBufferMedia.h"
+#include "../algo_structs/sBufferFec.h"
+
+#include "../utilities/sGenerateur.h"
 
 #include "../algorithmes/sBruteSmpte.h"
 #include "../algorithmes/sDavidSmpte.h"
+#include "../algorithmes/sColSmpte.h"
+#include "../algorithmes/sMatrixSmpte.h"
+#include "../algorithmes/sOracleSmpte.h"
 
 #endif
@@ -30,20 +30,16 @@
 
 // " Types de données " (mimétique des types définis par VLC) ==================
 
+// Les entiers de taille fixe (uint8_t ... int64_t, UINT8_MAX ...) sont ceux
+// de <stdint.h> : uint32_t doit faire 32 bits, y compris sur Linux 64 bits !
+#include <stdint.h>
+
 #define false     0
 #define true      1
 #define bool      unsigned char
-#define uint8_t   unsigned char
-#define uint16_t  unsigned short
-#define uint32_t  unsigned long
-#define uint64_t  unsigned long long
-#define int32_t   long
-#define int64_t   long long
-
-#define UINT8_MAX   0xFF
-#define UINT16_MAX  0xFFFF
-#define UINT32_MAX  0xFFFFFFFF
+
 #define UINT32_BITS 32
+#define UINT64_BITS 64
 
 #define TICKS_TO_MS (CLOCKS_PER_SEC/1000)
 
@@ -27,8 +27,79 @@
 
 #include "../smpte.h"
 
+#if defined (__GNUC__) && defined (__x86_64__)
+  #include <x86intrin.h>
+  #define CHAMP_X86_64
+#endif
+
+// Fonctions privées ===========================================================
+
+// Addition de deux mots avec retenue entrante et sortante (adc) ---------------
+//> Retenue sortante (0 ou 1)
+static inline uint8_t sChampBits_AddCarry
+  (uint8_t   pRetenue, //: Retenue entrante (0 ou 1)
+   uint64_t  pV1,      //: Mot à additionner
+   uint64_t  pV2,      //: Mot à additionner
+   uint64_t* pSomme)   //: Résultat (pV1 + pV2 + pRetenue)
+{
+#ifdef CHAMP_X86_64
+  return _addcarry_u64 (pRetenue, pV1, pV2, (unsigned long long*)pSomme);
+#else
+  uint64_t v3 = pV1 + pV2;
+  *pSomme = v3 + pRetenue;
+  return (v3 < pV1) | (*pSomme < v3);
+#endif
+}
+
+// pdep n'est utilisé que si le processeur l'exécute en câblé (choix au
+// chargement) : les AMD antérieurs à Zen 3 le micro-codent (~250 cycles)
+#ifdef CHAMP_X86_64
+static bool champPdep = false; //. Vrai si pdep est disponible et rapide
+
+// Choix du Select au chargement de la bibliothèque ----------------------------
+static void __attribute__ ((constructor)) sChampBits_Dispatch()
+{
+  __builtin_cpu_init();
+  champPdep = __builtin_cpu_supports ("bmi2")  &&
+             !__builtin_cpu_is       ("amdfam15h") &&
+             !__builtin_cpu_is       ("amdfam17h");
+}
+
+// pdep dépose le bit 1<<(X-1) sur le Xème bit à 1 du mot ----------------------
+static unsigned __attribute__ ((target ("bmi2"), noinline)) sChampBits_Pdep
+  (uint64_t pMot, //: Mot à traiter
+   unsigned pNo)  //: Numéro (Xème) du bit à trouver
+{
+  return __builtin_ctzll (_pdep_u64 (1ULL << (pNo-1), pMot));
+}
+#endif
+
+// Retourne la position du Xème bit à 1 d'un mot (LSB->MSB, X >= 1) ------------
+//> Position du bit (le mot doit contenir au moins X bits à 1)
+static inline unsigned sChampBits_Select
+  (uint64_t pMot, //: Mot à traiter
+   unsigned pNo)  //: Numéro (Xème) du bit à trouver
+{
+#ifdef CHAMP_X86_64
+  if (champPdep) return sChampBits_Pdep (pMot, pNo);
+#endif
+  while (--pNo > 0) pMot &= pMot - 1; // Efface les bits à 1 de poids faible
+  return __builtin_ctzll (pMot);
+}
+
 // Fonctions publiques =========================================================
 
+// Indique si sChampBits_GetOne utilise pdep (BMI2 rapide détecté) -------------
+//> Vrai si pdep est utilisé
+bool sChampBits_IsPdep()
+{
+#ifdef CHAMP_X86_64
+  return champPdep;
+#else
+  return false;
+#endif
+}
+
 // Création d'un nouveau champ de bits -----------------------------------------
 //> Nouveau champ de bits (initialisé à 0)
 sChampBits sChampBits_New()
@@ -55,7 +126,7 @@ void sChampBits_Print
   {
     if (pChamp->buffer[no] > 0) ok = true;
 
-    if (ok) { PRINT1 ("%08lX ", pChamp->buffer[no]) }
+    if (ok) { PRINT1 ("%016llX ", (unsigned long long)pChamp->buffer[no]) }
   }
 
   PRINT1 ("} ")
@@ -70,9 +141,9 @@ bool sChampBits_GetBit
   ASSERTpc (pChamp, false, cExNullPtr)
 
   uint8_t no  = pNo / CHAMP_TAILLE_UNITE;
-  uint8_t bit = pNo - no * CHAMP_TAILLE_UNITE;
+  uint8_t bit = pNo % CHAMP_TAILLE_UNITE;
 
-  return (pChamp->buffer[no] & (1 << bit)) > 0;
+  return (pChamp->buffer[no] >> bit) & 1;
 }
 
 // Changer l'état d'un des bits du champ de bits -------------------------------
@@ -83,16 +154,17 @@ void sChampBits_SetBit
 {
   ASSERTpc (pChamp,, cExNullPtr)
 
-  uint8_t  no  = pNo      / CHAMP_TAILLE_UNITE;
-  uint8_t  bit = pNo - no * CHAMP_TAILLE_UNITE;
-  uint32_t val = pChamp->buffer[no];
+  uint8_t  no  = pNo / CHAMP_TAILLE_UNITE;
+  uint8_t  bit = pNo % CHAMP_TAILLE_UNITE;
+  uint64_t val = pChamp->buffer[no];
 
-  pChamp->buffer[no] = pValeur ? val |  (1 << bit) : // Or bit à 1
-                                 val & ~(1 << bit);  // And not bit à 1
+  pChamp->buffer[no] = pValeur ? val |  (1ULL << bit) : // Or bit à 1
+                                 val & ~(1ULL << bit);  // And not bit à 1
 }
 
 // Retourne le numéro du Xème bit à 1 (en effectuant la recherche du MSB au ----
-// LSB et du LSB au MSB si pDirection=LSB_FIRST)                            ----
+// LSB et du LSB au MSB si pDirection=LSB_FIRST). Les mots qui ne contiennent --
+// pas le bit recherché sont sautés d'un coup grâce à popcount              ----
 //> Position du bit à 1 ou -1 si non trouvé
 signed sChampBits_GetOne
   (const sChampBits* pChamp,     //: Champ à traiter
@@ -102,36 +174,38 @@ signed sChampBits_GetOne
   ASSERTpc (pChamp,  0, cExNullPtr)
   ASSERTpc (pNo > 0, 0, cExChampBitNo)
 
-  signed no, nb, n = 0;
+  signed   no;
+  unsigned n = pNo; // Nombre de bits à 1 restant à passer (inclus le Xème)
 
   if (pDirection == LSB_FIRST)
   {
     for (no = 0; no < (signed)CHAMP_NOMBRE_UNITE; no++)
     {
-      if (pChamp->buffer[no] == 0) continue;
+      uint64_t _mot   = pChamp->buffer[no];
+      unsigned _count = __builtin_popcountll (_mot);
 
-      for (nb = 0; nb < (signed)CHAMP_TAILLE_UNITE; nb++)
+      if (n <= _count)
       {
-        if (pChamp->buffer[no] & (1 << nb))
-        {
-          if (++n == pNo) return no*CHAMP_TAILLE_UNITE+nb;
-        }
+        return no*CHAMP_TAILLE_UNITE + sChampBits_Select (_mot, n);
       }
+
+      n -= _count;
     }
   }
   else if (pDirection == MSB_FIRST)
   {
     for (no = (signed)(CHAMP_NOMBRE_UNITE-1); no >= 0; no--)
     {
-      if (pChamp->buffer[no] == 0) continue;
+      uint64_t _mot   = pChamp->buffer[no];
+      unsigned _count = __builtin_popcountll (_mot);
 
-      for (nb = (signed)(CHAMP_TAILLE_UNITE-1); nb >= 0; nb--)
+      // Le Xème depuis le MSB est le (count-X+1)ème depuis le LSB
+      if (n <= _count)
       {
-        if (pChamp->buffer[no] & (1 << nb))
-        {
-          if (++n == pNo) return no*CHAMP_TAILLE_UNITE+nb;
-        }
+        return no*CHAMP_TAILLE_UNITE + sChampBits_Select (_mot, _count-n+1);
       }
+
+      n -= _count;
     }
   }
 
@@ -148,10 +222,8 @@ void sChampBits_Incremente
 
   for (no = 0; no < CHAMP_NOMBRE_UNITE; no++)
   {
-    pChamp->buffer[no]++;
-
     // Aucune retenue
-    if (pChamp->buffer[no] > 0) break;
+    if (++pChamp->buffer[no] != 0) break;
   }
 }
 
@@ -180,6 +252,7 @@ signed sChampBits_Compare
 }
 
 // Additionne les valeurs entières non signées représentées par les champs -----
+// (chaîne d'additions avec retenue, adc sur x86-64)                       -----
 //> Champ résultat de l'addition
 sChampBits sChampBits_Add
   (const sChampBits* pChamp1, //: Champ à additionner
@@ -190,28 +263,14 @@ sChampBits sChampBits_Add
 
   sChampBits _resultat;
 
-  uint32_t _retenue = 0;
+  uint8_t _retenue = 0;
 
   unsigned no;
 
   for (no = 0; no < CHAMP_NOMBRE_UNITE; no++)
   {
-    uint32_t v1 = pChamp1->buffer[no];
-    uint32_t v2 = pChamp2->buffer[no];
-    uint32_t v3 = v1 + v2;
-
-    _resultat.buffer[no] = v3 + _retenue;
-
-    if (_retenue)
-    {
-      _retenue =
-      (v1 > CHAMP_VALEUR_MAX - v2)       ? 1 /*ret car v1+v2     > max */ :
-     ((v3 > CHAMP_VALEUR_MAX - _retenue) ? 1 /*ret car v1+v2+ret > max */ : 0);
-    }
-    else
-    {
-      _retenue = (v1 > CHAMP_VALEUR_MAX - v2) ? 1 : 0;
-    }
+    _retenue = sChampBits_AddCarry (_retenue, pChamp1->buffer[no],
+                                    pChamp2->buffer[no], &_resultat.buffer[no]);
   }
 
   return _resultat;
@@ -258,11 +317,13 @@ bool sChampBits_SelfTest
 
     for (no = 0; no < CHAMP_NOMBRE_UNITE; no++)
     {
-      if ((c1.buffer[no] << 16) != (c2.buffer[no] & 0xFFFF0000)) goto _pok;
+      uint64_t _haut = c1.buffer[no] >> (CHAMP_TAILLE_UNITE-16);
+
+      if ((c1.buffer[no] << 16) != (c2.buffer[no] & ~0xFFFFULL)) goto _pok;
 
       if (no == CHAMP_NOMBRE_UNITE-1) continue;
 
-      if ((c1.buffer[no] >> 16) != (c2.buffer[no+1] & 0x0000FFFF)) goto _pok;
+      if (_haut != (c2.buffer[no+1] & 0xFFFFULL)) goto _pok;
     }
   }
 
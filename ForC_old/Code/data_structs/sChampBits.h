@@ -33,23 +33,28 @@
 // CHAMP_NO_MAX est 255 pour un pNo uint8_t, etc ...
 
 #define CHAMP_NO_MAX        (UINT8_MAX+1)
-#define CHAMP_VALEUR_MAX    (UINT32_MAX)
-#define CHAMP_TAILLE_UNITE  (UINT32_BITS)
+#define CHAMP_VALEUR_MAX    (UINT64_MAX)
+#define CHAMP_TAILLE_UNITE  (UINT64_BITS)
 #define CHAMP_NOMBRE_UNITE  (CHAMP_NO_MAX / CHAMP_TAILLE_UNITE)
 
 // Type de paquet de FEC (colonne ou ligne) ------------------------------------
 typedef enum { LSB_FIRST = 0, MSB_FIRST = 1 } eDir;
 
-// Structure représentant un champ de bits (grand entier non signé) ------------
+// Structure représentant un champ de bits (grand entier non signé). Les -------
+// mots de 64 bits sont traités par popcount/ctz (pdep si BMI2 à l'exécution) --
 typedef struct
 {
-  uint32_t buffer[CHAMP_NOMBRE_UNITE]; //. Stockage des bits
+  uint64_t buffer[CHAMP_NOMBRE_UNITE]; //. Stockage des bits (LSB = buffer[0])
 }
   sChampBits;
 
+STATIC_ASSERT (sizeof (sChampBits) == CHAMP_NO_MAX / 8, sChampBits)
+STATIC_ASSERT (CHAMP_NOMBRE_UNITE == 4,                 sChampBitsUnites)
+
 // Déclaration des Fonctions ===================================================
 
 sChampBits sChampBits_New();
+bool       sChampBits_IsPdep();
 
 void sChampBits_Print (const sChampBits*);
 
@@ -43,16 +43,19 @@ typedef void (*sRbPrintNdFunc)(void* value);
 enum sRbColor { RED, BLACK };
 
 // Structure représentant un noeud d'un arbre rouge-noire ----------------------
+// Les pointeurs précèdent clé et couleur pour éviter le padding en 64 bits ----
 typedef struct sRbNode
 {
-  uint32_t        key;    //. Clé attribuée au noeud
   void*           value;  //. Valeur stockée par le noeud
   struct sRbNode* left;   //. Enfant de gauche (plus petit par ordre croissant)
   struct sRbNode* right;  //. Enfant de droite (plus grand par ordre croissant)
   struct sRbNode* parent; //. Parent du noeud
+  uint32_t        key;    //. Clé attribuée au noeud
   enum   sRbColor color;  //. Couleur (rouge ou noire) attribuée au noeud
 } sRbNode;
 
+STATIC_ASSERT (sizeof (sRbNode) == 4 * sizeof (void*) + 8, sRbNode)
+
 // Structure représentant un arbre rouge-noire (auto équilibré) ----------------
 typedef struct
 {
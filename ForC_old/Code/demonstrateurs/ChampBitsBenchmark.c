@@ -0,0 +1,387 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : sChampBits micro-benchmark
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Constantes de test ==========================================================
+
+// Remarque : le champ de référence (sChampRef) reprend l'implémentation
+//            historique sur mots de 32 bits (bit à bit, retenue manuelle) afin
+//            de mesurer le gain et de valider l'implémentation courante.
+
+const unsigned OPTION_VALIDATION = 100000;   //. Nb de champs aléatoires validés
+const unsigned OPTION_ITERATIONS = 10000000; //. Nb d'appels par mesure
+const unsigned OPTION_NB_CHAMPS  = 1024;     //. Nb de champs (puissance de 2)
+const unsigned OPTION_LD         = 24;       //. Limite 2^LD (parcours complet)
+
+// Types de données ============================================================
+
+// Champ de bits de référence (implémentation 32 bits historique) --------------
+typedef struct
+{
+  uint32_t buffer[CHAMP_NO_MAX / UINT32_BITS]; //. Stockage des bits
+}
+  sChampRef;
+
+STATIC_ASSERT (sizeof (sChampRef) == sizeof (sChampBits), sChampRef)
+
+#define REF_UNITES (CHAMP_NO_MAX / UINT32_BITS)
+
+// Variables Globales ==========================================================
+
+static sChampBits champs[1024]; //. Champs aléatoires (courant)
+static sChampRef  refs  [1024]; //. Les mêmes champs (référence)
+
+static volatile signed puits; //. Empêche le compilateur d'ignorer les calculs
+
+// Fonctions privées (implémentation de référence) =============================
+
+// Conversion champ courant -> champ de référence (little endian) --------------
+static sChampRef ToRef (const sChampBits* pChamp)
+{
+  sChampRef _ref;
+  unsigned  no;
+
+  for (no = 0; no < REF_UNITES; no++)
+  {
+    _ref.buffer[no] =
+      (uint32_t)(pChamp->buffer[no/2] >> ((no % 2) * UINT32_BITS));
+  }
+
+  return _ref;
+}
+
+// Xème bit à 1 testé bit après bit (ancienne version de GetOne) ---------------
+static __attribute__ ((noinline)) signed RefGetOne (const sChampRef* pChamp, uint8_t pNo, eDir pDir)
+{
+  signed no, nb, n = 0;
+
+  if (pDir == LSB_FIRST)
+  {
+    for (no = 0; no < (signed)REF_UNITES; no++)
+    {
+      if (pChamp->buffer[no] == 0) continue;
+
+      for (nb = 0; nb < (signed)UINT32_BITS; nb++)
+      {
+        if (pChamp->buffer[no] & (1u << nb))
+        {
+          if (++n == pNo) return no*UINT32_BITS+nb;
+        }
+      }
+    }
+  }
+  else
+  {
+    for (no = (signed)(REF_UNITES-1); no >= 0; no--)
+    {
+      if (pChamp->buffer[no] == 0) continue;
+
+      for (nb = (signed)(UINT32_BITS-1); nb >= 0; nb--)
+      {
+        if (pChamp->buffer[no] & (1u << nb))
+        {
+          if (++n == pNo) return no*UINT32_BITS+nb;
+        }
+      }
+    }
+  }
+
+  return -1;
+}
+
+// Incrémentation (ancienne version) -------------------------------------------
+static __attribute__ ((noinline)) void RefIncremente (sChampRef* pChamp)
+{
+  unsigned no;
+
+  for (no = 0; no < REF_UNITES; no++)
+  {
+    pChamp->buffer[no]++;
+
+    if (pChamp->buffer[no] > 0) break;
+  }
+}
+
+// Comparaison (ancienne version) ----------------------------------------------
+static __attribute__ ((noinline)) signed RefCompare (const sChampRef* pChamp1, const sChampRef* pChamp2)
+{
+  signed no;
+
+  for (no = REF_UNITES-1; no >= 0; no--)
+  {
+    if (pChamp1->buffer[no] == pChamp2->buffer[no]) continue;
+    if (pChamp1->buffer[no] >  pChamp2->buffer[no]) return 1;
+
+    return -1;
+  }
+
+  return 0;
+}
+
+// Addition avec suivi manuel de la retenue (ancienne version) -----------------
+static __attribute__ ((noinline)) sChampRef RefAdd (const sChampRef* pChamp1, const sChampRef* pChamp2)
+{
+  sChampRef _resultat;
+
+  uint32_t _retenue = 0;
+
+  unsigned no;
+
+  for (no = 0; no < REF_UNITES; no++)
+  {
+    uint32_t v1 = pChamp1->buffer[no];
+    uint32_t v2 = pChamp2->buffer[no];
+    uint32_t v3 = v1 + v2;
+
+    _resultat.buffer[no] = v3 + _retenue;
+
+    if (_retenue)
+    {
+      _retenue =
+      (v1 > UINT32_MAX - v2)       ? 1 :
+     ((v3 > UINT32_MAX - _retenue) ? 1 : 0);
+    }
+    else
+    {
+      _retenue = (v1 > UINT32_MAX - v2) ? 1 : 0;
+    }
+  }
+
+  return _resultat;
+}
+
+// Fonctions privées (banc de test) ============================================
+
+// Génère un champ aléatoire (peu dense ou dense selon pDensite) ---------------
+static sChampBits RandomChamp (unsigned pDensite)
+{
+  sChampBits _champ = sChampBits_New();
+  unsigned   no;
+
+  for (no = 0; no < pDensite; no++)
+  {
+    sChampBits_SetBit (&_champ, (uint8_t)RAND(255), true);
+  }
+
+  // Quelques mots saturés pour éprouver la retenue
+  if (rand() % 4 == 0) _champ.buffer[rand() % CHAMP_NOMBRE_UNITE] = UINT64_MAX;
+
+  return _champ;
+}
+
+// Valide l'implémentation courante contre la référence ------------------------
+//> Toutes les opérations donnent-elles le même résultat ?
+static bool Validation()
+{
+  unsigned nb, no;
+
+  for (nb = 0; nb < OPTION_VALIDATION; nb++)
+  {
+    sChampBits a = RandomChamp (RAND(64));
+    sChampBits b = RandomChamp (RAND(64));
+    sChampRef  ra = ToRef (&a);
+    sChampRef  rb = ToRef (&b);
+
+    // GetOne : tous les rangs possibles (+1 pour le cas non trouvé)
+    for (no = 1; no < CHAMP_NO_MAX; no++)
+    {
+      signed j1 = sChampBits_GetOne (&a, no, LSB_FIRST);
+      signed j2 = sChampBits_GetOne (&a, no, MSB_FIRST);
+
+      IFNOT (j1 == RefGetOne (&ra, no, LSB_FIRST), false)
+      IFNOT (j2 == RefGetOne (&ra, no, MSB_FIRST), false)
+
+      if (j1 < 0) break;
+    }
+
+    signed c1 = sChampBits_Compare (&a, &b);
+    signed c2 = RefCompare (&ra, &rb);
+
+    IFNOT (c1 == c2, false)
+    IFNOT (sChampBits_Compare (&a, &a) == 0, false)
+
+    sChampBits s  = sChampBits_Add (&a, &b);
+    sChampRef  rs = RefAdd (&ra, &rb);
+    sChampRef  cs = ToRef (&s);
+
+    IFNOT (memcmp (&cs, &rs, sizeof (sChampRef)) == 0, false)
+
+    sChampBits_Incremente (&a);
+    RefIncremente (&ra);
+    cs = ToRef (&a);
+
+    IFNOT (memcmp (&cs, &ra, sizeof (sChampRef)) == 0, false)
+  }
+
+  return true;
+}
+
+// Affiche une mesure (ns par appel) et le gain par rapport à la référence -----
+static void PrintMesure (const char* pNom, clock_t pTicks, clock_t pRefTicks)
+{
+  double _ns    = 1e9 * pTicks    / CLOCKS_PER_SEC / OPTION_ITERATIONS;
+  double _refNs = 1e9 * pRefTicks / CLOCKS_PER_SEC / OPTION_ITERATIONS;
+
+  PRINT0 ("%-12s : %8.2f ns (ref %8.2f ns) x%.2f\n",
+          pNom, _ns, _refNs, _ns > 0 ? _refNs / _ns : 0.0)
+}
+
+// Fonctions publiques =========================================================
+
+// Affiche (et enregistre dans un fichier) le contenu des deux algorithmes -----
+void AssertPrintError()
+{
+}
+
+// Point d'entrée du programme -------------------------------------------------
+//> Code d'erreur renvoyé au système (0 = ok)
+int main()
+{
+  unsigned no, nb;
+  clock_t  _debut, _ticks, _refTicks;
+
+  PRINT0 ("\n--------------------------------\n"
+          "\nsChampBits benchmark\n\n")
+
+  PRINT0 ("BMI2 (pdep) : %s\n\n", sChampBits_IsPdep() ? "oui" : "non")
+
+  // Portes de validation (la retenue d'abord, puis contre la référence)
+
+  ASSERT (sChampBits_SelfTest (sChampBits_Add), -1, "SelfTest failed")
+  ASSERT (Validation(), -1, "Validation against reference failed")
+
+  PRINT0 ("SelfTest et validation : ok\n\n")
+
+  for (no = 0; no < OPTION_NB_CHAMPS; no++)
+  {
+    champs[no] = RandomChamp (RAND(24)); // Densité d'un champ missing typique
+    refs  [no] = ToRef (&champs[no]);
+  }
+
+  const unsigned masque = OPTION_NB_CHAMPS - 1;
+
+  // GetOne (rang 1 et 2, comme GetManque) -------------------------------------
+
+  signed _somme = 0;
+
+  _debut = clock();
+  for (nb = 0; nb < OPTION_ITERATIONS; nb++)
+  {
+    _somme += sChampBits_GetOne (&champs[nb & masque], 1 + (nb & 1),
+                                 nb & 2 ? MSB_FIRST : LSB_FIRST);
+  }
+  _ticks = clock() - _debut;
+
+  _debut = clock();
+  for (nb = 0; nb < OPTION_ITERATIONS; nb++)
+  {
+    _somme += RefGetOne (&refs[nb & masque], 1 + (nb & 1),
+                         nb & 2 ? MSB_FIRST : LSB_FIRST);
+  }
+  _refTicks = clock() - _debut;
+
+  PrintMesure ("GetOne", _ticks, _refTicks);
+
+  // Compare -------------------------------------------------------------------
+
+  _debut = clock();
+  for (nb = 0; nb < OPTION_ITERATIONS; nb++)
+  {
+    _somme += sChampBits_Compare (&champs[nb & masque],
+                                  &champs[(nb+1) & masque]);
+  }
+  _ticks = clock() - _debut;
+
+  _debut = clock();
+  for (nb = 0; nb < OPTION_ITERATIONS; nb++)
+  {
+    _somme += RefCompare (&refs[nb & masque], &refs[(nb+1) & masque]);
+  }
+  _refTicks = clock() - _debut;
+
+  PrintMesure ("Compare", _ticks, _refTicks);
+
+  // Add -----------------------------------------------------------------------
+
+  _debut = clock();
+  for (nb = 0; nb < OPTION_ITERATIONS; nb++)
+  {
+    sChampBits s = sChampBits_Add (&champs[nb & masque],
+                                   &champs[(nb+1) & masque]);
+    _somme += (signed)s.buffer[nb % CHAMP_NOMBRE_UNITE];
+  }
+  _ticks = clock() - _debut;
+
+  _debut = clock();
+  for (nb = 0; nb < OPTION_ITERATIONS; nb++)
+  {
+    sChampRef s = RefAdd (&refs[nb & masque], &refs[(nb+1) & masque]);
+    _somme += (signed)s.buffer[nb % REF_UNITES];
+  }
+  _refTicks = clock() - _debut;
+
+  PrintMesure ("Add", _ticks, _refTicks);
+
+  // Boucle interne d'OldSimulator : Incremente + Compare à 2^LD ---------------
+
+  sChampBits configNo = sChampBits_New();
+  sChampBits limiteNo = sChampBits_New();
+  sChampBits_SetBit (&limiteNo, OPTION_LD, true);
+
+  _debut = clock();
+  while (true)
+  {
+    sChampBits_Incremente (&configNo);
+    if (sChampBits_Compare (&configNo, &limiteNo) >= 0) break;
+  }
+  _ticks = clock() - _debut;
+
+  sChampRef refConfigNo;
+  sChampRef refLimiteNo = ToRef (&limiteNo);
+  memset (&refConfigNo, 0, sizeof (sChampRef));
+
+  _debut = clock();
+  while (true)
+  {
+    RefIncremente (&refConfigNo);
+    if (RefCompare (&refConfigNo, &refLimiteNo) >= 0) break;
+  }
+  _refTicks = clock() - _debut;
+
+  // Ramène la mesure au nombre d'itérations par défaut (2^LD appels)
+  _ticks    = _ticks    * (double)OPTION_ITERATIONS / (1 << OPTION_LD);
+  _refTicks = _refTicks * (double)OPTION_ITERATIONS / (1 << OPTION_LD);
+
+  PrintMesure ("Inc+Compare", _ticks, _refTicks);
+
+  puits = _somme;
+
+  PRINT0 ("\n")
+
+  return 0;
+}
@@ -29,11 +29,18 @@
 
 // Types de données ============================================================
 
-// Structure représentant un paquet soit média/FEC pour générateur erreurs -----
+// Chemins du réseau simulé, chacun avec son propre modèle de délai ------------
+typedef enum { CHEMIN_MEDIA = 0, CHEMIN_COL = 1, CHEMIN_ROW = 2 } eChemin;
+
+// Structure représentant un paquet média/FEC en attente de sortie        ------
+// Les paquets sortent dans l'ordre (cle, no) : cle = 2 * instant         ------
+// d'arrivée, +1 si retardé (passe donc après le paquet à sa place)       ------
 typedef struct
 {
-  bool  media;  //. Est-ce un paquet média (ou de FEC) ?
-  void* paquet; //. Pointeur vers le paquet
+  uint64_t cle;    //. Instant d'arrivée (x2, +1 si le paquet est retardé)
+  uint64_t no;     //. Rang d'arrivée du paquet (départage les égalités)
+  bool     media;  //. Est-ce un paquet média (ou de FEC) ?
+  void*    paquet; //. Pointeur vers le paquet
 } sPaquets;
 
 // Variables Globales ==========================================================
@@ -43,15 +50,132 @@ static char*  optionSource      = NULL;  //. Fichier source
 static char*  optionDest        = NULL;  //. Fichier destination
 static double optionTewfiqP     = 0.001; //. Prob de passer de ok à perte max 1
 static double optionTewfiqQ     = 0.500; //. Prob de passer de perte à ok max 1
-static double optionReorderVar  = 4.00;  //. Variance du reordering max ?
+static double optionReorderVar  = 4.00;  //. Longueur d'une rafale de reorder
 static double optionReorderProb = 0.1;   //. Proba. de passer à reorder max 1
+static uint64_t optionSeed      = 1;     //. Graine du générateur aléatoire
+static double optionPeriod      = 0;     //. Période d'envoi en us (0 = aucune)
+static double optionDelay  [3]  = {0};   //. Délai fixe d'un chemin en us
+static double optionJitter [3]  = {0};   //. Gigue moyenne d'un chemin en us
 
 static uint8_t detectedL = 0; //. Taille (colonne) de la matrice de FEC
 static uint8_t detectedD = 0; //. Taille (ligne)   de la matrice de FEC
 
-#define MAXP 1024*1024
-static sPaquets bufP[MAXP]; //. Tampon de paquets média et de FEC
-static unsigned numP = 0;   //. Nombre de paquets contenu par le buffer bufP
+// Fenêtre de réarrangement : tas (min) des paquets en attente de sortie, sa
+// taille est bornée par les rafales et la gigue (et non par la capture)
+static sPaquets* tasP     = NULL; //. Tas des paquets en attente de sortie
+static unsigned  tasTaille = 0;   //. Nombre de paquets contenu par le tas
+static unsigned  tasMax    = 0;   //. Capacité du tas
+
+// Fonctions privées ===========================================================
+
+// Compare l'ordre de sortie de deux paquets -----------------------------------
+//> Le paquet pA doit-il sortir avant le paquet pB ?
+static bool Avant
+  (const sPaquets* pA, //: Premier paquet
+   const sPaquets* pB) //: Second paquet
+{
+  return pA->cle < pB->cle || (pA->cle == pB->cle && pA->no < pB->no);
+}
+
+// Ajoute un paquet au tas de sortie -------------------------------------------
+//> Paquet ajouté (faux si le tas n'a pas pu grandir, il est alors intact) ?
+static bool TasAjoute
+  (sPaquets pPaquet) //: Paquet à ajouter
+{
+  // La gigue n'est pas bornée : le tas grandit au besoin
+  if (tasTaille == tasMax)
+  {
+    unsigned  _max = tasMax > 0 ? 2 * tasMax : 64;
+    sPaquets* _tas = realloc (tasP, _max * sizeof (sPaquets));
+    IFNOT (_tas, false)
+
+    tasP   = _tas;
+    tasMax = _max;
+  }
+
+  unsigned no = tasTaille++;
+
+  while (no > 0)
+  {
+    unsigned parent = (no - 1) / 2;
+
+    if (!Avant (&pPaquet, &tasP[parent])) break;
+
+    tasP[no] = tasP[parent];
+    no = parent;
+  }
+
+  tasP[no] = pPaquet;
+
+  return true;
+}
+
+// Retire du tas le prochain paquet à sortir -----------------------------------
+//> Paquet retiré (le tas ne doit pas être vide)
+static sPaquets TasRetire()
+{
+  sPaquets _premier = tasP[0];
+  sPaquets _dernier = tasP[--tasTaille];
+
+  unsigned no = 0;
+
+  while (true)
+  {
+    unsigned fils = 2 * no + 1;
+
+    if (fils >= tasTaille) break;
+    if (fils + 1 < tasTaille && Avant (&tasP[fils+1], &tasP[fils])) fils++;
+    if (!Avant (&tasP[fils], &_dernier)) break;
+
+    tasP[no] = tasP[fils];
+    no = fils;
+  }
+
+  if (tasTaille > 0) tasP[no] = _dernier;
+
+  return _premier;
+}
+
+// Enregistre (et libère) les paquets du tas dont la clé est avant pCle --------
+static void TasSortie
+  (uint64_t pCle,  //: Clé (exclue) jusqu'à laquelle les paquets sortent
+   FILE*    pDest) //: Fichier destination
+{
+  while (tasTaille > 0 && tasP[0].cle < pCle)
+  {
+    sPaquets _sortie = TasRetire();
+
+    // L'instant d'arrivée précède le paquet (modèle de délais seulement)
+    if (optionPeriod > 0) sInstant_ToFile (_sortie.cle / 2, pDest);
+
+    if (_sortie.media)
+    {
+      sPaquetMedia_ToFile  (_sortie.paquet, pDest, true);
+      sPaquetMedia_Release (_sortie.paquet);
+    }
+    else
+    {
+      sPaquetFec_ToFile  (_sortie.paquet, pDest);
+      sPaquetFec_Release (_sortie.paquet);
+    }
+  }
+}
+
+// Tire le délai d'un paquet sur son chemin (délai fixe + gigue exponentielle) -
+//> Délai en ns
+static uint64_t Delai
+  (sAlea*  pAlea,   //: Générateur aléatoire des délais
+   eChemin pChemin) //: Chemin emprunté par le paquet
+{
+  double _us = optionDelay[pChemin];
+
+  if (optionJitter[pChemin] > 0)
+  {
+    _us += optionJitter[pChemin] * sAlea_Exp (pAlea);
+  }
+
+  return (uint64_t)(_us * 1000.0 + 0.5);
+}
 
 // Fonctions publiques =========================================================
 
@@ -66,8 +190,6 @@ int main (int argc, char ** argv)
 {
   PRINT_INIT_COLOR()
 
-  unsigned no;
-
   // Affiche le titre du logiciel
   PRINT0_CONc (cConDefault, cErrorsGeneratorMsgTitle)
 
@@ -147,6 +269,38 @@ int main (int argc, char ** argv)
 
         optionReorderProb = r;
       }
+      else if ((value = GetParameterValue (arg, cLabelSeed, '=')) != 0)
+      {
+        optionSeed = strtoull (value, NULL, 10);
+      }
+      else if ((value = GetParameterValue (arg, cLabelPeriod, '=')) != 0)
+      {
+        optionPeriod = fabs (strtod (value, NULL));
+      }
+      else if ((value = GetParameterValue (arg, cLabelDelayMedia, '=')) != 0)
+      {
+        optionDelay [CHEMIN_MEDIA] = fabs (strtod (value, NULL));
+      }
+      else if ((value = GetParameterValue (arg, cLabelJitterMedia, '=')) != 0)
+      {
+        optionJitter[CHEMIN_MEDIA] = fabs (strtod (value, NULL));
+      }
+      else if ((value = GetParameterValue (arg, cLabelDelayCol, '=')) != 0)
+      {
+        optionDelay [CHEMIN_COL] = fabs (strtod (value, NULL));
+      }
+      else if ((value = GetParameterValue (arg, cLabelJitterCol, '=')) != 0)
+      {
+        optionJitter[CHEMIN_COL] = fabs (strtod (value, NULL));
+      }
+      else if ((value = GetParameterValue (arg, cLabelDelayRow, '=')) != 0)
+      {
+        optionDelay [CHEMIN_ROW] = fabs (strtod (value, NULL));
+      }
+      else if ((value = GetParameterValue (arg, cLabelJitterRow, '=')) != 0)
+      {
+        optionJitter[CHEMIN_ROW] = fabs (strtod (value, NULL));
+      }
       else // Un paramètre incorrect
       {
         goto __params_error;
@@ -165,8 +319,13 @@ int main (int argc, char ** argv)
   }
 
   PRINT0_FILE (cErrorsGeneratorLogFile, "w",
-              "P:%g, Q:%g var:%g prob:%g\n\n",
-              optionTewfiqP, optionTewfiqQ, optionReorderVar, optionReorderProb)
+              "P:%g, Q:%g var:%g prob:%g seed:%llu period:%gus "
+              "media:%g+%gus col:%g+%gus row:%g+%gus\n\n",
+              optionTewfiqP, optionTewfiqQ, optionReorderVar, optionReorderProb,
+              (unsigned long long)optionSeed, optionPeriod,
+              optionDelay[CHEMIN_MEDIA], optionJitter[CHEMIN_MEDIA],
+              optionDelay[CHEMIN_COL],   optionJitter[CHEMIN_COL],
+              optionDelay[CHEMIN_ROW],   optionJitter[CHEMIN_ROW])
 
   // ===========================================================================
 
@@ -191,32 +350,57 @@ int main (int argc, char ** argv)
   // Barre de pourcentage
   double oldPcent = 0, newPcent = 0;
 
-  // Initialise Tewfiq !
-  sTewfiq _tewfiqPerte   = sTewfiq_New2 (optionTewfiqP, optionTewfiqQ);
-  sTewfiq _tewfiqReorder = sTewfiq_New2 (optionReorderProb, 1);
+  // Initialise Tewfiq ! (un générateur par canal, même graine = même fichier)
+  sTewfiq _tewfiqPerte   =
+    sTewfiq_New3 (optionTewfiqP, optionTewfiqQ, optionSeed);
+  sTewfiq _tewfiqReorder =
+    sTewfiq_New3 (optionReorderProb, 1, optionSeed + 1);
+
+  // Une rafale de réarrangement retarde dist paquets derrière les dist suivants
+  unsigned dist = (unsigned)(optionReorderVar + 0.5);
+  if (optionReorderProb <= 0) dist = 0;
+
+  // Modèle de délais : instants en ns, sinon en positions (délais nuls)
+  sAlea    _aleaDelai = sAlea_New (optionSeed + 2);
+  uint64_t pas        = optionPeriod > 0 ? optionPeriod * 1000.0 + 0.5 : 1;
+  uint64_t delaiMin   = UINT64_MAX;
+
+  eChemin chemin;
+  for (chemin = CHEMIN_MEDIA; chemin <= CHEMIN_ROW; chemin++)
+  {
+    if (optionPeriod <= 0)
+    {
+      optionDelay[chemin] = optionJitter[chemin] = 0;
+    }
+
+    uint64_t _delai = optionDelay[chemin] * 1000.0 + 0.5;
+    if (_delai < delaiMin) delaiMin = _delai;
+  }
 
   // BOUCLE DE CONVERSION DU FICHIER RTP+FEC -> FICHIER RTP+FEC+ERREURS ========
 
-  PRINT0_CONc    (cConDefault, cErrorsGeneratorMsg1of3)
+  PRINT0_CONc    (cConDefault, cErrorsGeneratorMsg1of1)
   PRINT_SET_FILE (cErrorsGeneratorLogFile, "a")
 
   bool     eof = false;
   unsigned mediaNb = 0;
 
+  uint64_t numP   = 0; //. Nombre de paquets envoyés (position d'envoi)
+  uint64_t rafale = 0; //. Position de sortie de la rafale de reorder en cours
+  unsigned reste  = 0; //. Nombre de paquets encore à retarder dans la rafale
+
   while (!eof)
   {
-    ASSERT (numP < MAXP, -1, "oups...")
-    IFNOT  (numP < MAXP, -1)
+    sPaquets _paquet;
 
     // LECTURE D'UN PAQUET MÉDIA ===============================================
 
     bool keep = sTewfiq_IsOkayOrLost (&_tewfiqPerte);
 
-    if ((bufP[numP].paquet = sPaquetMedia_FromFile (source)) != 0)
+    if ((_paquet.paquet = sPaquetMedia_FromFile (source, true)) != 0)
     {
-      bufP[numP].media = true;
-
-      //sPaquetMedia* _media = bufP[numP].paquet;
+      _paquet.media = true;
+      chemin        = CHEMIN_MEDIA;
 
       if (detectedL != 0 && detectedD != 0)
       {
@@ -229,19 +413,20 @@ int main (int argc, char ** argv)
       if (!keep)
       {
         PRINT0c (cMsgMedPok)
-        sPaquetMedia_Release (bufP[numP].paquet);
+        sPaquetMedia_Release (_paquet.paquet);
       }
       else
       {
         PRINT0c (cMsgMedOk)
-        numP++;
       }
     }
-    else if ((bufP[numP].paquet = sPaquetFec_FromFile (source)) != 0)
+    else if ((_paquet.paquet = sPaquetFec_FromFile (source, true)) != 0)
     {
-      bufP[numP].media = false;
+      _paquet.media = false;
+
+      sPaquetFec* _fec = _paquet.paquet;
 
-      sPaquetFec* _fec = bufP[numP].paquet;
+      chemin = _fec->DWORD3.D == COL ? CHEMIN_COL : CHEMIN_ROW;
 
       if (_fec->DWORD3.D == COL)
       {
@@ -257,12 +442,11 @@ int main (int argc, char ** argv)
       if (!keep)
       {
         PRINT0c (_fec->DWORD3.D == COL ? cMsgColPok : cMsgRowPok)
-        sPaquetFec_Release (bufP[numP].paquet);
+        sPaquetFec_Release (_paquet.paquet);
       }
       else
       {
         PRINT0c (_fec->DWORD3.D == COL ? cMsgColOk : cMsgRowOk)
-        numP++;
       }
     }
     else
@@ -270,69 +454,47 @@ int main (int argc, char ** argv)
       eof = true;
     }
 
-    // Met à jour la barre de pourcentage
-    sourcePos = ftell (source);
-    PCENT ((double)sourcePos / (double)sourceSize, eof, cErrorsGeneratorLogFile)
-  }
-
-  // PASSE DE RÉARRANGEMENT ====================================================
-
-  PRINT0_CONc    (cConDefault, cErrorsGeneratorMsg2of3)
-  PRINT_SET_FILE (cErrorsGeneratorLogFile, "a")
-
-  if (optionReorderProb > 0)
-  {
-    oldPcent = 0;
-
-    unsigned dist = 4;
+    // RÉARRANGEMENT ET SORTIE DES PAQUETS =====================================
 
-    for (no = 0; no < numP; no++)
+    if (!eof && keep)
     {
-      // Réarrangement ?
-      if (!sTewfiq_IsOkayOrLost (&_tewfiqReorder))
+      // Début d'une rafale : ce paquet et les dist-1 suivants sortiront
+      // après les dist paquets qui les suivent
+      if (reste == 0 && dist > 0 && !sTewfiq_IsOkayOrLost (&_tewfiqReorder))
       {
-        if (no + 2 * dist - 1 < numP)
-        {
-          sPaquets tmp[4];
-          memcpy (tmp,         &bufP[no],   4 * sizeof (sPaquets));
-          memcpy (&bufP[no],   &bufP[no+4], 4 * sizeof (sPaquets));
-          memcpy (&bufP[no+4], tmp,         4 * sizeof (sPaquets));
-        }
+        rafale = numP + 2 * dist - 1;
+        reste  = dist;
       }
 
-      // Met à jour la barre de pourcentage
-      PCENT ((double)(no+1) / (double)numP, no == numP-1,
-             cErrorsGeneratorLogFile)
-    }
-  }
-
-  // PASSE D'ENREGISTREMENT DES PAQUETS ========================================
+      uint64_t _arrivee = (reste > 0 ? rafale : numP) * pas +
+                          Delai (&_aleaDelai, chemin);
 
-  PRINT0_CONc    (cConDefault, cErrorsGeneratorMsg3of3)
-  PRINT_SET_FILE (cErrorsGeneratorLogFile, "a")
+      _paquet.no  = numP;
+      _paquet.cle = 2 * _arrivee + (reste > 0);
 
-  oldPcent = 0;
+      if (reste > 0) reste--;
 
-  for (no = 0; no < numP; no++)
-  {
-    if (bufP[no].media)
-    {
-      sPaquetMedia* media = bufP[no].paquet;
-      sPaquetMedia_ToFile  (media, dest, true);
-      sPaquetMedia_Release (media);
+      bool ok = TasAjoute (_paquet);
+      ASSERTc (ok, -1, cExAllocateMemory)
     }
-    else
+
+    if (!eof)
     {
-      sPaquetFec* fec = bufP[no].paquet;
-      sPaquetFec_ToFile  (fec, dest);
-      sPaquetFec_Release (fec);
+      numP++;
+
+      // Les paquets suivants arriveront au plus tôt à numP * pas + delaiMin
+      TasSortie (2 * (numP * pas + delaiMin), dest);
     }
 
     // Met à jour la barre de pourcentage
-    PCENT ((double)(no+1) / (double)numP, no == numP-1,
-           cErrorsGeneratorLogFile)
+    sourcePos = ftell (source);
+    PCENT ((double)sourcePos / (double)sourceSize, eof, cErrorsGeneratorLogFile)
   }
 
+  // Vide la fenêtre (rafale tronquée par la fin du fichier)
+  TasSortie (UINT64_MAX, dest);
+  free (tasP);
+
   fclose (source);
   fclose (dest);
 
@@ -0,0 +1,490 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : In-memory Monte Carlo analyzer of FEC profiles
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+#include <pthread.h>
+
+// Constantes ==================================================================
+
+#define RAFALE_MAX   16  //. Rafales de 1 à RAFALE_MAX-1 paquets puis au-delà
+#define OUVRIERS_MAX 256 //. Nombre maximum d'ouvriers (threads)
+
+// Types de données ============================================================
+
+// Un point de la grille : profil de FEC, canal et résultats de l'analyse ------
+typedef struct
+{
+  uint8_t L;        //. Taille (colonne) de la matrice de FEC
+  uint8_t D;        //. Taille (ligne)   de la matrice de FEC
+  bool    matrix2D; //. FEC ligne en plus des FEC colonne ?
+  double  p;        //. Probabilité de passer de ok à perte
+  double  q;        //. Longueur moyenne d'une rafale de pertes (paquets)
+
+  unsigned long long media;     //. Paquets média émis
+  unsigned long long pertes;    //. Paquets média perdus (avant FEC)
+  unsigned long long fecPertes; //. Paquets de FEC perdus
+  unsigned long long residuel;  //. Paquets média manquants à la lecture
+  unsigned long long recup;     //. Paquets média récupérés
+
+  unsigned long long  rafales[RAFALE_MAX]; //. [n-1] Rafales résiduelles de n
+  unsigned            rafaleMax;           //. Plus longue rafale résiduelle
+  unsigned long long* profondeur; //. [n] Récupérés n paquets après leur no
+  unsigned            window;     //. Paquets média gardés avant lecture
+  double              duree;      //. Durée de l'analyse du point (s)
+}
+  sPoint;
+
+// Variables Globales ==========================================================
+
+static bool     optionAutoKey = false;   //. Automatiquement valider les msgs ?
+static char*    optionDest    = NULL;    //. Fichier destination (CSV)
+static unsigned optionPackets = 1000000; //. Paquets média simulés par point
+static sMediaNo optionWindow  = 0;       //. Nb de media stockés (0 = 2*L*D)
+static unsigned optionThreads = 0;       //. Nb d'ouvriers (0 = nb processeurs)
+static uint64_t optionSeed    = 1;       //. Graine du générateur aléatoire
+
+static sGrille  grille; //. Listes des valeurs de L, D, matrice, p et q
+static unsigned axeL, axeD, axeM, axeP, axeQ; //. Axes de la grille
+
+static sPoint*  point   = NULL; //. Points de la grille (L, D, matrice, p, q)
+static unsigned nbPoint = 0;    //. Nombre de points de la grille
+
+static pthread_mutex_t pointMutex = PTHREAD_MUTEX_INITIALIZER;
+static unsigned        pointNo    = 0; //. Prochain point à analyser
+
+// Fonctions privées ===========================================================
+
+// Comptabilise une rafale de paquets manquants à la lecture (si pN > 0) -------
+static void Rafale
+  (sPoint*  pPoint, //: Point analysé
+   unsigned pN)     //: Longueur de la rafale
+{
+  if (pN == 0) return;
+
+  pPoint->rafales[(pN < RAFALE_MAX ? pN : RAFALE_MAX) - 1]++;
+  pPoint->rafaleMax = pN > pPoint->rafaleMax ? pN : pPoint->rafaleMax;
+}
+
+// Lit les paquets média au-delà de pWindow et comptabilise les rafales de -----
+// paquets manquants à la lecture (pertes résiduelles)                     -----
+//> Nombre de paquets média lus
+static unsigned Lecture
+  (sPoint*      pPoint,  //: Point analysé
+   sDavidSmpte* pDavid,  //: Algorithme à vider
+   sMediaNo     pWindow, //: Nombre de paquets média à garder
+   unsigned*    pRafale) //: Longueur de la rafale résiduelle en cours
+{
+  unsigned _lus = 0;
+
+  while (true)
+  {
+    unsigned _avant = pDavid->unrecoveredOnReading;
+
+    if (!sDavidSmpte_LecturePaquetMedia (pDavid, pWindow, NULL)) break;
+
+    _lus++;
+
+    if (pDavid->unrecoveredOnReading != _avant)
+    {
+      (*pRafale)++;
+    }
+    else
+    {
+      Rafale (pPoint, *pRafale);
+      *pRafale = 0;
+    }
+  }
+
+  return _lus;
+}
+
+// Analyse un point de la grille : flux média + FEC (ordre de FecGenerator, ----
+// gap 0) à travers le canal puis décodage au niveau métadonnées (dry run)  ----
+static void Analyse
+  (sPoint*  pPoint, //: Point à analyser
+   uint64_t pSeed)  //: Graine propre au point
+{
+  struct timespec debut, fin;
+  clock_gettime (CLOCK_MONOTONIC, &debut);
+
+  unsigned _LD = pPoint->L * pPoint->D;
+
+  // Flux (métadonnées seules) et canal à générateur propre au point
+  sGenerateur* _gen = sGenerateur_New (pPoint->L, pPoint->D, pPoint->matrix2D,
+                                       0, pPoint->p, pPoint->q, pSeed);
+  ASSERTc (_gen, , cExAllocateMemory)
+
+  pPoint->window     = optionWindow ? optionWindow : 2 * _LD;
+  pPoint->profondeur = calloc (_LD + 1, sizeof (unsigned long long));
+  ASSERTc (pPoint->profondeur, , cExAllocateMemory)
+
+  sDavidSmpte _david = sDavidSmpte_New (false, true);
+
+  unsigned _recup   = 0; // Récupérés par l'algorithme (au FEC précédent)
+  unsigned _lus     = 0;
+  unsigned _rafale  = 0;
+
+  sMediaNo* _perdus = malloc (_LD * sizeof (sMediaNo));
+  unsigned  _nbPerdus, i, k;
+  ASSERTc (_perdus, , cExAllocateMemory)
+
+  while (pPoint->media < optionPackets)
+  {
+    _nbPerdus = 0; // Paquets média perdus de la matrice (non encore récupérés)
+
+    for (i = 0; i < _LD; i++)
+    {
+      sPaquetMedia* _media = sGenerateur_Encode (_gen);
+      ASSERTc (_media, , cExMediaForge)
+
+      sGenerateur_Transmet (_gen, _media);
+
+      if (_gen->media)
+      {
+        sDavidSmpte_ArriveePaquetMedia (&_david, _gen->media);
+      }
+      else
+      {
+        _perdus[_nbPerdus++] = _gen->no;
+      }
+
+      // FEC colonne puis FEC ligne terminés par ce paquet média
+      for (k = 0; k < 2; k++)
+      {
+        if (!_gen->fec[k]) continue;
+
+        sDavidSmpte_ArriveePaquetFec (&_david, _gen->fec[k]);
+
+        if (_david.recovered == _recup) continue;
+
+        _recup = _david.recovered;
+
+        // Profondeur requise : paquets émis depuis chaque paquet récupéré
+        unsigned j = 0;
+
+        while (j < _nbPerdus)
+        {
+          if (sBufferMedia_IsPresent (&_david.media, _perdus[j]))
+          {
+            pPoint->profondeur[(sMediaNo)(_gen->mediaNo - _perdus[j])]++;
+            _perdus[j] = _perdus[--_nbPerdus];
+          }
+          else
+          {
+            j++;
+          }
+        }
+      }
+
+      _lus += Lecture (pPoint, &_david, pPoint->window, &_rafale);
+    }
+
+    pPoint->media += _LD;
+  }
+
+  _lus += Lecture (pPoint, &_david, 0, &_rafale);
+
+  // Paquets jamais lus (manquants en tête ou en fin de flux) : rafale finale
+  _rafale += pPoint->media - _lus;
+
+  Rafale (pPoint, _rafale);
+
+  pPoint->recup     = _david.recovered;
+  pPoint->residuel  = pPoint->media - (_lus - _david.unrecoveredOnReading);
+  pPoint->pertes    = _gen->pertes;
+  pPoint->fecPertes = _gen->fecPertes;
+
+  sDavidSmpte_Release (&_david);
+  sGenerateur_Release (_gen);
+  free (_perdus);
+
+  clock_gettime (CLOCK_MONOTONIC, &fin);
+
+  pPoint->duree = (fin.tv_sec  - debut.tv_sec) +
+                  (fin.tv_nsec - debut.tv_nsec) * 1e-9;
+}
+
+// Corps d'un ouvrier : analyse les points de la grille jusqu'à épuisement -----
+//> Rien
+static void* Ouvrier
+  (void* pInutile) //: Inutilisé
+{
+  while (true)
+  {
+    pthread_mutex_lock (&pointMutex);
+    unsigned _no = pointNo++;
+    pthread_mutex_unlock (&pointMutex);
+
+    if (_no >= nbPoint) break;
+
+    Analyse (&point[_no], optionSeed * 0x10000 + _no);
+
+    PRINT1 ("point %u/%u : L=%u D=%u %uD p=%g q=%g en %.3f s\n",
+            _no+1, nbPoint, point[_no].L, point[_no].D,
+            point[_no].matrix2D ? 2 : 1, point[_no].p, point[_no].q,
+            point[_no].duree)
+  }
+
+  return 0;
+}
+
+// Enregistre les résultats d'un point (une ligne CSV) -------------------------
+static void PointToFile
+  (const sPoint* pPoint, //: Point analysé
+         FILE  * pFile)  //: Fichier destination
+{
+  unsigned n, _LD = pPoint->L * pPoint->D;
+
+  // Profondeur maximum, moyenne et 99ème centile des récupérations
+  unsigned long long _nb = 0, _somme = 0, _cumul = 0;
+  unsigned           _max = 0, _p99 = 0;
+
+  for (n = 0; n <= _LD; n++)
+  {
+    _nb    += pPoint->profondeur[n];
+    _somme += pPoint->profondeur[n] * n;
+    if (pPoint->profondeur[n]) _max = n;
+  }
+
+  for (n = 0; n <= _LD && _nb > 0; n++)
+  {
+    _cumul += pPoint->profondeur[n];
+    if (_cumul * 100 >= _nb * 99) { _p99 = n; break; }
+  }
+
+  unsigned long long _rafales = 0;
+
+  for (n = 0; n < RAFALE_MAX; n++) _rafales += pPoint->rafales[n];
+
+  fprintf (pFile, "%u,%u,%u,%g,%g,%llu,%llu,%g,%llu,%llu,%llu,%g,%llu,%u,",
+           pPoint->L, pPoint->D, pPoint->matrix2D ? 2 : 1, pPoint->p, pPoint->q,
+           pPoint->media, pPoint->pertes,
+           (double)pPoint->pertes / pPoint->media, pPoint->fecPertes,
+           pPoint->recup, pPoint->residuel,
+           (double)pPoint->residuel / pPoint->media, _rafales,
+           pPoint->rafaleMax);
+
+  for (n = 0; n < RAFALE_MAX; n++) fprintf (pFile, "%llu,", pPoint->rafales[n]);
+
+  fprintf (pFile, "%u,%g,%u,%u,%.3f\n", _max, _nb ? (double)_somme / _nb : 0,
+           _p99, pPoint->window, pPoint->duree);
+}
+
+// Fonctions publiques =========================================================
+
+// Affiche (et enregistre dans un fichier) le contenu des deux algorithmes -----
+void AssertPrintError()
+{
+}
+
+// Point d'entrée du programme -------------------------------------------------
+//> Code d'erreur renvoyé au système (0 = ok)
+int main (int argc, char ** argv)
+{
+  PRINT_INIT_COLOR()
+
+  unsigned no;
+
+  // Affiche le titre du logiciel
+  PRINT0_CONc (cConDefault, cFecAnalyzerMsgTitle)
+
+  // Paramètres de la grille, le dernier variant le plus vite
+  grille = sGrille_New();
+  axeL   = sGrille_AddAxe (&grille, cLabelL,        5);
+  axeD   = sGrille_AddAxe (&grille, cLabelD,        5);
+  axeM   = sGrille_AddAxe (&grille, cLabel2DMatrix, 2);
+  axeP   = sGrille_AddAxe (&grille, cLabelTewfiqP,  0.001);
+  axeQ   = sGrille_AddAxe (&grille, cLabelTewfiqQ,  2);
+
+  signed sno;
+  for (sno = 1; sno < argc; sno++)
+  {
+    char* arg = argv[sno];
+
+    if (strcmp (arg, cLabelVerbose1) == 0)
+    {
+      verbose = 1;
+    }
+    else if (strcmp (arg, cLabelVerbose2) == 0)
+    {
+      verbose = 2;
+    }
+    else if (strcmp (arg, cLabelAutoKey) == 0)
+    {
+      optionAutoKey = true;
+    }
+    else if (strcmp (arg, cLabelAbout) == 0)
+    {
+      PRINT0_CON    (cConTitle,   "%s", cMsgAboutTGoal)
+      PRINT0_CON    (cConDefault, "%s", cMsgAboutLGoal)
+      PRINT0_CON    (cConTitle,   "%s", cMsgAboutTFunction)
+      PRINT0_CON    (cConDefault, "%s", cFecAnalyzerMsgAboutLFunction)
+      PRINT0_CON    (cConTitle,   "%s", cTheGuyTitle)
+      PRINT0_CON    (cConDefault, "%s", cTheGuyLabel)
+      KeyToContinue (optionAutoKey);
+
+      return 0;
+    }
+    else if (strcmp (arg, cLabelHelp) == 0)
+    {
+      PRINT0_CON    (cConDefault, "%s", cFecAnalyzerMsgHelp)
+      KeyToContinue (optionAutoKey);
+
+      return 0;
+    }
+    else
+    {
+      char* value;
+
+      if ((value = GetParameterValue (arg, cLabelDest, '=')) != 0)
+      {
+        optionDest = value;
+      }
+      else if (sGrille_Parametre (&grille, arg))
+      {
+        // Liste de valeurs d'un axe de la grille (l=, d=, matrix=, ...)
+      }
+      else if ((value = GetParameterValue (arg, cLabelPackets, '=')) != 0)
+      {
+        optionPackets = atoi (value);
+      }
+      else if ((value = GetParameterValue (arg, cLabelWindow, '=')) != 0)
+      {
+        optionWindow = atoi (value);
+      }
+      else if ((value = GetParameterValue (arg, cLabelThreads, '=')) != 0)
+      {
+        optionThreads = atoi (value);
+      }
+      else if ((value = GetParameterValue (arg, cLabelSeed, '=')) != 0)
+      {
+        optionSeed = strtoull (value, NULL, 10);
+      }
+      else // Un paramètre incorrect
+      {
+        PRINT0_CON    (cConError, "%s", cFecAnalyzerMsgSyntax)
+        PRINT0_CON    (cConError, "%s", cFecAnalyzerMsgHelp)
+        KeyToContinue (optionAutoKey);
+
+        return 0;
+      }
+    }
+  }
+
+  if (optionDest == 0) optionDest = (char*)cFecAnalyzerDest;
+
+  // GRILLE DES POINTS À ANALYSER (L, D, MATRICE, P, Q) ========================
+
+  nbPoint = sGrille_Points (&grille);
+  point   = calloc (nbPoint, sizeof (sPoint));
+  ASSERTc (point, -1, cExAllocateMemory)
+
+  for (no = 0; no < nbPoint; no++)
+  {
+    point[no].q = fabs (sGrille_Valeur (&grille, no, axeQ));
+    point[no].p = fabs (sGrille_Valeur (&grille, no, axeP));
+
+    unsigned _dim = sGrille_Valeur (&grille, no, axeM);
+    point[no].D   = sGrille_Valeur (&grille, no, axeD);
+    point[no].L   = sGrille_Valeur (&grille, no, axeL);
+
+    point[no].p = point[no].p > 1.0 ? 1.0 : point[no].p;
+    point[no].q = point[no].q < 1.0 ? 1.0 : point[no].q;
+    point[no].matrix2D = _dim == 2;
+
+    ASSERTc (_dim >= 1 && _dim <= 2, -1, cExMatrixDim)
+    ASSERTc (point[no].L >= 1,       -1, cExMatrixMin)
+    ASSERTc (point[no].D >= 1,       -1, cExMatrixMin)
+
+    // Le buffer média est circulaire sur 2^16 numéros de séquence
+    ASSERTc ((optionWindow ? optionWindow : 2u * point[no].L * point[no].D)
+             < 0x8000, -1, cExMatrixMax)
+  }
+
+  PRINT0_FILE (cFecAnalyzerLogFile, "w",
+              "points:%u, packets:%u, window:%u, seed:%llu\n\n", nbPoint,
+              optionPackets, optionWindow, (unsigned long long)optionSeed)
+
+  FILE*    dest = fopen (optionDest, "w");
+  ASSERTc (dest, -1, cExDestFile)
+
+  // ANALYSE DES POINTS PAR LES OUVRIERS =======================================
+
+  PRINT0_CONc    (cConDefault, cFecAnalyzerMsg1of1)
+  PRINT_SET_FILE (cFecAnalyzerLogFile, "a")
+
+  unsigned nbOuvriers = optionThreads ? optionThreads :
+                        (unsigned)sysconf (_SC_NPROCESSORS_ONLN);
+  nbOuvriers = nbOuvriers < 1            ? 1            : nbOuvriers;
+  nbOuvriers = nbOuvriers > OUVRIERS_MAX ? OUVRIERS_MAX : nbOuvriers;
+  nbOuvriers = nbOuvriers > nbPoint      ? nbPoint      : nbOuvriers;
+
+  pthread_t ouvrier[OUVRIERS_MAX];
+
+  struct timespec debut, fin;
+  clock_gettime (CLOCK_MONOTONIC, &debut);
+
+  for (no = 0; no < nbOuvriers; no++)
+  {
+    int ok = pthread_create (&ouvrier[no], 0, Ouvrier, 0);
+    ASSERT (ok == 0, -1, "Unable to start worker %u", no)
+  }
+
+  for (no = 0; no < nbOuvriers; no++) pthread_join (ouvrier[no], 0);
+
+  clock_gettime (CLOCK_MONOTONIC, &fin);
+
+  // ENREGISTREMENT DES RÉSULTATS (ORDRE DE LA GRILLE) =========================
+
+  fprintf (dest, "L,D,matrix,p,q,media,lost,loss_rate,fec_lost,recovered,"
+                 "residual,residual_rate,bursts,burst_max,");
+
+  for (no = 1; no < RAFALE_MAX; no++) fprintf (dest, "burst_%u,", no);
+
+  fprintf (dest, "burst_%u+,depth_max,depth_mean,depth_p99,window,seconds\n",
+           RAFALE_MAX);
+
+  for (no = 0; no < nbPoint; no++)
+  {
+    PointToFile (&point[no], dest);
+    free (point[no].profondeur);
+  }
+
+  fclose (dest);
+  free   (point);
+
+  PRINT0 ("%u points analysed by %u workers in %.3f s\n", nbPoint, nbOuvriers,
+          (fin.tv_sec - debut.tv_sec) + (fin.tv_nsec - debut.tv_nsec) * 1e-9)
+
+  // ===========================================================================
+
+  PRINT0_CONc   (cConDefault, cMsgEnded)
+  KeyToContinue (optionAutoKey);
+
+  return 0;
+}
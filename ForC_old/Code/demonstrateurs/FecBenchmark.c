@@ -0,0 +1,756 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : End-to-end in-memory throughput benchmark
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+#include <sys/resource.h>
+
+// Constantes ==================================================================
+
+#define CASCADES    6    //. Classes de cascade : 0, 1, 2-3, 4-7, 8-15, 16+
+#define LENTS       16   //. Appels les plus lents conservés par point
+
+// Types de données ============================================================
+
+// Evénement de réception : paquet arrivé (média ou FEC) ou lecture du buffer --
+typedef struct
+{
+  sPaquetMedia* media; //. Paquet média arrivé (ou 0)
+  sPaquetFec*   fec;   //. Paquet de FEC arrivé (ou 0), les deux à 0 = lecture
+}
+  sEvenement;
+
+// Résumé d'un histogramme de durées d'appel (en ns) ---------------------------
+typedef struct
+{
+  unsigned long long nombre; //. Nombre d'appels
+
+  double moyenne; //. Durée moyenne
+  double p50;     //. Médiane
+  double p99;     //. 99ème percentile
+  double p999;    //. 99.9ème percentile
+  double max;     //. Durée maximale
+}
+  sLatence;
+
+// Un appel lent et l'état du décodeur à ce moment (corrélation de la queue) ---
+typedef struct
+{
+  uint64_t ticks;   //. Durée de l'appel (ticks de sInstant_Ticks)
+  bool     fec;     //. ArriveePaquetFec (sinon ArriveePaquetMedia) ?
+  unsigned cascade; //. Paquets média récupérés par l'appel
+  unsigned cross;   //. Cross présents après l'appel (media.crossCount)
+  unsigned waits;   //. Waits présents après l'appel (colonne + ligne)
+  unsigned maxC;    //. maxC du décodeur après l'appel
+  unsigned maxW;    //. maxW du décodeur après l'appel
+
+  unsigned long long appel; //. Rang de l'appel (media et FEC confondus)
+}
+  sLent;
+
+// Un point de la grille : profil de FEC, payload, canal et mesures ------------
+typedef struct
+{
+  uint8_t  L;        //. Taille (colonne) de la matrice de FEC
+  uint8_t  D;        //. Taille (ligne)   de la matrice de FEC
+  bool     matrix2D; //. FEC ligne en plus des FEC colonne ?
+  unsigned payload;  //. Taille du payload des paquets média (octets)
+  double   p;        //. Probabilité de passer de ok à perte
+
+  unsigned long long media;     //. Paquets média émis
+  unsigned long long fec;       //. Paquets de FEC émis
+  unsigned long long pertes;    //. Paquets média perdus (avant FEC)
+  unsigned long long fecPertes; //. Paquets de FEC perdus
+  unsigned long long recup;     //. Paquets média récupérés
+  unsigned long long residuel;  //. Paquets média manquants à la lecture
+
+  uint64_t nsEncode; //. Temps de génération (forge + xor des FEC) en ns
+  uint64_t nsMedia;  //. Temps passé dans ArriveePaquetMedia en ns
+  uint64_t nsFec;    //. Temps passé dans ArriveePaquetFec en ns
+  uint64_t nsTotal;  //. Temps total du point (génération à lecture) en ns
+  sMemoire memoire;  //. Mémoire comptée par le décodeur (pics compris)
+
+  sLatence latMedia;             //. Durée des appels ArriveePaquetMedia
+  sLatence latFec;               //. Durée des appels ArriveePaquetFec
+  sLatence latCascade[CASCADES]; //. Durée des appels selon leur cascade
+  sLent    lents[LENTS];         //. Appels les plus lents (+ lent en tête)
+  unsigned nbLents;              //. Nombre d'appels lents conservés
+
+  double compteurs[CPT_NOMBRE]; //. Compteurs du décodage (-1 = indisponible)
+}
+  sPoint;
+
+// Variables Globales ==========================================================
+
+static bool     optionAutoKey = false;   //. Automatiquement valider les msgs ?
+static bool     optionCounters = false;  //. Lire les compteurs de performance ?
+static char*    optionDest    = NULL;    //. Fichier destination (JSON)
+static unsigned optionPackets = 1000000; //. Paquets média générés par point
+static sMediaNo optionWindow  = 0;       //. Nb de media stockés (0 = 2*L*D)
+static double   optionQ       = 2;       //. Longueur moyenne d'une rafale
+static uint64_t optionSeed    = 1;       //. Graine du générateur aléatoire
+
+static sGrille  grille; //. Valeurs de L, D, matrice, payload et p
+static unsigned axeL, axeD, axeM, axeS, axeP; //. Axes de la grille
+
+static double  nsParTick;              //. Durée d'un tick de sInstant_Ticks
+static sHisto* histoMedia;             //. Durées des ArriveePaquetMedia
+static sHisto* histoFec;               //. Durées des ArriveePaquetFec
+static sHisto* histoCascade[CASCADES]; //. Durées des appels par cascade
+
+static sCompteurs  compteurs;    //. Compteurs de performance (décodage)
+static sEvenement* evenements;   //. Réceptions d'une matrice, dans l'ordre
+static unsigned    nbEvenements; //. Nombre de réceptions en attente
+
+static unsigned long long nbAppels;  //. Appels chronométrés du point
+static uint64_t           seuilLent; //. Plus court des appels lents conservés
+
+// Fonctions privées ===========================================================
+
+// Horloge monotone ------------------------------------------------------------
+//> Instant courant en ns
+static inline uint64_t Maintenant()
+{
+  struct timespec _t;
+  clock_gettime (CLOCK_MONOTONIC, &_t);
+
+  return (uint64_t)_t.tv_sec * 1000000000ull + _t.tv_nsec;
+}
+
+// Résume un histogramme de durées d'appel (ticks -> ns) -----------------------
+static void Latence
+  (const sHisto*   pHisto,   //: Histogramme des durées (ticks)
+         sLatence* pLatence) //: Résumé en ns
+{
+  pLatence->nombre  = pHisto->nombre;
+  pLatence->moyenne = sHisto_Moyenne    (pHisto)       * nsParTick;
+  pLatence->p50     = sHisto_Percentile (pHisto, 50)   * nsParTick;
+  pLatence->p99     = sHisto_Percentile (pHisto, 99)   * nsParTick;
+  pLatence->p999    = sHisto_Percentile (pHisto, 99.9) * nsParTick;
+  pLatence->max     = sHisto_Percentile (pHisto, 100)  * nsParTick;
+}
+
+// Comptabilise un appel chronométré : histogramme du type d'appel, de sa ------
+// classe de cascade et, s'il est parmi les plus lents, état du décodeur  ------
+static void Appel
+  (      sPoint*      pPoint,   //: Point mesuré
+   const sDavidSmpte* pDavid,   //: Algorithme appelé
+         bool         pFec,     //: ArriveePaquetFec (sinon Media) ?
+         uint64_t     pTicks,   //: Durée de l'appel
+         unsigned     pRecup)   //: david.recovered avant l'appel
+{
+  unsigned no, _cascade = pDavid->recovered - pRecup;
+  unsigned _classe = 0;
+
+  while (_classe < CASCADES - 1 && _cascade >> _classe) _classe++;
+
+  sHisto_Add (pFec ? histoFec : histoMedia, pTicks);
+  sHisto_Add (histoCascade[_classe],        pTicks);
+
+  nbAppels++;
+
+  if (pPoint->nbLents == LENTS && pTicks <= seuilLent) return;
+
+  // Insère l'appel à son rang parmi les plus lents (le dernier sort)
+  no = pPoint->nbLents < LENTS ? pPoint->nbLents++ : LENTS - 1;
+
+  for (; no > 0 && pPoint->lents[no-1].ticks < pTicks; no--)
+  {
+    pPoint->lents[no] = pPoint->lents[no-1];
+  }
+
+  sLent* _lent = &pPoint->lents[no];
+
+  _lent->ticks   = pTicks;
+  _lent->fec     = pFec;
+  _lent->cascade = _cascade;
+  _lent->cross   = pDavid->media.crossCount;
+  _lent->waits   = pDavid->fec.wait[COL].count + pDavid->fec.wait[ROW].count;
+  _lent->maxC    = pDavid->maxC;
+  _lent->maxW    = pDavid->maxW;
+  _lent->appel   = nbAppels;
+
+  seuilLent = pPoint->lents[pPoint->nbLents-1].ticks;
+}
+
+// Ajoute un événement de réception (paquet arrivé ou lecture) -----------------
+static void Evenement
+  (sPaquetMedia* pMedia, //: Paquet média arrivé (ou 0)
+   sPaquetFec*   pFec)   //: Paquet de FEC arrivé (ou 0)
+{
+  evenements[nbEvenements].media = pMedia;
+  evenements[nbEvenements].fec   = pFec;
+  nbEvenements++;
+}
+
+// Décode les réceptions d'une matrice dans leur ordre d'émission. Seule  ------
+// cette boucle est comptée par les compteurs de performance (la          ------
+// génération et le xor des FEC en sont exclus) ; les appels ne sont      ------
+// alors pas chronométrés, pour que l'instrumentation ne soit pas comptée ------
+static void Recoit
+  (sPoint*      pPoint,  //: Point mesuré
+   sDavidSmpte* pDavid,  //: Algorithme destinataire
+   sMediaNo     pWindow, //: Nombre de paquets média à garder dans le buffer
+   unsigned*    pLus)    //: Paquets lus (cumul)
+{
+  unsigned no;
+
+  if (optionCounters) sCompteurs_Start (&compteurs);
+
+  for (no = 0; no < nbEvenements; no++)
+  {
+    sEvenement* _ev     = &evenements[no];
+    unsigned    _recup  = pDavid->recovered;
+    uint64_t    _ticks  = optionCounters ? 0 : sInstant_Ticks();
+
+    if (_ev->media)
+    {
+      sDavidSmpte_ArriveePaquetMedia (pDavid, _ev->media);
+      if (optionCounters) continue;
+      Appel (pPoint, pDavid, false, sInstant_Ticks() - _ticks, _recup);
+    }
+    else if (_ev->fec)
+    {
+      sDavidSmpte_ArriveePaquetFec (pDavid, _ev->fec);
+      if (optionCounters) continue;
+      Appel (pPoint, pDavid, true, sInstant_Ticks() - _ticks, _recup);
+    }
+    else
+    {
+      while (sDavidSmpte_LecturePaquetMedia (pDavid, pWindow, NULL)) (*pLus)++;
+    }
+  }
+
+  if (optionCounters) sCompteurs_Stop (&compteurs);
+
+  nbEvenements = 0;
+}
+
+// Mesure un point de la grille : génération des paquets média et de FEC -------
+// (ordre de FecGenerator, gap 0), canal puis décodage avec les payloads -------
+static void Mesure
+  (sPoint*  pPoint, //: Point à mesurer
+   uint64_t pSeed)  //: Graine propre au point
+{
+  unsigned i, _LD = pPoint->L * pPoint->D;
+
+  sMediaNo _window = optionWindow ? optionWindow : 2 * _LD;
+
+  // Flux et canal de Gilbert-Elliott à générateur propre au point
+  sGenerateur* _gen = sGenerateur_New (pPoint->L, pPoint->D, pPoint->matrix2D,
+                                       pPoint->payload, pPoint->p, optionQ,
+                                       pSeed);
+  ASSERTc (_gen, , cExAllocateMemory)
+
+  sDavidSmpte _david = sDavidSmpte_New (false, false);
+
+  sHisto_Reset (histoMedia);
+  sHisto_Reset (histoFec);
+  for (i = 0; i < CASCADES; i++) sHisto_Reset (histoCascade[i]);
+
+  nbAppels  = 0;
+  seuilLent = 0;
+
+  // Au plus LD médias, LD lectures et L+D FEC par matrice
+  unsigned _nbMax = 2 * _LD + pPoint->L + pPoint->D;
+
+  evenements   = malloc (_nbMax * sizeof (sEvenement));
+  nbEvenements = 0;
+  ASSERTc (evenements, , cExAllocateMemory)
+
+  if (optionCounters) sCompteurs_Reset (&compteurs);
+
+  unsigned _lus = 0;
+
+  uint64_t _debut = Maintenant();
+
+  while (pPoint->media < optionPackets)
+  {
+    for (i = 0; i < _LD; i++)
+    {
+      uint64_t _t = Maintenant();
+
+      // GÉNÉRATION DU PAQUET MÉDIA ET DES FEC ================================
+
+      sPaquetMedia* _media = sGenerateur_Encode (_gen);
+      ASSERTc (_media, , cExMediaForge)
+
+      pPoint->nsEncode += Maintenant() - _t;
+
+      // TRANSMISSION (DÉCODAGE EN FIN DE MATRICE, VOIR RECOIT) ================
+
+      sGenerateur_Transmet (_gen, _media);
+
+      if (_gen->media)    Evenement (_gen->media, 0);
+      if (_gen->fec[COL]) Evenement (0, _gen->fec[COL]);
+      if (_gen->fec[ROW]) Evenement (0, _gen->fec[ROW]);
+
+      Evenement (0, 0); // Lecture du buffer
+    }
+
+    Recoit (pPoint, &_david, _window, &_lus);
+
+    pPoint->media += _LD;
+  }
+
+  Evenement (0, 0);
+  Recoit    (pPoint, &_david, 0, &_lus);
+
+  pPoint->nsTotal   = Maintenant() - _debut;
+  pPoint->fec       = _gen->nbFec;
+  pPoint->pertes    = _gen->pertes;
+  pPoint->fecPertes = _gen->fecPertes;
+  pPoint->nsMedia  = histoMedia->somme * nsParTick;
+  pPoint->nsFec    = histoFec->somme   * nsParTick;
+  pPoint->recup    = _david.recovered;
+  pPoint->residuel = pPoint->media - (_lus - _david.unrecoveredOnReading);
+
+  sMemoire_Reset (&pPoint->memoire);
+  if (_david.memoire) pPoint->memoire = *_david.memoire;
+
+  sDavidSmpte_Release (&_david);
+  sGenerateur_Release (_gen);
+
+  for (i = 0; i < CPT_NOMBRE; i++)
+  {
+    bool ok = optionCounters && sCompteurs_Read (&compteurs, i,
+                                                 &pPoint->compteurs[i]);
+    if (!ok) pPoint->compteurs[i] = -1;
+  }
+
+  free (evenements);
+
+  Latence (histoMedia, &pPoint->latMedia);
+  Latence (histoFec,   &pPoint->latFec);
+  for (i = 0; i < CASCADES; i++)
+  {
+    Latence (histoCascade[i], &pPoint->latCascade[i]);
+  }
+}
+
+// Enregistre le résumé d'un histogramme de durées (un objet JSON) -------------
+static void LatenceToFile
+  (const sLatence* pLatence, //: Résumé à enregistrer
+         FILE    * pFile)    //: Fichier destination
+{
+  fprintf (pFile, "{\"count\": %llu, \"mean_ns\": %.1f, \"p50_ns\": %.1f, "
+                  "\"p99_ns\": %.1f, \"p999_ns\": %.1f, \"max_ns\": %.1f}",
+           pLatence->nombre, pLatence->moyenne, pLatence->p50, pLatence->p99,
+           pLatence->p999, pLatence->max);
+}
+
+// Enregistre les pics de mémoire (octets) par catégorie (un objet JSON) -------
+static void MemoireToFile
+  (const sMemoire* pMemoire, //: Comptabilité à enregistrer
+   FILE          * pFile)    //: Fichier destination
+{
+  unsigned no;
+
+  fprintf (pFile, "{\"total\": %lld", (long long)pMemoire->total.maxOctets);
+
+  for (no = 0; no < MEM_NOMBRE; no++)
+  {
+    fprintf (pFile, ", \"%s\": %lld", cMemoireNoms[no],
+             (long long)pMemoire->categorie[no].maxOctets);
+  }
+
+  fprintf (pFile, "}");
+}
+
+// Enregistre les mesures d'un point (un objet JSON) ---------------------------
+static void PointToFile
+  (const sPoint* pPoint, //: Point mesuré
+         FILE  * pFile)  //: Fichier destination
+{
+  unsigned long long _recus = pPoint->media - pPoint->pertes;
+  unsigned long long _fecs  = pPoint->fec   - pPoint->fecPertes;
+
+  double _s = pPoint->nsTotal * 1e-9;
+
+  fprintf (pFile, "    {\"L\": %u, \"D\": %u, \"matrix\": %u, \"payload\": %u, "
+                  "\"p\": %g, \"q\": %g,\n",
+           pPoint->L, pPoint->D, pPoint->matrix2D ? 2 : 1, pPoint->payload,
+           pPoint->p, optionQ);
+
+  fprintf (pFile, "     \"media\": %llu, \"fec\": %llu, \"lost\": %llu, "
+                  "\"fec_lost\": %llu, \"recovered\": %llu, "
+                  "\"residual\": %llu,\n",
+           pPoint->media, pPoint->fec, pPoint->pertes, pPoint->fecPertes,
+           pPoint->recup, pPoint->residuel);
+
+  fprintf (pFile, "     \"seconds\": %.6f, \"packets_per_s\": %.0f, "
+                  "\"media_per_s\": %.0f, \"mbit_per_s\": %.1f,\n",
+           _s, (pPoint->media + pPoint->fec) / _s, pPoint->media / _s,
+           pPoint->media * pPoint->payload * 8e-6 / _s);
+
+  fprintf (pFile, "     \"ns_per_packet\": %.1f, \"ns_encode\": %.1f",
+           (double)pPoint->nsTotal  / (pPoint->media + pPoint->fec),
+           (double)pPoint->nsEncode / pPoint->media);
+
+  // Distribution des durées d'appel et corrélation avec les cascades
+  const char* _classes[CASCADES] = {"0", "1", "2-3", "4-7", "8-15", "16+"};
+  unsigned    no;
+
+  fprintf       (pFile, ",\n     \"memory_peak_bytes\": ");
+  MemoireToFile (&pPoint->memoire, pFile);
+
+  // Appels non chronométrés pendant la lecture des compteurs (voir Recoit)
+  if (optionCounters)
+  {
+    fprintf (pFile, ",\n     \"ns_media_ingest\": null, "
+                    "\"ns_fec_ingest\": null");
+  }
+  else
+  {
+    fprintf (pFile, ",\n     \"ns_media_ingest\": %.1f, "
+                    "\"ns_fec_ingest\": %.1f",
+             _recus ? (double)pPoint->nsMedia / _recus : 0,
+             _fecs  ? (double)pPoint->nsFec   / _fecs  : 0);
+
+    fprintf (pFile, ",\n     \"media_ingest\": ");
+    LatenceToFile (&pPoint->latMedia, pFile);
+    fprintf (pFile, ",\n     \"fec_ingest\": ");
+    LatenceToFile (&pPoint->latFec, pFile);
+    fprintf (pFile, ",\n     \"by_cascade\": {");
+
+    for (no = 0; no < CASCADES; no++)
+    {
+      fprintf (pFile, "%s\n       \"%s\": ", no ? "," : "", _classes[no]);
+      LatenceToFile (&pPoint->latCascade[no], pFile);
+    }
+
+    fprintf (pFile, "},\n     \"slowest\": [");
+
+    for (no = 0; no < pPoint->nbLents; no++)
+    {
+      const sLent* _lent = &pPoint->lents[no];
+
+      fprintf (pFile, "%s\n       {\"call\": \"%s\", \"ns\": %.1f, "
+                      "\"index\": %llu, \"recovered\": %u, \"cross\": %u, "
+                      "\"waits\": %u, \"maxC\": %u, \"maxW\": %u}",
+               no ? "," : "", _lent->fec ? "fec" : "media",
+               _lent->ticks * nsParTick, _lent->appel, _lent->cascade,
+               _lent->cross, _lent->waits, _lent->maxC, _lent->maxW);
+    }
+
+    fprintf (pFile, "]");
+  }
+
+  // Compteurs de performance de la boucle de décodage, par paquet émis
+  if (optionCounters)
+  {
+    double _paquets = pPoint->media + pPoint->fec;
+
+    fprintf (pFile, ",\n     \"counters_per_packet\": {");
+
+    for (no = 0; no < CPT_NOMBRE; no++)
+    {
+      if (pPoint->compteurs[no] < 0)
+      {
+        fprintf (pFile, "%s\"%s\": null", no ? ", " : "", cCompteurNoms[no]);
+      }
+      else
+      {
+        fprintf (pFile, "%s\"%s\": %.2f", no ? ", " : "", cCompteurNoms[no],
+                 pPoint->compteurs[no] / _paquets);
+      }
+    }
+
+    double _cycles = pPoint->compteurs[CPT_CYCLES];
+    double _instrs = pPoint->compteurs[CPT_INSTRUCTIONS];
+
+    if (_cycles > 0 && _instrs >= 0)
+    {
+      fprintf (pFile, ", \"ipc\": %.3f", _instrs / _cycles);
+    }
+
+    fprintf (pFile, "}");
+  }
+
+  fprintf (pFile, "}");
+}
+
+// Fonctions publiques =========================================================
+
+// Affiche (et enregistre dans un fichier) le contenu des deux algorithmes -----
+void AssertPrintError()
+{
+}
+
+// Point d'entrée du programme -------------------------------------------------
+//> Code d'erreur renvoyé au système (0 = ok)
+int main (int argc, char ** argv)
+{
+  PRINT_INIT_COLOR()
+
+  unsigned no;
+
+  // Affiche le titre du logiciel
+  PRINT0_CONc (cConDefault, cFecBenchmarkMsgTitle)
+
+  // Paramètres de la grille, le dernier variant le plus vite
+  grille = sGrille_New();
+  axeL   = sGrille_AddAxe (&grille, cLabelL,        5);
+  axeD   = sGrille_AddAxe (&grille, cLabelD,        5);
+  axeM   = sGrille_AddAxe (&grille, cLabel2DMatrix, 2);
+  axeS   = sGrille_AddAxe (&grille, cLabelLrecov,   PLDS);
+  axeP   = sGrille_AddAxe (&grille, cLabelTewfiqP,  0.001);
+
+  signed sno;
+  for (sno = 1; sno < argc; sno++)
+  {
+    char* arg = argv[sno];
+
+    if (strcmp (arg, cLabelVerbose1) == 0)
+    {
+      verbose = 1;
+    }
+    else if (strcmp (arg, cLabelVerbose2) == 0)
+    {
+      verbose = 2;
+    }
+    else if (strcmp (arg, cLabelAutoKey) == 0)
+    {
+      optionAutoKey = true;
+    }
+    else if (strcmp (arg, cLabelCounters) == 0)
+    {
+      optionCounters = true;
+    }
+    else if (strcmp (arg, cLabelAbout) == 0)
+    {
+      PRINT0_CON    (cConTitle,   "%s", cMsgAboutTGoal)
+      PRINT0_CON    (cConDefault, "%s", cMsgAboutLGoal)
+      PRINT0_CON    (cConTitle,   "%s", cMsgAboutTFunction)
+      PRINT0_CON    (cConDefault, "%s", cFecBenchmarkMsgAboutLFunction)
+      PRINT0_CON    (cConTitle,   "%s", cTheGuyTitle)
+      PRINT0_CON    (cConDefault, "%s", cTheGuyLabel)
+      KeyToContinue (optionAutoKey);
+
+      return 0;
+    }
+    else if (strcmp (arg, cLabelHelp) == 0)
+    {
+      PRINT0_CON    (cConDefault, "%s", cFecBenchmarkMsgHelp)
+      KeyToContinue (optionAutoKey);
+
+      return 0;
+    }
+    else
+    {
+      char* value;
+
+      if ((value = GetParameterValue (arg, cLabelDest, '=')) != 0)
+      {
+        optionDest = value;
+      }
+      else if (sGrille_Parametre (&grille, arg))
+      {
+        // Liste de valeurs d'un axe de la grille (l=, d=, matrix=, ...)
+      }
+      else if ((value = GetParameterValue (arg, cLabelTewfiqQ, '=')) != 0)
+      {
+        double q = fabs (strtod (value, NULL));
+        optionQ  = q < 1.0 ? 1.0 : q;
+      }
+      else if ((value = GetParameterValue (arg, cLabelPackets, '=')) != 0)
+      {
+        optionPackets = atoi (value);
+      }
+      else if ((value = GetParameterValue (arg, cLabelWindow, '=')) != 0)
+      {
+        optionWindow = atoi (value);
+      }
+      else if ((value = GetParameterValue (arg, cLabelSeed, '=')) != 0)
+      {
+        optionSeed = strtoull (value, NULL, 10);
+      }
+      else // Un paramètre incorrect
+      {
+        PRINT0_CON    (cConError, "%s", cFecBenchmarkMsgSyntax)
+        PRINT0_CON    (cConError, "%s", cFecBenchmarkMsgHelp)
+        KeyToContinue (optionAutoKey);
+
+        return 0;
+      }
+    }
+  }
+
+  if (optionDest == 0) optionDest = (char*)cFecBenchmarkDest;
+
+  // GRILLE DES POINTS À MESURER (L, D, MATRICE, PAYLOAD, P) ===================
+
+  unsigned nbPoint = sGrille_Points (&grille);
+  sPoint*  point   = calloc (nbPoint, sizeof (sPoint));
+  ASSERTc (point, -1, cExAllocateMemory)
+
+  for (no = 0; no < nbPoint; no++)
+  {
+    point[no].p       = fabs (sGrille_Valeur (&grille, no, axeP));
+    point[no].payload = sGrille_Valeur (&grille, no, axeS);
+
+    unsigned _dim = sGrille_Valeur (&grille, no, axeM);
+    point[no].D   = sGrille_Valeur (&grille, no, axeD);
+    point[no].L   = sGrille_Valeur (&grille, no, axeL);
+
+    point[no].p = point[no].p > 1.0 ? 1.0 : point[no].p;
+    point[no].matrix2D = _dim == 2;
+
+    ASSERTc (_dim >= 1 && _dim <= 2, -1, cExMatrixDim)
+    ASSERTc (point[no].L >= 1,       -1, cExMatrixMin)
+    ASSERTc (point[no].D >= 1,       -1, cExMatrixMin)
+
+    ASSERT (point[no].payload <= GENERATEUR_PAYLOAD_MAX, -1,
+            "Payload size is limited to %u bytes", GENERATEUR_PAYLOAD_MAX)
+
+    // Le buffer média est circulaire sur 2^16 numéros de séquence
+    ASSERTc ((optionWindow ? optionWindow : 2u * point[no].L * point[no].D)
+             < 0x8000, -1, cExMatrixMax)
+  }
+
+  // Coût d'une lecture de l'horloge (inclus dans les mesures par paquet)
+  uint64_t _t = Maintenant();
+  for (no = 0; no < 1000; no++) Maintenant();
+  double nsHorloge = (Maintenant() - _t) / 1000.0;
+
+  // Compteur de cycles des appels : étalonnage et coût d'une paire de lectures
+  nsParTick = sInstant_NsParTick();
+
+  _t = sInstant_Ticks();
+  for (no = 0; no < 1000; no++) sInstant_Ticks();
+  double nsTick = (sInstant_Ticks() - _t) * nsParTick / 1000.0;
+
+  histoMedia = sHisto_New();
+  histoFec   = sHisto_New();
+  ASSERTc (histoMedia && histoFec, -1, cExAllocateMemory)
+
+  for (no = 0; no < CASCADES; no++)
+  {
+    histoCascade[no] = sHisto_New();
+    ASSERTc (histoCascade[no], -1, cExAllocateMemory)
+  }
+
+  PRINT0_FILE (cFecBenchmarkLogFile, "w",
+              "points:%u, packets:%u, window:%u, q:%g, seed:%llu\n\n", nbPoint,
+              optionPackets, optionWindow, optionQ,
+              (unsigned long long)optionSeed)
+
+  // Compteurs de performance : ceux que le noyau / la machine ne fournit pas
+  // (VM sans PMU, perf_event_paranoid) sont indisponibles et ignorés
+  if (optionCounters)
+  {
+    compteurs = sCompteurs_New();
+
+    for (no = 0; no < CPT_NOMBRE; no++)
+    {
+      PRINT0_FILE (cFecBenchmarkLogFile, "a", "counter %s : %s\n",
+                   cCompteurNoms[no], sCompteurs_IsDispo (&compteurs, no) ?
+                   "available" : "unavailable")
+    }
+
+    PRINT0_FILE (cFecBenchmarkLogFile, "a", "\n")
+  }
+
+  FILE*    dest = fopen (optionDest, "w");
+  ASSERTc (dest, -1, cExDestFile)
+
+  // MESURE DES POINTS (SÉRIE, UN SEUL COEUR SOLLICITÉ) ========================
+
+  PRINT0_CONc    (cConDefault, cFecBenchmarkMsg1of1)
+  PRINT_SET_FILE (cFecBenchmarkLogFile, "a")
+
+  double oldPcent = 0, newPcent = 0;
+
+  for (no = 0; no < nbPoint; no++)
+  {
+    Mesure (&point[no], optionSeed * 0x10000 + no);
+
+    PRINT1 ("point %u/%u : L=%u D=%u %uD payload=%u p=%g en %.3f s\n",
+            no+1, nbPoint, point[no].L, point[no].D,
+            point[no].matrix2D ? 2 : 1, point[no].payload, point[no].p,
+            point[no].nsTotal * 1e-9)
+
+    if (!optionCounters) // Appels non chronométrés sinon
+    {
+      PRINT1 ("  media p50=%.0f p99=%.0f p99.9=%.0f max=%.0f ns, "
+              "fec p50=%.0f p99=%.0f p99.9=%.0f max=%.0f ns\n",
+              point[no].latMedia.p50, point[no].latMedia.p99,
+              point[no].latMedia.p999, point[no].latMedia.max,
+              point[no].latFec.p50, point[no].latFec.p99,
+              point[no].latFec.p999, point[no].latFec.max)
+    }
+
+    PCENT ((double)(no+1) / nbPoint, no == nbPoint-1, cFecBenchmarkLogFile)
+  }
+
+  // ENREGISTREMENT DES RÉSULTATS (ORDRE DE LA GRILLE) =========================
+
+  // Pic de mémoire résidente du processus sur toute la grille (un point hérite
+  // des pics des précédents, seul memory_peak_bytes est propre à un point)
+  struct rusage _usage;
+  getrusage (RUSAGE_SELF, &_usage);
+
+  fprintf (dest, "{\n  \"tool\": \"FecBenchmark\", \"packets\": %u, "
+                 "\"window\": %u, \"seed\": %llu, \"clock_ns\": %.1f,\n"
+                 "  \"tick_ns\": %.4f, \"tick_read_ns\": %.1f, "
+                 "\"process_peak_rss_kb\": %ld,\n"
+                 "  \"points\": [\n",
+           optionPackets, optionWindow, (unsigned long long)optionSeed,
+           nsHorloge, nsParTick, nsTick, _usage.ru_maxrss);
+
+  // Somme des points : majorant de la mémoire si chaque profil était un flux
+  // décodé simultanément (dimensionnement d'un serveur)
+  sMemoire _tous;
+  sMemoire_Reset (&_tous);
+
+  for (no = 0; no < nbPoint; no++)
+  {
+    PointToFile    (&point[no], dest);
+    fprintf        (dest, no + 1 < nbPoint ? ",\n" : "\n");
+    sMemoire_Somme (&_tous, &point[no].memoire);
+  }
+
+  fprintf       (dest, "  ],\n  \"memory_peak_bytes_all_points\": ");
+  MemoireToFile (&_tous, dest);
+  fprintf       (dest, "\n}\n");
+
+  fclose (dest);
+  free   (point);
+
+  if (optionCounters) sCompteurs_Release (&compteurs);
+
+  sHisto_Release (histoMedia);
+  sHisto_Release (histoFec);
+  for (no = 0; no < CASCADES; no++) sHisto_Release (histoCascade[no]);
+
+  // ===========================================================================
+
+  PRINT0_CONc   (cConDefault, cMsgEnded)
+  KeyToContinue (optionAutoKey);
+
+  return 0;
+}
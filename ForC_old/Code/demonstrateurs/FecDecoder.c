@@ -27,19 +27,177 @@
 
 #include "../smpte.h"
 
+#include <pthread.h>
+
 // Variables Globales ==========================================================
 
 static bool     optionAutoKey   = false; //. Automatiquement valider les msgs ?
+static bool     optionDryRun    = false; //. Métadonnées seules (pas payload) ?
 static char*    optionSource    = NULL;  //. Fichier source
 static char*    optionDestRaw   = NULL;  //. Fichier destination raw
 static char*    optionDestDavid = NULL;  //. Fichier destination david
 static char*    optionDestBrute = NULL;  //. Fichier destination brute
+static char*    optionDestMatrix= NULL;  //. Fichier destination L x D (option)
 static sMediaNo optionWindow    = 200;   //. Nb de media stockés avant lecture
 static unsigned optionFBrute    = 0;     //. Fréquence du traitement brute
+static unsigned optionMatrices1D= 4;     //. Nb matrices sans ligne => 1D
+static char*    optionMetrics   = NULL;  //. Destination des métriques (option)
+static unsigned optionInterval  = 1000;  //. Période d'export des métriques (ms)
+
+static sDavidSmpte  david;  //. Notre variable d'utilisation de l'algo optimisé
+static sBruteSmpte  brute;  //. Notre variable d'utilisation de l'algo brute
+static sMatrixSmpte matrix; //. Décodeurs L x D spécialisés (si destMatrix)
+static bool         init = false; //. Algorithmes initialisés ?
+
+static sMetriques* metriques = NULL;  //. Statistiques de david publiées
+static bool        fini      = false; //. Fin du décodage (arrêt supervision)
+
+// Latence de récupération (david, flux horodaté par ErrorsGenerator) : un trou
+// est un paquet média manquant, détecté à l'arrivée d'un paquet média suivant
+
+#define TROUS_MAX    4096  /* Nb de trous suivis simultanément          */
+#define TROU_AGE_MAX 16384 /* Un trou plus ancien est abandonné (perdu) */
+
+typedef struct
+{
+  sMediaNo no;        //. Paquet média manquant
+  sInstant detection; //. Instant d'arrivée du paquet qui a révélé le trou
+} sTrou;
+
+static sTrou     trous[TROUS_MAX]; //. Trous en attente de récupération
+static unsigned  nbTrous     = 0;  //. Nombre de trous en attente
+static sMediaNo  plusHaut    = 0;  //. Plus haut mediaNo reçu
+static bool      premier     = true; //. Aucun paquet média encore reçu ?
+static sInstant* latences    = NULL; //. Latences de récupération en ns
+static unsigned  nbLatences  = 0;    //. Nombre de latences enregistrées
+static unsigned  maxLatences = 0;    //. Capacité de latences
+
+// Fonctions privées ===========================================================
+
+// Met à jour les trous à l'arrivée d'un paquet média --------------------------
+static void TrouMedia
+  (sMediaNo pNo,        //: Paquet média arrivé
+   sInstant pMaintenant) //: Instant d'arrivée
+{
+  unsigned no, garde = 0;
+
+  // Le paquet arrivé comble son trou (en retard, pas récupéré), les trous
+  // trop anciens sont abandonnés
+  for (no = 0; no < nbTrous; no++)
+  {
+    if (trous[no].no == pNo) continue;
+    if ((sMediaNo)(pNo - trous[no].no) > TROU_AGE_MAX &&
+        (sMediaNo)(pNo - trous[no].no) < 0x8000) continue;
+
+    trous[garde++] = trous[no];
+  }
+
+  nbTrous = garde;
+
+  sMediaNo _ecart = pNo - plusHaut;
+
+  if (premier || _ecart == 0 || _ecart >= 0x8000)
+  {
+    if (premier) plusHaut = pNo;
+    premier = false;
+    return;
+  }
+
+  // Les paquets sautés sont manquants depuis maintenant (sauf ceux que
+  // david a déjà récupérés : ils ne sont pas des trous)
+  for (plusHaut++; plusHaut != pNo; plusHaut++)
+  {
+    if (sBufferMedia_IsPresent (&david.media, plusHaut)) continue;
+
+    if (nbTrous == TROUS_MAX)
+    {
+      memmove (trous, trous + 1, --nbTrous * sizeof (sTrou));
+    }
+
+    trous[nbTrous].no        = plusHaut;
+    trous[nbTrous].detection = pMaintenant;
+    nbTrous++;
+  }
+}
+
+// Enregistre la latence des trous récupérés par david -------------------------
+static void TrousRecuperes
+  (sInstant pMaintenant) //: Instant de la récupération
+{
+  unsigned no, garde = 0;
+
+  for (no = 0; no < nbTrous; no++)
+  {
+    if (!sBufferMedia_IsPresent (&david.media, trous[no].no))
+    {
+      trous[garde++] = trous[no];
+      continue;
+    }
+
+    if (nbLatences == maxLatences)
+    {
+      maxLatences = maxLatences > 0 ? 2 * maxLatences : 1024;
+      latences    = realloc (latences, maxLatences * sizeof (sInstant));
+      ASSERTc (latences,, cExAllocateMemory)
+    }
+
+    latences[nbLatences++] = pMaintenant - trous[no].detection;
+  }
 
-static sDavidSmpte david; //. Notre variable d'utilisation de l'algo optimisé
-static sBruteSmpte brute; //. Notre variable d'utilisation de l'algo force brute
-static bool        init = false; //. Algorithmes initialisés ?
+  nbTrous = garde;
+}
+
+// Compare deux latences (qsort) -----------------------------------------------
+static int CompareLatences (const void* a, const void* b)
+{
+  sInstant _a = *(const sInstant*)a, _b = *(const sInstant*)b;
+
+  return _a < _b ? -1 : _a > _b;
+}
+
+// Affiche les centiles de la latence de récupération --------------------------
+static void Latences()
+{
+  if (nbLatences == 0) return;
+
+  qsort (latences, nbLatences, sizeof (sInstant), CompareLatences);
+
+  static const double centiles[] = { 50, 90, 99, 99.9, 100 };
+
+  PRINT0 ("\nrecovery latency (david) on %u packets :", nbLatences)
+
+  unsigned no;
+  for (no = 0; no < sizeof (centiles) / sizeof (double); no++)
+  {
+    unsigned rang = ceil (centiles[no] / 100.0 * nbLatences);
+    if (rang > 0) rang--;
+
+    PRINT0 (" p%g=%.1fus", centiles[no], latences[rang] / 1000.0)
+  }
+
+  PRINT0 ("\n")
+}
+
+// Exporte périodiquement les statistiques publiées par le décodeur ------------
+// Remarque : thread de supervision, ne touche jamais à david lui-même     -----
+static void* Supervision
+  (void* pInutile) //: Non utilisé
+{
+  unsigned _attente = 0;
+
+  while (!__atomic_load_n (&fini, __ATOMIC_ACQUIRE))
+  {
+    usleep (10000); // Tranches de 10 ms : arrêt rapide en fin de décodage
+
+    if ((_attente += 10) < optionInterval) continue;
+    _attente = 0;
+
+    // Un échec (collecteur absent, rien encore publié) attend le suivant
+    sDavidSmpte_ExporteMetriques (metriques, optionMetrics);
+  }
+
+  return 0;
+}
 
 // Fonctions publiques =========================================================
 
@@ -54,6 +212,11 @@ void AssertPrintError()
   {
     sBruteSmpte_Print (&brute, true);
   }
+
+  if (optionDestMatrix)
+  {
+    sMatrixSmpte_Print (&matrix, true);
+  }
 }
 
 // Point d'entrée du programme -------------------------------------------------
@@ -78,6 +241,10 @@ int main (int argc, char ** argv)
     {
       verbose = 2;
     }
+    else if (strcmp (arg, cLabelDryRun) == 0)
+    {
+      optionDryRun = true;
+    }
     else if (strcmp (arg, cLabelAbout) == 0)
     {
       PRINT0_CON    (cConTitle,   "%s", cMsgAboutTGoal)
@@ -117,6 +284,10 @@ int main (int argc, char ** argv)
       {
         optionDestBrute = value;
       }
+      else if ((value = GetParameterValue (arg, cLabelDestMatrix, '=')) != 0)
+      {
+        optionDestMatrix = value;
+      }
       else if ((value = GetParameterValue (arg, cLabelWindow, '=')) != 0)
       {
         optionWindow = atoi (value);
@@ -125,6 +296,18 @@ int main (int argc, char ** argv)
       {
         optionFBrute = atoi (value);
       }
+      else if ((value = GetParameterValue (arg, cLabelMatrices1D, '=')) != 0)
+      {
+        optionMatrices1D = atoi (value);
+      }
+      else if ((value = GetParameterValue (arg, cLabelMetrics, '=')) != 0)
+      {
+        optionMetrics = value;
+      }
+      else if ((value = GetParameterValue (arg, cLabelInterval, '=')) != 0)
+      {
+        optionInterval = atoi (value);
+      }
       else // Un paramètre incorrect
       {
         goto __params_error;
@@ -175,6 +358,14 @@ int main (int argc, char ** argv)
     ASSERTc (destBrute, -1, cExDestFile)
   }
 
+  FILE* destMatrix = 0;
+
+  if (optionDestMatrix)
+  {
+    destMatrix = fopen (optionDestMatrix, "wb");
+    ASSERTc (destMatrix, -1, cExDestFile)
+  }
+
   // Lecture de la taille du fichier source
   fseek (source, 0, SEEK_END);
   long sourceSize = ftell (source);
@@ -186,15 +377,31 @@ int main (int argc, char ** argv)
 
   // INITIALISATION DE SESSION MEDIA / FEC =====================================
 
-  david = sDavidSmpte_New (true);
+  david = sDavidSmpte_New (true, optionDryRun);
 
   if (optionFBrute > 0)
   {
     brute = sBruteSmpte_New (true);
   }
 
+  if (optionDestMatrix)
+  {
+    matrix = sMatrixSmpte_New (true, optionMatrices1D);
+  }
+
   init = true;
 
+  pthread_t superviseur;
+
+  if (optionMetrics)
+  {
+    metriques = sMetriques_New();
+    ASSERTc (metriques, -1, cExAllocateMemory)
+
+    int ok = pthread_create (&superviseur, 0, Supervision, 0);
+    ASSERTc (ok == 0, -1, cExMetricsThread)
+  }
+
   // DÉMARRAGE DE SESSION MÉDIA / FEC ==========================================
 
   // BOUCLE DE LECTURE DU FICHIER RTP + FEC -> ALGORITHME DE FEC ===============
@@ -204,16 +411,23 @@ int main (int argc, char ** argv)
 
   unsigned nbMedia = 0;
 
+  sInstant maintenant = 0;     //. Instant d'arrivée du paquet en cours
+  bool     horodate   = false; //. Le flux contient-il des instants ?
+  unsigned recovered  = 0;     //. Nb de récupérations déjà attribuées
+
   bool eof = false;
 
   while (!eof)
   {
-    sPaquetMedia *_mediaDavid, *_mediaBrute = 0;
-    sPaquetFec   *_fecDavid,   *_fecBrute   = 0;
+    sPaquetMedia *_mediaDavid, *_mediaBrute = 0, *_mediaMatrix = 0;
+    sPaquetFec   *_fecDavid,   *_fecBrute   = 0, *_fecMatrix   = 0;
+
+    // Instant d'arrivée du paquet qui suit (flux horodaté seulement)
+    if (sInstant_FromFile (source, &maintenant)) horodate = true;
 
     // RÉCEPTION D'UN PAQUET MÉDIA =============================================
 
-    if ((_mediaDavid = sPaquetMedia_FromFile (source)) != 0)
+    if ((_mediaDavid = sPaquetMedia_FromFile (source, !optionDryRun)) != 0)
     {
       PRINT1 ("paquet media lu : ")
       sPaquetMedia_Print (_mediaDavid);
@@ -221,11 +435,19 @@ int main (int argc, char ** argv)
 
       sPaquetMedia_ToFile (_mediaDavid, destRaw, false);
 
+      // Les deux algorithmes partagent le même bloc (pas de copie)
       if (optionFBrute > 0)
       {
-        _mediaBrute = sPaquetMedia_Copy (_mediaDavid);
+        _mediaBrute = sPaquetMedia_Share (_mediaDavid);
+      }
+
+      if (optionDestMatrix)
+      {
+        _mediaMatrix = sPaquetMedia_Share (_mediaDavid);
       }
 
+      if (horodate) TrouMedia (_mediaDavid->mediaNo, maintenant);
+
       sDavidSmpte_ArriveePaquetMedia (&david, _mediaDavid);
 
       nbMedia++;
@@ -234,11 +456,16 @@ int main (int argc, char ** argv)
       {
         sBruteSmpte_ArriveePaquetMedia (&brute, _mediaBrute);
       }
+
+      if (optionDestMatrix)
+      {
+        sMatrixSmpte_ArriveePaquetMedia (&matrix, _mediaMatrix);
+      }
     }
 
     // RÉCEPTION D'UN PAQUET FEC ===============================================
 
-    else if ((_fecDavid = sPaquetFec_FromFile (source)) != 0)
+    else if ((_fecDavid = sPaquetFec_FromFile (source, !optionDryRun)) != 0)
     {
       PRINT1 ("paquet FEC lu : ")
       sPaquetFec_Print (_fecDavid);
@@ -249,6 +476,11 @@ int main (int argc, char ** argv)
         _fecBrute = sPaquetFec_Copy (_fecDavid);
       }
 
+      if (optionDestMatrix)
+      {
+        _fecMatrix = sPaquetFec_Copy (_fecDavid);
+      }
+
       sDavidSmpte_ArriveePaquetFec (&david, _fecDavid);
 
       if (optionFBrute > 0)
@@ -256,12 +488,24 @@ int main (int argc, char ** argv)
 
         sBruteSmpte_ArriveePaquetFec (&brute, _fecBrute);
       }
+
+      if (optionDestMatrix)
+      {
+        sMatrixSmpte_ArriveePaquetFec (&matrix, _fecMatrix);
+      }
     }
     else
     {
       eof = true;
     }
 
+    // Latence des paquets que david vient de récupérer
+    if (horodate && david.recovered != recovered)
+    {
+      TrousRecuperes (maintenant);
+      recovered = david.recovered;
+    }
+
     // SIMULE LA LECTURE DE X PAQUETS MEDIA ====================================
 
     while (optionWindow > 0)
@@ -279,6 +523,15 @@ int main (int argc, char ** argv)
       }
     }
 
+    if (optionDestMatrix)
+    {
+      while (optionWindow > 0)
+      {
+        if (!sMatrixSmpte_LecturePaquetMedia(&matrix, optionWindow, destMatrix))
+          break;
+      }
+    }
+
     // APPLIQUE PÉRIODIQUEMENT LA FORCE BRUTE ==================================
 
     if (optionFBrute > 0)
@@ -290,6 +543,8 @@ int main (int argc, char ** argv)
       }
     }
 
+    if (metriques) sDavidSmpte_Publie (&david, metriques);
+
     // Met à jour la barre de pourcentage
     sourcePos = ftell (source);
     PCENT ((double)sourcePos / (double)sourceSize, eof, cFecDecoderLogFile)
@@ -308,13 +563,15 @@ int main (int argc, char ** argv)
 
   oldPcent   = 0;
   sourcePos  = 0;
-  sourceSize = david.media.rbtree.count > 0 ? david.media.rbtree.count : 1;
+  sourceSize = david.media.count > 0 ? david.media.count : 1;
 
   eof = false;
   while (!eof)
   {
     eof = !sDavidSmpte_LecturePaquetMedia (&david, 0, destDavid);
 
+    if (metriques) sDavidSmpte_Publie (&david, metriques);
+
     // Met à jour la barre de pourcentage
     PCENT ((double)sourcePos / (double)sourceSize, sourcePos == sourceSize,
            cFecDecoderLogFile)
@@ -326,7 +583,7 @@ int main (int argc, char ** argv)
 
   oldPcent   = 0;
   sourcePos  = 0;
-  sourceSize = brute.media.rbtree.count > 0 ? brute.media.rbtree.count : 1;
+  sourceSize = brute.media.count > 0 ? brute.media.count : 1;
 
   if (optionFBrute > 0)
   {
@@ -342,6 +599,45 @@ int main (int argc, char ** argv)
     }
   }
 
+  if (optionDestMatrix)
+  {
+    PRINT0_CONc    (cConDefault, cFecDecoderMsgMatrix)
+    PRINT_SET_FILE (cFecDecoderLogFile, "a")
+
+    oldPcent   = 0;
+    sourcePos  = 0;
+    sourceSize = sMatrixSmpte_MediaCount (&matrix);
+    sourceSize = sourceSize > 0 ? sourceSize : 1;
+
+    eof = false;
+    while (!eof)
+    {
+      eof = !sMatrixSmpte_LecturePaquetMedia (&matrix, 0, destMatrix);
+
+      // Met à jour la barre de pourcentage
+      PCENT ((double)sourcePos / (double)sourceSize, sourcePos == sourceSize,
+             cFecDecoderLogFile)
+      sourcePos++;
+    }
+  }
+
+  if (metriques)
+  {
+    // Arrêt de la supervision puis export final (statistiques définitives)
+    __atomic_store_n (&fini, true, __ATOMIC_RELEASE);
+    pthread_join     (superviseur, 0);
+
+    sDavidSmpte_Publie (&david, metriques);
+
+    if (!sDavidSmpte_ExporteMetriques (metriques, optionMetrics))
+    {
+      PRINT0 (cExMetricsExport, optionMetrics)
+      PRINT0 ("\n\n")
+    }
+
+    sMetriques_Release (metriques);
+  }
+
   sDavidSmpte_Print (&david, true);
 
   if (optionFBrute > 0)
@@ -349,6 +645,14 @@ int main (int argc, char ** argv)
     sBruteSmpte_Print (&brute, true);
   }
 
+  if (optionDestMatrix)
+  {
+    sMatrixSmpte_Print (&matrix, true);
+  }
+
+  Latences();
+  free     (latences);
+
   // FIN DE SESSION MEDIA / FEC ================================================
 
   sDavidSmpte_Release (&david);
@@ -359,6 +663,12 @@ int main (int argc, char ** argv)
     fclose (destBrute);
   }
 
+  if (optionDestMatrix)
+  {
+    sMatrixSmpte_Release (&matrix);
+    fclose (destMatrix);
+  }
+
   fclose (source);
   fclose (destRaw);
   fclose (destDavid);
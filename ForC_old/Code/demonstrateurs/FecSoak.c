@@ -0,0 +1,516 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Accelerated soak test of the FEC decoder
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+#include <sys/resource.h>
+
+// Constantes ==================================================================
+
+// Séries échantillonnées (colonnes du fichier CSV) ----------------------------
+enum
+{
+  S_RSS, S_MEDIA, S_CROSS, S_WAITS, S_RECYCLES, S_HAUTEUR, S_P99, SERIES
+};
+
+static const char* cNoms[SERIES] =
+  {"rss_kb", "media_count", "cross_count", "waits_count", "waits_recycled",
+   "wait_tree_height", "ingest_p99_ns"};
+
+// Croissance minimale (absolue) pour être signalée, en plus de la tolérance
+static const double cMarges[SERIES] = {1024, 2, 2, 2, 2, 1, 100};
+
+// Types de données ============================================================
+
+// Un échantillon : position dans le flux et état du décodeur ------------------
+typedef struct
+{
+  double             heures; //. Temps de flux écoulé (heures simulées)
+  unsigned long long media;  //. Paquets média émis
+  unsigned long long recup;  //. Paquets média récupérés (cumul)
+  double             p50;    //. Médiane des appels de l'intervalle (ns)
+  double             p999;   //. 99.9ème percentile de l'intervalle (ns)
+  double             max;    //. Appel le plus lent de l'intervalle (ns)
+
+  double v[SERIES]; //. Valeurs des séries surveillées
+}
+  sEchantillon;
+
+// Variables Globales ==========================================================
+
+static bool     optionAutoKey   = false; //. Automatiquement valider les msgs ?
+static bool     optionDryRun    = false; //. Métadonnées seules (sans payload) ?
+static char*    optionDest      = NULL;  //. Fichier destination (CSV)
+static uint8_t  optionL         = 5;     //. Taille (colonne) de la matrice
+static uint8_t  optionD         = 5;     //. Taille (ligne)   de la matrice
+static bool     optionMatrix2D  = true;  //. FEC ligne en plus des FEC colonne ?
+static unsigned optionLrecov    = PLDS;  //. Taille du payload (octets)
+static double   optionP         = 0.001; //. Probabilité de passer à perte
+static double   optionQ         = 2;     //. Longueur moyenne d'une rafale
+static double   optionHeures    = 24;    //. Durée du flux simulé (heures)
+static double   optionDebit     = 20;    //. Débit du flux simulé (Mb/s)
+static double   optionIntervalle = 15;   //. Période d'échantillonnage (min)
+static double   optionTolerance = 10;    //. Croissance tolérée (%)
+static uint64_t optionSeed      = 1;     //. Graine du générateur aléatoire
+
+static double  nsParTick; //. Durée d'un tick de sInstant_Ticks (ns)
+static sHisto* histo;     //. Durées des appels de l'intervalle (ticks)
+
+// Fonctions privées ===========================================================
+
+// Remet un paquet de FEC reçu à l'algorithme (appel chronométré) --------------
+static void RecoitFec
+  (sDavidSmpte* pDavid, //: Algorithme destinataire
+   sPaquetFec*  pFec)   //: Paquet de FEC reçu
+{
+  uint64_t _ticks = sInstant_Ticks();
+  sDavidSmpte_ArriveePaquetFec (pDavid, pFec);
+  sHisto_Add (histo, sInstant_Ticks() - _ticks);
+}
+
+// Hauteur d'un sous-arbre (déséquilibre dû aux clés qui bouclent) -------------
+//> Nombre de noeuds du plus long chemin racine -> feuille
+static unsigned Hauteur
+  (const sRbNode* pNode) //: Racine du sous-arbre
+{
+  if (!pNode) return 0;
+
+  unsigned _g = Hauteur (pNode->left);
+  unsigned _d = Hauteur (pNode->right);
+
+  return 1 + (_g > _d ? _g : _d);
+}
+
+// Mémoire résidente courante du processus (et non le pic de getrusage) --------
+//> Mémoire résidente en ko
+static long Residente()
+{
+  long  _pages = 0;
+  FILE* _f     = fopen ("/proc/self/statm", "r");
+
+  if (_f)
+  {
+    bool ok = fscanf (_f, "%*s %ld", &_pages) == 1;
+    fclose (_f);
+
+    if (ok) return _pages * (sysconf (_SC_PAGESIZE) / 1024);
+  }
+
+  struct rusage _usage;
+  getrusage (RUSAGE_SELF, &_usage);
+
+  return _usage.ru_maxrss;
+}
+
+// Relève l'état du décodeur et les durées d'appel de l'intervalle -------------
+static void Echantillon
+  (const sDavidSmpte*  pDavid,       //: Algorithme surveillé
+         sEchantillon* pEchantillon) //: Echantillon à remplir
+{
+  unsigned  _recycles = 0;
+  sWaitFec* _wait;
+
+  for (_wait = pDavid->fec.recycled; _wait; _wait = _wait->next) _recycles++;
+
+  unsigned _hCol = Hauteur (pDavid->fec.wait[COL].root);
+  unsigned _hRow = Hauteur (pDavid->fec.wait[ROW].root);
+
+  pEchantillon->recup = pDavid->recovered;
+  pEchantillon->p50   = sHisto_Percentile (histo, 50)   * nsParTick;
+  pEchantillon->p999  = sHisto_Percentile (histo, 99.9) * nsParTick;
+  pEchantillon->max   = sHisto_Percentile (histo, 100)  * nsParTick;
+
+  pEchantillon->v[S_RSS]      = Residente();
+  pEchantillon->v[S_MEDIA]    = pDavid->media.count;
+  pEchantillon->v[S_CROSS]    = pDavid->media.crossCount;
+  pEchantillon->v[S_WAITS]    = pDavid->fec.wait[COL].count +
+                                pDavid->fec.wait[ROW].count;
+  pEchantillon->v[S_RECYCLES] = _recycles;
+  pEchantillon->v[S_HAUTEUR]  = _hCol > _hRow ? _hCol : _hRow;
+  pEchantillon->v[S_P99]      = sHisto_Percentile (histo, 99) * nsParTick;
+
+  sHisto_Reset (histo);
+}
+
+// Compare deux valeurs (qsort) ------------------------------------------------
+static int CompareValeurs (const void* a, const void* b)
+{
+  double _a = *(const double*)a, _b = *(const double*)b;
+
+  return _a < _b ? -1 : _a > _b;
+}
+
+// Médiane d'une série sur les échantillons [pDebut ; pFin[ --------------------
+//> Médiane de la série
+static double Mediane
+  (const sEchantillon* pEchantillons, //: Echantillons relevés
+         unsigned      pDebut,        //: Premier échantillon
+         unsigned      pFin,          //: Fin (exclue)
+         unsigned      pSerie)        //: Série (S_...)
+{
+  double   _v[pFin - pDebut];
+  unsigned no;
+
+  for (no = pDebut; no < pFin; no++)
+  {
+    _v[no - pDebut] = pEchantillons[no].v[pSerie];
+  }
+
+  qsort (_v, pFin - pDebut, sizeof (double), CompareValeurs);
+
+  return _v[(pFin - pDebut) / 2];
+}
+
+// Une série croît-elle de façon monotone ? Après la mise en route (1er    -----
+// dixième), les médianes des quatre quarts doivent croître strictement et -----
+// le dernier dépasser le premier de plus que la tolérance et la marge     -----
+//> Croissance monotone détectée ?
+static bool Croissance
+  (const sEchantillon* pEchantillons, //: Echantillons relevés
+         unsigned      pNombre,       //: Nombre d'échantillons
+         unsigned      pSerie,        //: Série (S_...)
+         double*       pPremier,      //: Médiane du premier quart
+         double*       pDernier)      //: Médiane du dernier quart
+{
+  unsigned _debut = pNombre / 10 > 0 ? pNombre / 10 : 1;
+  unsigned _quart = (pNombre - _debut) / 4, no;
+  double   _q[4];
+
+  *pPremier = *pDernier = 0;
+
+  if (pNombre < _debut + 4) return false; // Trop peu d'échantillons
+
+  for (no = 0; no < 4; no++)
+  {
+    unsigned _fin = no < 3 ? _debut + (no + 1) * _quart : pNombre;
+    _q[no] = Mediane (pEchantillons, _debut + no * _quart, _fin, pSerie);
+  }
+
+  *pPremier = _q[0];
+  *pDernier = _q[3];
+
+  bool _monotone = _q[0] < _q[1] && _q[1] < _q[2] && _q[2] < _q[3];
+
+  return _monotone &&
+         _q[3] > _q[0] * (1 + optionTolerance / 100) + cMarges[pSerie];
+}
+
+// Fonctions publiques =========================================================
+
+// Affiche (et enregistre dans un fichier) le contenu des deux algorithmes -----
+void AssertPrintError()
+{
+}
+
+// Point d'entrée du programme -------------------------------------------------
+//> Code d'erreur renvoyé au système (0 = ok, 1 = croissance détectée)
+int main (int argc, char ** argv)
+{
+  PRINT_INIT_COLOR()
+
+  unsigned no, i;
+
+  // Affiche le titre du logiciel
+  PRINT0_CONc (cConDefault, cFecSoakMsgTitle)
+
+  signed sno;
+  for (sno = 1; sno < argc; sno++)
+  {
+    char* arg = argv[sno];
+
+    if (strcmp (arg, cLabelVerbose1) == 0)
+    {
+      verbose = 1;
+    }
+    else if (strcmp (arg, cLabelVerbose2) == 0)
+    {
+      verbose = 2;
+    }
+    else if (strcmp (arg, cLabelAutoKey) == 0)
+    {
+      optionAutoKey = true;
+    }
+    else if (strcmp (arg, cLabelDryRun) == 0)
+    {
+      optionDryRun = true;
+    }
+    else if (strcmp (arg, cLabelAbout) == 0)
+    {
+      PRINT0_CON    (cConTitle,   "%s", cMsgAboutTGoal)
+      PRINT0_CON    (cConDefault, "%s", cMsgAboutLGoal)
+      PRINT0_CON    (cConTitle,   "%s", cMsgAboutTFunction)
+      PRINT0_CON    (cConDefault, "%s", cFecSoakMsgAboutLFunction)
+      PRINT0_CON    (cConTitle,   "%s", cTheGuyTitle)
+      PRINT0_CON    (cConDefault, "%s", cTheGuyLabel)
+      KeyToContinue (optionAutoKey);
+
+      return 0;
+    }
+    else if (strcmp (arg, cLabelHelp) == 0)
+    {
+      PRINT0_CON    (cConDefault, "%s", cFecSoakMsgHelp)
+      KeyToContinue (optionAutoKey);
+
+      return 0;
+    }
+    else
+    {
+      char* value;
+
+      if ((value = GetParameterValue (arg, cLabelDest, '=')) != 0)
+      {
+        optionDest = value;
+      }
+      else if ((value = GetParameterValue (arg, cLabelL, '=')) != 0)
+      {
+        optionL = atoi (value);
+      }
+      else if ((value = GetParameterValue (arg, cLabelD, '=')) != 0)
+      {
+        optionD = atoi (value);
+      }
+      else if ((value = GetParameterValue (arg, cLabel2DMatrix, '=')) != 0)
+      {
+        unsigned _dim = atoi (value);
+        ASSERTc (_dim >= 1 && _dim <= 2, -1, cExMatrixDim)
+        optionMatrix2D = _dim == 2;
+      }
+      else if ((value = GetParameterValue (arg, cLabelLrecov, '=')) != 0)
+      {
+        optionLrecov = atoi (value);
+      }
+      else if ((value = GetParameterValue (arg, cLabelTewfiqP, '=')) != 0)
+      {
+        double p = fabs (strtod (value, NULL));
+        optionP  = p > 1.0 ? 1.0 : p;
+      }
+      else if ((value = GetParameterValue (arg, cLabelTewfiqQ, '=')) != 0)
+      {
+        double q = fabs (strtod (value, NULL));
+        optionQ  = q < 1.0 ? 1.0 : q;
+      }
+      else if ((value = GetParameterValue (arg, cLabelHours, '=')) != 0)
+      {
+        optionHeures = fabs (strtod (value, NULL));
+      }
+      else if ((value = GetParameterValue (arg, cLabelRate, '=')) != 0)
+      {
+        optionDebit = fabs (strtod (value, NULL));
+      }
+      else if ((value = GetParameterValue (arg, cLabelInterval, '=')) != 0)
+      {
+        optionIntervalle = fabs (strtod (value, NULL));
+      }
+      else if ((value = GetParameterValue (arg, cLabelTolerance, '=')) != 0)
+      {
+        optionTolerance = fabs (strtod (value, NULL));
+      }
+      else if ((value = GetParameterValue (arg, cLabelSeed, '=')) != 0)
+      {
+        optionSeed = strtoull (value, NULL, 10);
+      }
+      else // Un paramètre incorrect
+      {
+        PRINT0_CON    (cConError, "%s", cFecSoakMsgSyntax)
+        PRINT0_CON    (cConError, "%s", cFecSoakMsgHelp)
+        KeyToContinue (optionAutoKey);
+
+        return 0;
+      }
+    }
+  }
+
+  if (optionDest == 0) optionDest = (char*)cFecSoakDest;
+
+  ASSERTc (optionL >= 1 && optionD >= 1, -1, cExMatrixMin)
+  ASSERTc (optionDebit > 0 && optionIntervalle > 0, -1, cExSoakRate)
+
+  ASSERT (optionLrecov > 0 && optionLrecov <= GENERATEUR_PAYLOAD_MAX, -1,
+          "Payload size is limited to %u bytes", GENERATEUR_PAYLOAD_MAX)
+
+  // Le buffer média est circulaire sur 2^16 numéros de séquence
+  ASSERTc (2u * optionL * optionD < 0x8000, -1, cExMatrixMax)
+
+  // DURÉE DU FLUX SIMULÉ ======================================================
+
+  // Paquets média par seconde de flux (payloads seuls, entêtes ignorés)
+  double _parSeconde = optionDebit * 1e6 / (8.0 * optionLrecov);
+
+  unsigned long long _total     = optionHeures * 3600 * _parSeconde;
+  unsigned long long _intervalle = optionIntervalle * 60 * _parSeconde;
+
+  if (_intervalle == 0) _intervalle = 1;
+
+  unsigned      _maxEch       = _total / _intervalle + 2;
+  sEchantillon* _echantillons = calloc (_maxEch, sizeof (sEchantillon));
+  ASSERTc (_echantillons, -1, cExAllocateMemory)
+
+  nsParTick = sInstant_NsParTick();
+  histo     = sHisto_New();
+  ASSERTc (histo, -1, cExAllocateMemory)
+
+  PRINT0_FILE (cFecSoakLogFile, "w",
+              "L:%u, D:%u, matrix:%u, lrecov:%u, p:%g, q:%g, dryrun:%u\n"
+              "hours:%g, rate:%g Mb/s (%.0f media/s), interval:%g min, "
+              "media:%llu, seed:%llu\n\n",
+              optionL, optionD, optionMatrix2D ? 2 : 1, optionLrecov,
+              optionP, optionQ, optionDryRun, optionHeures, optionDebit,
+              _parSeconde, optionIntervalle, _total,
+              (unsigned long long)optionSeed)
+
+  // FLUX ACCÉLÉRÉ : GÉNÉRATION, CANAL, DÉCODAGE ET ÉCHANTILLONNAGE ===========
+
+  PRINT0_CONc    (cConDefault, cFecSoakMsg1of1)
+  PRINT_SET_FILE (cFecSoakLogFile, "a")
+
+  unsigned _LD     = optionL * optionD;
+  sMediaNo _window = 2 * _LD;
+  unsigned _taille = optionDryRun ? 0 : optionLrecov;
+
+  sGenerateur* _gen   = sGenerateur_New (optionL, optionD, optionMatrix2D,
+                                         _taille, optionP, optionQ, optionSeed);
+  sDavidSmpte  _david = sDavidSmpte_New (false, optionDryRun);
+  ASSERTc (_gen, -1, cExAllocateMemory)
+
+  unsigned long long _emis    = 0;
+  unsigned long long _suivant = _intervalle;
+  unsigned           _nbEch   = 0;
+
+  double oldPcent = 0, newPcent = 0;
+
+  while (_emis < _total)
+  {
+    for (i = 0; i < _LD; i++)
+    {
+      sPaquetMedia* _media = sGenerateur_Encode (_gen);
+      ASSERTc (_media, -1, cExMediaForge)
+
+      sGenerateur_Transmet (_gen, _media);
+
+      if (_gen->media)
+      {
+        uint64_t _ticks = sInstant_Ticks();
+        sDavidSmpte_ArriveePaquetMedia (&_david, _gen->media);
+        sHisto_Add (histo, sInstant_Ticks() - _ticks);
+      }
+
+      if (_gen->fec[COL]) RecoitFec (&_david, _gen->fec[COL]);
+      if (_gen->fec[ROW]) RecoitFec (&_david, _gen->fec[ROW]);
+
+      while (sDavidSmpte_LecturePaquetMedia (&_david, _window, NULL));
+    }
+
+    _emis += _LD;
+
+    if (_emis >= _suivant && _nbEch < _maxEch)
+    {
+      sEchantillon* _ech = &_echantillons[_nbEch++];
+
+      _ech->heures = _emis / _parSeconde / 3600;
+      _ech->media  = _emis;
+      Echantillon (&_david, _ech);
+
+      _suivant += _intervalle;
+
+      PRINT1 ("%8.3f h : rss=%.0f ko media=%.0f cross=%.0f waits=%.0f "
+              "recycles=%.0f hauteur=%.0f p99=%.0f ns max=%.0f ns\n",
+              _ech->heures, _ech->v[S_RSS], _ech->v[S_MEDIA],
+              _ech->v[S_CROSS], _ech->v[S_WAITS], _ech->v[S_RECYCLES],
+              _ech->v[S_HAUTEUR], _ech->v[S_P99], _ech->max)
+
+      PCENT ((double)_emis / _total, false, cFecSoakLogFile)
+    }
+  }
+
+  PCENT (1.0, true, cFecSoakLogFile)
+
+  while (sDavidSmpte_LecturePaquetMedia (&_david, 0, NULL));
+
+  unsigned _recup  = _david.recovered;
+  unsigned _manque = _david.unrecoveredOnReading;
+
+  sDavidSmpte_Release (&_david);
+  sGenerateur_Release (_gen);
+
+  // ENREGISTREMENT DES ÉCHANTILLONS (CSV) =====================================
+
+  FILE*    dest = fopen (optionDest, "w");
+  ASSERTc (dest, -1, cExDestFile)
+
+  fprintf (dest, "hours,media,recovered,ingest_p50_ns,ingest_p999_ns,"
+                 "ingest_max_ns");
+  for (i = 0; i < SERIES; i++) fprintf (dest, ",%s", cNoms[i]);
+  fprintf (dest, "\n");
+
+  for (no = 0; no < _nbEch; no++)
+  {
+    const sEchantillon* _ech = &_echantillons[no];
+
+    fprintf (dest, "%.4f,%llu,%llu,%.1f,%.1f,%.1f", _ech->heures, _ech->media,
+             _ech->recup, _ech->p50, _ech->p999, _ech->max);
+    for (i = 0; i < SERIES; i++) fprintf (dest, ",%.1f", _ech->v[i]);
+    fprintf (dest, "\n");
+  }
+
+  fclose (dest);
+
+  // VERDICT : CROISSANCE MONOTONE DES SÉRIES ? ================================
+
+  unsigned _croissances = 0;
+
+  PRINT0 ("\nmedia:%llu, recovered:%u, unrecovered on reading:%u, "
+          "samples:%u\n\n", _emis, _recup, _manque, _nbEch)
+
+  PRINT0 ("%-18s %14s %14s  %s\n", "serie", "1er quart", "dernier quart",
+          "verdict")
+
+  for (i = 0; i < SERIES; i++)
+  {
+    double _premier, _dernier;
+    bool   _croit = Croissance (_echantillons, _nbEch, i, &_premier, &_dernier);
+
+    PRINT0 ("%-18s %14.1f %14.1f  %s\n", cNoms[i], _premier, _dernier,
+            _croit ? "CROISSANCE" : "ok")
+
+    if (_croit) _croissances++;
+  }
+
+  free           (_echantillons);
+  sHisto_Release (histo);
+
+  // ===========================================================================
+
+  if (_croissances > 0)
+  {
+    PRINT0_CON (cConError, cFecSoakMsgGrowth, _croissances)
+  }
+
+  PRINT0_CONc   (cConDefault, cMsgEnded)
+  KeyToContinue (optionAutoKey);
+
+  return _croissances > 0;
+}
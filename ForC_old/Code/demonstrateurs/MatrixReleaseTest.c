@@ -0,0 +1,175 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Release of a dispatched sMatrixSmpte (run under LSan)
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Remarque : la cible Debug de MatrixReleaseTest.cbp est compilée avec
+//            -fsanitize=address, LeakSanitizer signale à la sortie tout bloc
+//            non libéré (chronos, comptabilité ou FEC du générique cédé, ...)
+
+// Constantes de test ==========================================================
+
+const unsigned OPTION_MATRICES = 200;  //. Matrices émises par cas
+const double   OPTION_P        = 0.01; //. Probabilité de passer à perte
+const double   OPTION_Q        = 2;    //. Longueur moyenne d'une rafale
+
+// Types de données ============================================================
+
+// Un cas de test : flux émis et décodeur que sMatrixSmpte doit choisir --------
+typedef struct
+{
+  uint8_t       L;          //. Taille (colonne) de la matrice de FEC
+  uint8_t       D;          //. Taille (ligne)   de la matrice de FEC
+  bool          matrix2D;   //. FEC ligne en plus des FEC colonne ?
+  unsigned      matrices1D; //. Matrices sans FEC ligne => 1D (0 = jamais)
+  bool          fec;        //. FEC transmis (sinon flux média seul, indécis)
+  eMatrixProfil profil;     //. Décodeur attendu
+}
+  sCas;
+
+static const sCas cCas[] =
+{
+  { 5,  5, true,  0, true,  MATRIX_5x5       },
+  {10, 10, true,  0, true,  MATRIX_10x10     },
+  {20,  5, true,  0, true,  MATRIX_20x5      },
+  { 5,  5, false, 3, true,  MATRIX_1D        },
+  { 7,  5, true,  0, true,  MATRIX_GENERIQUE },
+  { 5,  7, true,  0, true,  MATRIX_GENERIQUE }, // L d'un profil, D différent
+  {10,  5, true,  0, true,  MATRIX_GENERIQUE },
+  { 5,  5, true,  0, false, MATRIX_INDECIS   }
+};
+
+#define NB_CAS (sizeof (cCas) / sizeof (cCas[0]))
+
+// Fonctions privées ===========================================================
+
+// Emet un flux à travers un décodeur à dispatch puis le libère ----------------
+//> Le décodeur attendu a-t-il été choisi ?
+static bool Cas
+  (const sCas* pCas,  //: Cas à tester
+   uint64_t    pSeed) //: Graine du flux
+{
+  sGenerateur* _gen = sGenerateur_New (pCas->L, pCas->D, pCas->matrix2D, PLDS,
+                                       OPTION_P, OPTION_Q, pSeed);
+  ASSERTc (_gen, false, cExAllocateMemory)
+
+  sMatrixSmpte _matrix = sMatrixSmpte_New (false, pCas->matrices1D);
+  sMediaNo     _window = 2 * pCas->L * pCas->D;
+
+  unsigned no, k, _nb = OPTION_MATRICES * pCas->L * pCas->D;
+
+  for (no = 0; no < _nb; no++)
+  {
+    sPaquetMedia* _media = sGenerateur_Encode (_gen);
+    ASSERTc (_media, false, cExMediaForge)
+
+    sGenerateur_Transmet (_gen, _media);
+
+    if (_gen->media) sMatrixSmpte_ArriveePaquetMedia (&_matrix, _gen->media);
+
+    for (k = COL; k <= ROW; k++)
+    {
+      if (!_gen->fec[k]) continue;
+
+      if (pCas->fec) sMatrixSmpte_ArriveePaquetFec (&_matrix, _gen->fec[k]);
+      else           sPaquetFec_Release            (_gen->fec[k]);
+    }
+
+    while (sMatrixSmpte_LecturePaquetMedia (&_matrix, _window, NULL));
+  }
+
+  eMatrixProfil _profil = _matrix.profil;
+
+  sMatrixSmpte_Release (&_matrix);
+  sGenerateur_Release  (_gen);
+
+  PRINT0 ("L=%-2u D=%-2u %uD : profil %d (attendu %d)\n", pCas->L, pCas->D,
+          pCas->matrix2D ? 2 : 1, _profil, pCas->profil)
+
+  return _profil == pCas->profil;
+}
+
+// Un buffer média détaché de sa comptabilité y est entièrement décompté -------
+//> Comptabilité revenue à 0 ?
+static bool Detache()
+{
+  sMemoire*    _memoire = sMemoire_New();
+  sBufferMedia _buffer  = sBufferMedia_New (0);
+  ASSERTc (_memoire, false, cExAllocateMemory)
+
+  sBufferMedia_Comptabilise (&_buffer, _memoire);
+
+  sMediaNo no;
+
+  for (no = 0; no < 100; no++)
+  {
+    sPaquetMedia* _media = sPaquetMedia_Forge (no, no, PAYLOAD_TYPE, PLDS, 0);
+    ASSERTc (_media, false, cExMediaForge)
+
+    sBufferMedia_AddByReference (&_buffer, _media, false);
+  }
+
+  sBufferMedia_Comptabilise (&_buffer, 0);
+
+  bool ok = _memoire->total.objets == 0 && _memoire->total.octets == 0 &&
+            _memoire->total.maxOctets > 0;
+
+  sBufferMedia_Release (&_buffer);
+  sMemoire_Release     (_memoire);
+
+  PRINT0 ("detache : %s\n", ok ? "ok" : "comptabilite non nulle")
+
+  return ok;
+}
+
+// Fonctions publiques =========================================================
+
+// Affiche (et enregistre dans un fichier) le contenu des deux algorithmes -----
+void AssertPrintError()
+{
+}
+
+// Point d'entrée du programme -------------------------------------------------
+//> Code d'erreur renvoyé au système (0 = ok)
+int main()
+{
+  unsigned no, _echecs = 0;
+
+  PRINT0 ("\n--------------------------------\n"
+          "\nsMatrixSmpte release test\n\n")
+
+  for (no = 0; no < NB_CAS; no++)
+  {
+    if (!Cas (&cCas[no], no + 1)) _echecs++;
+  }
+
+  if (!Detache()) _echecs++;
+
+  PRINT0 ("\n%u echec(s)\n", _echecs)
+
+  return _echecs > 0;
+}
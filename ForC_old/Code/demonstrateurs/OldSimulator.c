@@ -27,6 +27,8 @@
 
 #include "../smpte.h"
 
+#include <pthread.h>
+
 // Constantes de test (voir aussi types.h) =====================================
 
 // Remarque : si les deux algorithmes sont actifs et que OPTION_VALIDATION est
@@ -34,6 +36,13 @@
 //            comparé à buffer média traité par l'algorithme de force brute en
 //            vue de valider le premier.
 
+// Remarque : en validation, les configurations de pertes sont réparties sur
+//            OPTION_THREADS ouvriers (chacun ses propres algorithmes). Les
+//            configurations ne différant que par une permutation des lignes
+//            (ou des colonnes) sont équivalentes : seules celles dont les
+//            lignes (ou colonnes) sont triées sont simulées, pondérées par
+//            leur nombre de permutations distinctes.
+
 //     <-----L (cols)----->
 //
 //  |  p 01 p 02 p 03 p 04  l 01      p nb = paquet nb média data
@@ -47,366 +56,569 @@
 
 const bool OPTION_DAVID = true; //. Utiliser l'algorithme optimisé ?
 const bool OPTION_BRUTE = false; //. Utiliser l'algorithme brute    ?
+const bool OPTION_ORACLE = true; //. Prédire (et vérifier david) via l'oracle ?
 
 const double OPTION_TEWFIQ_P = 0.001; //. Probabilité de passer de ok à perte /1
 const double OPTION_TEWFIQ_Q = 0.5; //. Probabilité de passer de perte à ok /1
+const uint64_t OPTION_SEED   = 1;   //. Graine du générateur de tewfiq
 
 const unsigned OPTION_LRECOV = PLDS; //. Longueur du payload (resXor)
+const bool     OPTION_DRY_RUN = true; //. Métadonnées seules (aucun payload) ?
 const sMediaNo OPTION_MEDIA0 = 0;    //. Premier no de séquence (initial)
 const sMediaNo OPTION_BUFFER = 4000; //. Nb de media stockés avant lecture
+const unsigned OPTION_THREADS = 0;   //. Nb d'ouvriers (0 = nb de processeurs)
 
 const uint8_t  OPTION_L  = 10;      //. Taille (colonne) de la matrice de FEC
 const uint8_t  OPTION_D  = 10;      //. Taille (ligne)   de la matrice de FEC
 const unsigned OPTION_LD = 10*10;   //. Produit des deux paramètres (L*D)
 const uint8_t  OPTION_DECALAGE = 0; //. Décalage constant sur colonne ?
 
+#define OUVRIERS_MAX 256 //. Nombre maximum d'ouvriers (threads)
+
+// Types de données ============================================================
+
+// Un ouvrier : ses propres algorithmes et ses statistiques (pondérées) --------
+typedef struct
+{
+  pthread_t   thread; //. Thread de l'ouvrier
+  sDavidSmpte david;  //. Algorithme optimisé de l'ouvrier
+  sBruteSmpte brute;  //. Algorithme force brute de l'ouvrier
+  sMediaNo    media0; //. Prochain no de séquence média
+  sFecNo      uniId;  //. Prochain no de séquence FEC
+
+  unsigned long long configs; //. Configurations simulées (canoniques)
+  unsigned           erreurs; //. Divergences entre algorithmes
+
+  double poids;     //. Configurations couvertes (permutations comprises)
+  double pertes;    //. Paquets média perdus       (pondérés)
+  double recup;     //. Paquets média récupérables (pondérés)
+  double toutRecup; //. Configurations entièrement récupérées (pondérées)
+}
+  sOuvrier;
+
 // Variables Globales ==========================================================
 
-static sTewfiq    tewfiq; //. Notre variable d'utilisation de tewfiq
-static sDavidSmpte david; //. Notre variable d'utilisation de l'algo optimisé
-static sBruteSmpte brute; //. Notre variable d'utilisation de l'algo force brute
-static bool        init = false; //. Algorithmes initialisés ?
+static sTewfiq  tewfiq; //. Notre variable d'utilisation de tewfiq
+static sOuvrier ouvrier[OUVRIERS_MAX]; //. Ouvriers (un seul hors validation)
+static unsigned nbOuvriers = 1;        //. Nombre d'ouvriers utilisés
+static bool     init = false; //. Algorithmes initialisés ?
 
-// Fonctions publiques =========================================================
+static pthread_mutex_t tacheMutex = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t        tacheV0    = 0;     //. Prochaine tâche : 1ère ligne
+static uint32_t        tacheV1    = 0;     //. Prochaine tâche : 2ème ligne
+static bool            tacheFin   = false; //. Toutes les tâches distribuées ?
 
-// Affiche (et enregistre dans un fichier) le contenu des deux algorithmes -----
-void AssertPrintError()
+static bool     parLignes; //. Configurations triées par lignes (ou colonnes) ?
+static unsigned nbLignes;  //. Nombre de lignes (ou colonnes) triées
+static uint32_t valMax;    //. Valeur max d'une ligne (ou colonne) = 2^bits-1
+
+// Fonctions privées ===========================================================
+
+// Nombre de multi-ensembles de pN valeurs parmi 2^pBits (configurations) ------
+//> Nombre de configurations canoniques
+static double Multisets
+  (unsigned pBits, //: Nombre de bits d'une ligne (ou colonne)
+   unsigned pN)    //: Nombre de lignes (ou colonnes)
 {
-  if (!init) return;
+  double   _n = ldexp (1.0, pBits), _c = 1.0;
+  unsigned i;
 
-  if (OPTION_DAVID) sDavidSmpte_Print (&david, true);
-  if (OPTION_BRUTE) sBruteSmpte_Print (&brute, true);
+  for (i = 1; i <= pN; i++) _c = _c * (_n + pN - i) / i;
+
+  return _c;
 }
 
-// Point d'entrée du programme -------------------------------------------------
-//> Code d'erreur renvoyé au système (0 = ok)
-int main()
+// Poids d'une configuration triée : nombre de permutations distinctes des -----
+// pN lignes (ou colonnes) = pN! / produit des (répétitions !)             -----
+//> Nombre de configurations équivalentes
+static double Poids
+  (const uint32_t* pV, //: Lignes (ou colonnes) triées
+   unsigned        pN) //: Nombre de lignes (ou colonnes) considérées
 {
-  unsigned no;
+  double   _poids = 1.0;
+  unsigned i, _rep = 1;
 
-  //freopen ("SimulateurComplet.log", "w", stdout);
+  for (i = 1; i < pN; i++)
+  {
+    _rep   = pV[i] == pV[i-1] ? _rep + 1 : 1;
+    _poids = _poids * (i+1) / _rep;
+  }
 
-  PRINT1 ("\n--------------------------------\n"
-          "\nFec Simulator by David Fischer !\n\n")
+  return _poids;
+}
 
-  ASSERT (OPTION_DAVID || OPTION_BRUTE,    -1, "DAVID or/and BRUTE must be set")
-  ASSERT (OPTION_LD == OPTION_L * OPTION_D,-1, "LD must be equal to L * D")
+// Modifie une ligne (ou colonne) du motif de pertes : seuls les bits ----------
+// qui changent sont appliqués (un seul en parcours de Gray)          ----------
+//> Variation du nombre de paquets média perdus
+static int MotifLigne
+  (sOracleSmpte* pMotif,    //: Motif de pertes à mettre à jour
+   unsigned      pNo,       //: No de la ligne (ou colonne) modifiée
+   uint32_t      pAncienne, //: Valeur actuelle de la ligne (ou colonne)
+   uint32_t      pNouvelle) //: Nouvelle valeur de la ligne (ou colonne)
+{
+  uint32_t _diff = pAncienne ^ pNouvelle;
 
-  // SMPTE 2022 définit quelques limites standards
-  ASSERT (OPTION_LD <= 100,                    -1,"SMPTE 2022 ... L * D <= 100")
-  ASSERT ((OPTION_L >= 1) && (OPTION_L <= 20), -1,"SMPTE 2022 ... 1 <= L <= 20")
-  ASSERT ((OPTION_D >= 4) && (OPTION_D <= 20), -1,"SMPTE 2022 ... 4 <= D <= 20")
+  if (parLignes)
+  {
+    pMotif->media[pNo] = pNouvelle;
+  }
+  else
+  {
+    for (; _diff; _diff &= _diff - 1)
+      pMotif->media[__builtin_ctz (_diff)] ^= 1u << pNo;
+  }
 
-  srand (clock()); // Si besoin de nombres aléatoires
-  tewfiq = sTewfiq_New2 (OPTION_TEWFIQ_P, OPTION_TEWFIQ_Q);
+  return __builtin_popcount (pNouvelle) - __builtin_popcount (pAncienne);
+}
 
-  sChampBits configNo = sChampBits_New(); // Numéro de config en cours de test
-  sChampBits limiteNo = sChampBits_New(); // Numéro de config limite (2^LD)
+// Distribue la tâche suivante (les 2 premières lignes triées de la config) ----
+// Remarque : file partagée, chaque ouvrier libre se sert (pas d'attente)   ----
+//> Une tâche a-t-elle été attribuée ?
+static bool TacheSuivante
+  (uint32_t* pV0, //: 1ère ligne (ou colonne) de la tâche
+   uint32_t* pV1) //: 2ème ligne (ou colonne) de la tâche
+{
+  pthread_mutex_lock (&tacheMutex);
 
-  sChampBits_SetBit (&limiteNo, OPTION_LD, true); // Impose la limite 2^LD
+  bool ok = !tacheFin;
 
-  // INITIALISATION DE SESSION MEDIA / FEC =====================================
+  if (ok)
+  {
+    *pV0 = tacheV0;
+    *pV1 = tacheV1;
 
-  sMediaNo media0 = OPTION_MEDIA0;
-  sFecNo   uniId  = 0;
+    if (nbLignes < 2 || tacheV1 == valMax)
+    {
+      tacheFin = tacheV0 == valMax;
+      tacheV0++;
+      tacheV1 = tacheV0;
+    }
+    else
+    {
+      tacheV1++;
+    }
+  }
 
-  if (OPTION_DAVID) david = sDavidSmpte_New (false);
-  if (OPTION_BRUTE) brute = sBruteSmpte_New (false);
+  pthread_mutex_unlock (&tacheMutex);
 
-  init = true;
+  return ok;
+}
 
-  // DÉMARRAGE DE SESSION MEDIA / FEC ==========================================
+// Simule une matrice : arrivée des paquets média non perdus et des paquets ----
+// de FEC, vérifications puis lecture (jusqu'à pBuffer paquets gardés)      ----
+//> Nombre de paquets média récupérés
+static unsigned Simule
+  (sOuvrier*           pOuvrier, //: Ouvrier (algorithmes) à utiliser
+   const sOracleSmpte* pMotif,   //: Motif de pertes de la matrice
+   sMediaNo            pBuffer)  //: Nb de paquets média gardés après lecture
+{
+  unsigned no;
 
-  while (true)
-  {
-    #ifdef OPTION_VALIDATION
+  // Dry run : paquets forgés sans payload, seule la comptabilité est simulée
+  unsigned lrecov = OPTION_DRY_RUN ? 0 : OPTION_LRECOV;
 
-      PRINT2   ("\n============= configuration n° ")
-      DETAILS2 (sChampBits_Print (&configNo);)
-      PRINT2   ("=============\n\n")
+  sMediaNo mediaB = pOuvrier->media0;
 
-    #endif
+  // Simule l'arrivée des paquets média
 
-    sMediaNo mediaB = media0;
+  for (no = 0; no < OPTION_LD && (OPTION_DAVID || OPTION_BRUTE); no++)
+  {
+    if (sOracleSmpte_GetPerte (pMotif, no)) continue;
 
-    // Simule l'arrivée des paquets média
+    // Un seul paquet forgé, partagé par les algorithmes qui le reçoivent
+    sPaquetMedia* _media = sPaquetMedia_Forge
+      ((sMediaNo)(mediaB + no), 0, PAYLOAD_TYPE, lrecov, 0);
+    ASSERTc (_media, 0, cExMediaForge)
 
-    for (no = 0; no < OPTION_LD; no++)
-    {
-      sPaquetMedia *_mediaDavid, *_mediaBrute;
+    if (OPTION_DAVID)
+      sDavidSmpte_ArriveePaquetMedia
+        (&pOuvrier->david, sPaquetMedia_Share (_media));
+    if (OPTION_BRUTE)
+      sBruteSmpte_ArriveePaquetMedia
+        (&pOuvrier->brute, sPaquetMedia_Share (_media));
 
-// FIXME
-      /*if (OPTION_DAVID) _mediaDavid = sPaquetMedia_Forge (media0, 0, 0);
-      if (OPTION_BRUTE) _mediaBrute = sPaquetMedia_Forge (media0, 0, 0);*/
+    sPaquetMedia_Release (_media); // Libère la référence locale
+  }
 
-      media0++;
+  pOuvrier->media0 += OPTION_LD;
 
-      #ifdef OPTION_VALIDATION
-      if (!sChampBits_GetBit (&configNo, no))
-      {
-        tewfiq.nombreOk++;
-      #else
-      if (sTewfiq_IsOkayOrLost (&tewfiq))
-      {
-      #endif
-        if (OPTION_DAVID) sDavidSmpte_ArriveePaquetMedia (&david, _mediaDavid);
-        if (OPTION_BRUTE) sBruteSmpte_ArriveePaquetMedia (&brute, _mediaBrute);
-      }
-      else
-      {
-      #ifdef OPTION_VALIDATION
-        tewfiq.nombrePertes++;
-      #endif
-        if (OPTION_DAVID) sPaquetMedia_Release (_mediaDavid);
-        if (OPTION_BRUTE) sPaquetMedia_Release (_mediaBrute);
-      }
-    }
-
-    PRINT2 ("\n")
+  // Simule l'arrivée des paquets de FEC ligne puis colonne (positions
+  // relatives à mediaB : pas de souci lorsque le no de séquence boucle)
 
-    // Simule l'arrivée des paquets de FEC ligne
+  eFecD _D;
 
-    for (no = 0; /*no < OPTION_D*/; no++)
+  for (_D = ROW; (OPTION_DAVID || OPTION_BRUTE) && _D <= ROW; _D--)
+  {
+    for (no = 0; no < (_D == ROW ? OPTION_D : OPTION_L); no++)
     {
-      sMediaNo _SNBase = mediaB + no * OPTION_L;
+      unsigned _rel = _D == ROW ? no * OPTION_L :
+                                  no * (1 + OPTION_L * OPTION_DECALAGE);
 
-      sPaquetFec* _fec = sPaquetFec_Forge
-        (uniId, OPTION_LRECOV, _SNBase, 0, 0, OPTION_L, OPTION_D, ROW, 0);
+      unsigned _dernier =
+        _rel + (_D == ROW ? OPTION_L - 1 : OPTION_L * (OPTION_D - 1));
 
-      // TODO quand c'est modulo ... blem
-      if (_fec->DWORD0.SNBase_low_bits +
-          _fec->DWORD3.Offset * (_fec->DWORD3.NA-1) >= media0)
-      {
-        sPaquetFec_Release (_fec);
-        break;
-      }
+      if (_dernier >= OPTION_LD) break;
 
-      if (OPTION_DAVID)
-      {
-        sPaquetFec* _fecDavid = sPaquetFec_Copy (_fec);
-        sDavidSmpte_ArriveePaquetFec (&david, _fecDavid);
-      }
+      sPaquetFec* _fec = sPaquetFec_Forge
+        (pOuvrier->uniId++, lrecov, (sMediaNo)(mediaB + _rel), 0, 0,
+         OPTION_L, OPTION_D, _D, 0);
+      ASSERTc (_fec, 0, cExFecForge)
 
+      if (OPTION_DAVID)
+        sDavidSmpte_ArriveePaquetFec (&pOuvrier->david, sPaquetFec_Copy (_fec));
       if (OPTION_BRUTE)
-      {
-        sPaquetFec* _fecBrute = sPaquetFec_Copy (_fec);
-        sBruteSmpte_ArriveePaquetFec (&brute, _fecBrute);
-      }
+        sBruteSmpte_ArriveePaquetFec (&pOuvrier->brute, sPaquetFec_Copy (_fec));
 
       sPaquetFec_Release (_fec);
-      uniId++;
     }
 
-    PRINT2 ("\n")
+    if (_D == COL) break;
+  }
 
-    // Simule l'arrivée des paquets de FEC colonne
+  if (OPTION_BRUTE) sBruteSmpte_AppliqueFec (&pOuvrier->brute);
 
-    for (no = 0; /*no < OPTION_L*/; no++)
-    {
-      //sMediaNo _mediaNo  = no   + nb * OPTION_L;
-      sMediaNo _SNBase = mediaB + no * (1 + OPTION_L * OPTION_DECALAGE);
+  // Paquets média récupérés (selon l'oracle, vérifié par les algorithmes)
 
-      sPaquetFec* _fec = sPaquetFec_Forge
-      (uniId, OPTION_LRECOV, _SNBase, 0, 0, OPTION_L, OPTION_D, COL, 0);
+  sOracleSmpte _recup = *pMotif;
+  unsigned     _nb    = 0;
 
-      // TODO quand c'est modulo ... blem
-      if (_fec->DWORD0.SNBase_low_bits +
-          _fec->DWORD3.Offset * (_fec->DWORD3.NA-1) >= media0)
-      {
-        sPaquetFec_Release (_fec);
-        break;
-      }
+  if (OPTION_ORACLE)
+  {
+    _nb = sOracleSmpte_Recuperables (pMotif, &_recup);
+  }
 
-      if (OPTION_DAVID)
-      {
-        sPaquetFec* _fecDavid = sPaquetFec_Copy (_fec);
-        sDavidSmpte_ArriveePaquetFec (&david, _fecDavid);
-      }
+  for (no = 0; no < OPTION_LD && OPTION_DAVID; no++)
+  {
+    if (!sOracleSmpte_GetPerte (pMotif, no)) continue;
 
-      if (OPTION_BRUTE)
-      {
-        sPaquetFec* _fecBrute = sPaquetFec_Copy (_fec);
-        sBruteSmpte_ArriveePaquetFec (&brute, _fecBrute);
-      }
+    bool _present =
+      sBufferMedia_IsPresent (&pOuvrier->david.media, (sMediaNo)(mediaB + no));
 
-      sPaquetFec_Release (_fec);
-      uniId++;
+    if (!OPTION_ORACLE)
+    {
+      _nb += _present;
+    }
+    else if (_present != sOracleSmpte_GetPerte (&_recup, no))
+    {
+      PRINT0 ("l'oracle et david divergent sur le paquet %u !\n", no)
+      pOuvrier->erreurs++;
     }
+  }
 
-    if (OPTION_BRUTE) sBruteSmpte_AppliqueFec (&brute);
+  if (OPTION_DAVID && OPTION_BRUTE &&
+      pOuvrier->david.media.count != pOuvrier->brute.media.count)
+  {
+    PRINT0 ("avec la force brute t'es cuit %u, %u !\n",
+            pOuvrier->david.media.count, pOuvrier->brute.media.count)
+    pOuvrier->erreurs++;
+  }
 
-    #ifdef OPTION_VALIDATION
+  #ifdef OPTION_DEMO
 
-      if (OPTION_DAVID && OPTION_BRUTE)
-      {
-        if (david.media.rbtree.count != brute.media.rbtree.count)
-        {
-          PRINT1 ("avec la force brute t'es cuit %u, %u !\n",
-                  david.media.rbtree.count, brute.media.rbtree.count)
+    sOracleSmpte_Print (pMotif);
+    PRINT1 ("oracle : %u recuperables\n\n", _nb)
 
-          assert (david.media.rbtree.count == brute.media.rbtree.count);
-        }
-      }
+  #endif
+
+  // SIMULE LA LECTURE DE X PAQUETS MEDIA ====================================
 
-    #endif
+  if (OPTION_DAVID)
+  {
+    while (sDavidSmpte_LecturePaquetMedia (&pOuvrier->david, pBuffer, NULL));
+  }
 
-    // SIMULE LA LECTURE DE X PAQUETS MEDIA ====================================
+  if (OPTION_BRUTE)
+  {
+    while (sBruteSmpte_LecturePaquetMedia (&pOuvrier->brute, pBuffer, NULL));
+  }
 
-    #ifndef OPTION_VALIDATION
+  pOuvrier->configs++;
 
-      if (OPTION_DAVID)
+  return _nb;
+}
+
+// Corps d'un ouvrier de validation : prend des tâches jusqu'à épuisement   ----
+// et simule toutes les configurations triées qui en découlent              ----
+// Remarque : la dernière ligne (ou colonne) est parcourue en code de Gray, ----
+//            le motif de pertes, le nombre de pertes et le poids sont mis  ----
+//            à jour incrémentalement (un bit par pas) ; les valeurs qui    ----
+//            ne sont pas triées sont sautées (autre config. équivalente)   ----
+//> Rien (l'ouvrier lui-même)
+static void* Ouvrier
+  (void* pOuvrier) //: Ouvrier (sOuvrier*)
+{
+  sOuvrier* _ouvrier = pOuvrier;
+
+  uint32_t _v[ORACLE_MAX];
+  unsigned i, k, n = nbLignes - 1; // n = no de la dernière ligne
+
+  while (TacheSuivante (&_v[0], &_v[1]))
+  {
+    sOracleSmpte _motif  = sOracleSmpte_New (OPTION_L, OPTION_D, true);
+    int          _pertes = 0;
+
+    // Lignes (ou colonnes) suivantes : triées, à partir de la 2ème
+    for (k = 0; k < nbLignes; k++)
+    {
+      uint32_t _val = k < 2 ? _v[k] : k < n ? _v[1] : 0;
+
+      _pertes += MotifLigne (&_motif, k, 0, _val);
+      _v[k]    = _val;
+    }
+
+    while (true)
+    {
+      // Poids des n premières lignes et répétitions de la n-ème
+      double   _poids = Poids (_v, n);
+      unsigned _rep   = 1;
+
+      for (k = n-1; k > 0 && _v[k-1] == _v[n-1]; k--) _rep++;
+
+      // Dernière ligne en code de Gray (de _v[n] = g(0) à g(valMax))
+      for (i = 0; i <= valMax; i++)
       {
-        while (true)
+        if (i > 0)
         {
-          if (!sDavidSmpte_LecturePaquetMedia (&david, OPTION_BUFFER, NULL))
-            break;
+          uint32_t _gray = _v[n] ^ (1u << __builtin_ctz (i));
+
+          _pertes += MotifLigne (&_motif, n, _v[n], _gray);
+          _v[n]    = _gray;
         }
+
+        if (_v[n] < _v[n-1]) continue; // Non triée : équivalente à une autre
+
+        double   _p     = _poids * nbLignes / (_v[n] == _v[n-1] ? _rep+1 : 1);
+        unsigned _recup = Simule (_ouvrier, &_motif, 0);
+
+        _ouvrier->poids     += _p;
+        _ouvrier->pertes    += _p * _pertes;
+        _ouvrier->recup     += _p * _recup;
+        _ouvrier->toutRecup += _recup == (unsigned)_pertes ? _p : 0;
       }
 
-      if (OPTION_BRUTE)
+      // Début triée suivant (compteur à chiffres croissants, hors dernière)
+      for (k = n-1; k >= 2 && _v[k] == valMax; k--);
+      if  (k < 2 || k >= n) break;
+
+      uint32_t _val = _v[k] + 1;
+
+      for (; k < n; k++)
       {
-        while (true)
-        {
-          if (!sBruteSmpte_LecturePaquetMedia (&brute, OPTION_BUFFER, NULL))
-            break;
-        }
+        _pertes += MotifLigne (&_motif, k, _v[k], _val);
+        _v[k]    = _val;
       }
+    }
+  }
 
-    #endif
+  return 0;
+}
 
-    // MESSAGE TOUS LES 0x1000 TRAITEMENTS =====================================
+// Crée les algorithmes d'un ouvrier -------------------------------------------
+static void OuvrierNew
+  (sOuvrier* pOuvrier) //: Ouvrier à initialiser
+{
+  memset (pOuvrier, 0, sizeof (sOuvrier));
+
+  pOuvrier->media0 = OPTION_MEDIA0;
+
+  if (OPTION_DAVID) pOuvrier->david = sDavidSmpte_New (false, OPTION_DRY_RUN);
+  if (OPTION_BRUTE) pOuvrier->brute = sBruteSmpte_New (false);
+}
+
+// Libère les algorithmes d'un ouvrier -----------------------------------------
+static void OuvrierRelease
+  (sOuvrier* pOuvrier) //: Ouvrier à vider
+{
+  if (OPTION_DAVID) sDavidSmpte_Release (&pOuvrier->david);
+  if (OPTION_BRUTE) sBruteSmpte_Release (&pOuvrier->brute);
+}
 
-    #ifndef OPTION_DEMO
-    if ((configNo.buffer[0] % 0x00001000) == 0)
-    #endif
+// Fonctions publiques =========================================================
+
+// Affiche (et enregistre dans un fichier) le contenu des deux algorithmes -----
+void AssertPrintError()
+{
+  if (!init) return;
+
+  unsigned no;
+
+  for (no = 0; no < nbOuvriers; no++)
+  {
+    if (OPTION_DAVID) sDavidSmpte_Print (&ouvrier[no].david, true);
+    if (OPTION_BRUTE) sBruteSmpte_Print (&ouvrier[no].brute, true);
+  }
+}
+
+// Point d'entrée du programme -------------------------------------------------
+//> Code d'erreur renvoyé au système (0 = ok)
+int main()
+{
+  unsigned no;
+
+  //freopen ("SimulateurComplet.log", "w", stdout);
+
+  PRINT1 ("\n--------------------------------\n"
+          "\nFec Simulator by David Fischer !\n\n")
+
+  ASSERT (OPTION_DAVID || OPTION_BRUTE || OPTION_ORACLE, -1,
+          "DAVID or/and BRUTE or/and ORACLE must be set")
+  ASSERT (OPTION_LD == OPTION_L * OPTION_D,-1, "LD must be equal to L * D")
+
+  // SMPTE 2022 définit quelques limites standards
+  ASSERT (OPTION_LD <= 100,                    -1,"SMPTE 2022 ... L * D <= 100")
+  ASSERT ((OPTION_L >= 1) && (OPTION_L <= 20), -1,"SMPTE 2022 ... 1 <= L <= 20")
+  ASSERT ((OPTION_D >= 4) && (OPTION_D <= 20), -1,"SMPTE 2022 ... 4 <= D <= 20")
+
+  tewfiq = sTewfiq_New3 (OPTION_TEWFIQ_P, OPTION_TEWFIQ_Q, OPTION_SEED);
+
+  struct timespec debut, fin;
+  clock_gettime (CLOCK_MONOTONIC, &debut);
+
+  #ifdef OPTION_VALIDATION
+
+    // Trie la plus longue dimension : moins de configurations canoniques
+    double _parLignes   = Multisets (OPTION_L, OPTION_D);
+    double _parColonnes = Multisets (OPTION_D, OPTION_L);
+
+    parLignes = _parLignes <= _parColonnes;
+    nbLignes  = parLignes ? OPTION_D : OPTION_L;
+    valMax    = (1u << (parLignes ? OPTION_L : OPTION_D)) - 1;
+
+    nbOuvriers = OPTION_THREADS ? OPTION_THREADS :
+                 (unsigned)sysconf (_SC_NPROCESSORS_ONLN);
+    nbOuvriers = nbOuvriers < 1 ? 1 : nbOuvriers;
+    nbOuvriers = nbOuvriers > OUVRIERS_MAX ? OUVRIERS_MAX : nbOuvriers;
+
+    PRINT0 ("validation %ux%u : %.0f configurations, %.0f triees par %s, "
+            "%u ouvriers\n", OPTION_L, OPTION_D, ldexp (1.0, OPTION_LD),
+            parLignes ? _parLignes : _parColonnes,
+            parLignes ? "lignes" : "colonnes", nbOuvriers)
+
+    // INITIALISATION ET DÉMARRAGE DES OUVRIERS ================================
+
+    for (no = 0; no < nbOuvriers; no++) OuvrierNew (&ouvrier[no]);
+
+    init = true;
+
+    for (no = 0; no < nbOuvriers; no++)
     {
-      sChampBits_Print (&configNo); PRINT1 (" sur \n")
-      sChampBits_Print (&limiteNo); PRINT1 ("\n\n")
-
-      // Affiche les modes actifs
-      PRINT1 ("modes : ")
-      #ifdef OPTION_VALIDATION
-      PRINT1 ("validation")
-      #else
-      PRINT1 ("tewfiq P=%.4g Q=%.4g", OPTION_TEWFIQ_P, OPTION_TEWFIQ_Q)
-      #endif
-      PRINT1 (" ")
-      #ifdef OPTION_DEMO
-      PRINT1 ("demo")
-      #endif
-      PRINT1 ("\n")
+      int ok = pthread_create (&ouvrier[no].thread, 0, Ouvrier, &ouvrier[no]);
+      ASSERT (ok == 0, -1, "Unable to start worker %u", no)
+    }
 
-      // Affiche la configuration de test
-      PRINT1 ("lrecov   = %u octets\n"
-              "media0   = %u mediaNo\n"
-              "buffered = %u paquets media\n",
-              OPTION_LRECOV, OPTION_MEDIA0, OPTION_BUFFER)
+    // FUSION DES RÉSULTATS DES OUVRIERS =======================================
 
-      PRINT1 ("matrice L %u, D %u, decalage %u\n",
-              OPTION_L, OPTION_D, OPTION_DECALAGE)
+    sOuvrier total;
+    memset (&total, 0, sizeof (sOuvrier));
 
-      clock_t cd = david.chronoFec / TICKS_TO_MS;
-      clock_t cb = brute.chronoFec / TICKS_TO_MS;
+    for (no = 0; no < nbOuvriers; no++)
+    {
+      pthread_join (ouvrier[no].thread, 0);
+
+      total.configs   += ouvrier[no].configs;
+      total.erreurs   += ouvrier[no].erreurs;
+      total.poids     += ouvrier[no].poids;
+      total.pertes    += ouvrier[no].pertes;
+      total.recup     += ouvrier[no].recup;
+      total.toutRecup += ouvrier[no].toutRecup;
+    }
 
-      PRINT1 ("\n")
-      if (OPTION_DAVID) PRINT1 ("david(%lu) ", cd)
-      if (OPTION_BRUTE) PRINT1 ("brute(%lu) ", cb)
+  #else
 
-      PRINT1 ("ms")
+    // SIMULATION SÉRIELLE AVEC TEWFIQ =========================================
 
-      if (OPTION_DAVID && OPTION_BRUTE)
-        PRINT1 (" g=%.4g x", (double)cb/(double)cd)
+    OuvrierNew (&ouvrier[0]);
 
-      PRINT1 ("\n\n")
+    init = true;
 
-      #ifndef OPTION_VALIDATION
-        sTewfiq_Print (&tewfiq);
-      #endif
+    sOuvrier total;
 
-      if (OPTION_DAVID) sDavidSmpte_Print (&david, false);
-      if (OPTION_BRUTE) sBruteSmpte_Print (&brute, false);
+    while (true)
+    {
+      sOracleSmpte _motif = sOracleSmpte_New (OPTION_L, OPTION_D, true);
 
-      PRINT1 ("\n")
+      // Pertes de la matrice tirées d'un coup (bit no = paquet no perdu)
+      uint64_t _masque[ORACLE_MAX * ORACLE_MAX / 64];
 
-      #ifdef OPTION_DEMO
+      unsigned _pertes = sTewfiq_Masque (&tewfiq, _masque, OPTION_LD);
 
-        unsigned noD, noL;
+      for (no = 0; no < OPTION_LD; no++)
+      {
+        if ((_masque[no >> 6] >> (no & 63)) & 1)
+          sOracleSmpte_SetPerte (&_motif, no, true);
+      }
 
-        for (noD = 0; noD < OPTION_D; noD++)
-        {
-          if (OPTION_DAVID)
-          {
-            for (noL = 0; noL < OPTION_L; noL++)
-            {
-              if (sBufferMedia_Find
-                  (&david.media, mediaB + noL+noD*OPTION_L) != NULL)
-                   PRINT1 ("D ")
-              else PRINT1 (". ")
-            }
-          }
-
-          if (OPTION_BRUTE)
-          {
-            PRINT1 ("    ")
-
-            for (noL = 0; noL < OPTION_L; noL++)
-            {
-              if (sBufferMedia_Find
-                  (&david.media, mediaB + noL+noD*OPTION_L) != NULL)
-                   PRINT1 ("B ")
-              else PRINT1 (". ")
-            }
-          }
-          PRINT1 ("\n")
-        }
-        PRINT1 ("\n")
+      unsigned _recup  = Simule (&ouvrier[0], &_motif, OPTION_BUFFER);
+
+      ouvrier[0].poids     += 1;
+      ouvrier[0].pertes    += _pertes;
+      ouvrier[0].recup     += _recup;
+      ouvrier[0].toutRecup += _recup == _pertes;
+
+      total = ouvrier[0];
 
-        _sleep (100);
+      // MESSAGE TOUS LES 0x1000 TRAITEMENTS ===================================
 
+      #ifndef OPTION_DEMO
+      if ((total.configs % 0x00001000) == 0)
       #endif
-    }
+      {
+        PRINT1 ("tewfiq P=%.4g Q=%.4g\n", OPTION_TEWFIQ_P, OPTION_TEWFIQ_Q)
+        sTewfiq_Print (&tewfiq);
 
-    // INCRÉMENTATION DES COMPTEURS ============================================
+        PRINT1 ("lrecov   = %u octets\n"
+                "media0   = %u mediaNo\n"
+                "buffered = %u paquets media\n",
+                OPTION_DRY_RUN ? 0 : OPTION_LRECOV,
+                OPTION_MEDIA0, OPTION_BUFFER)
 
-    sChampBits_Incremente (&configNo);
+        PRINT1 ("matrice L %u, D %u, decalage %u\n",
+                OPTION_L, OPTION_D, OPTION_DECALAGE)
 
-    #ifdef OPTION_VALIDATION
+        PRINT1 ("%llu matrices, %.0f paquets perdus, %.0f recuperes\n\n",
+                total.configs, total.pertes, total.recup)
+
+        if (OPTION_DAVID) sDavidSmpte_Print (&ouvrier[0].david, false);
+        if (OPTION_BRUTE) sBruteSmpte_Print (&ouvrier[0].brute, false);
+
+        PRINT1 ("\n")
 
-      // Limite atteinte ?
+        #ifdef OPTION_DEMO
+          _sleep (100);
+        #endif
+      }
 
-      if (sChampBits_Compare (&configNo, &limiteNo) >= 0) break;
+      if (total.erreurs > 0) break;
+    }
 
-      // Réinitialise les algorithmes
+  #endif
 
-      media0 = OPTION_MEDIA0;
+  clock_gettime (CLOCK_MONOTONIC, &fin);
 
-      clock_t davidTotal = david.chronoTotal;
-      clock_t davidMedia = david.chronoMedia;
-      clock_t davidFec   = david.chronoFec;
-      clock_t bruteTotal = brute.chronoTotal;
-      clock_t bruteMedia = brute.chronoMedia;
-      clock_t bruteFec   = brute.chronoFec;
+  double _duree = (fin.tv_sec  - debut.tv_sec) +
+                  (fin.tv_nsec - debut.tv_nsec) * 1e-9;
 
-      if (OPTION_DAVID) sDavidSmpte_Release (&david);
-      if (OPTION_BRUTE) sBruteSmpte_Release (&brute);
+  PRINT0 ("%llu configurations simulees (%.0f couvertes) en %.3f s\n"
+          "paquets perdus %.0f, recuperables %.0f, "
+          "configurations entierement recuperees %.0f\n"
+          "divergences %u\n",
+          total.configs, total.poids, _duree,
+          total.pertes, total.recup, total.toutRecup, total.erreurs)
 
-      if (OPTION_DAVID) david = sDavidSmpte_New (false);
-      if (OPTION_BRUTE) brute = sBruteSmpte_New (false);
+  #ifdef OPTION_VALIDATION
 
-      david.chronoTotal += davidTotal;
-      david.chronoMedia += davidMedia;
-      david.chronoFec   += davidFec;
-      brute.chronoTotal += bruteTotal;
-      brute.chronoMedia += bruteMedia;
-      brute.chronoFec   += bruteFec;
+    // Les poids couvrent l'espace entier (exact tant que 2^LD tient en double)
+    if (OPTION_LD <= 52 && total.poids != ldexp (1.0, OPTION_LD))
+    {
+      PRINT0 ("les configurations couvertes ne font pas 2^%u !\n", OPTION_LD)
+      total.erreurs++;
+    }
 
-    #endif
-  }
+  #endif
 
   // FIN DE SESSION MEDIA / FEC ================================================
 
-  if (OPTION_DAVID) sDavidSmpte_Release (&david);
-  if (OPTION_BRUTE) sBruteSmpte_Release (&brute);
+  for (no = 0; no < nbOuvriers; no++) OuvrierRelease (&ouvrier[no]);
 
-  return 0;
+  return total.erreurs > 0 ? -1 : 0;
 }
@@ -0,0 +1,557 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Core data structures micro-benchmark
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Constantes de test ==========================================================
+
+// Remarque : chaque mesure est répétée OPTION_REPETITIONS fois (après une
+//            répétition d'échauffement non comptée). La médiane est donnée
+//            avec son intervalle de confiance à 95% (rangs de la loi
+//            binomiale), le minimum et l'écart interquartile relatif. Une
+//            mesure dont l'écart dépasse OPTION_INSTABLE % est marquée (!).
+
+const unsigned OPTION_REPETITIONS = 21;      //. Echantillons par mesure
+const double   OPTION_INSTABLE    = 5.0;     //. Ecart interquartile max (%)
+const unsigned OPTION_CLES        = 4096;    //. Clés par arbre / liste
+const unsigned OPTION_BLOC        = 16;      //. Taille des blocs réarrangés
+const unsigned OPTION_ITERATIONS  = 1000000; //. Appels par échantillon
+const unsigned OPTION_PAYLOADS    = 4096;    //. Payloads xorés par échantillon
+const unsigned OPTION_LRECOV      = PLDS;    //. Longueur du payload (octets)
+
+// Types de données ============================================================
+
+// Mesure : exécute pNb opérations, renvoie la durée des seules opérations -----
+// en ns (la préparation et le ménage ne sont pas chronométrés)            -----
+typedef uint64_t (*sMesureFunc)(unsigned pNb);
+
+// Variables Globales ==========================================================
+
+static uint32_t    clesSeq  [4096]; //. Clés consécutives (flux dans l'ordre)
+static uint32_t    clesReord[4096]; //. Clés réarrangées par blocs (reorder)
+static uint32_t*   cles;            //. Clés utilisées par la mesure en cours
+static sChampBits  champs   [1024]; //. Champs missing aléatoires
+static sWaitFec*   waits    [1024]; //. Waits aléatoires (L, D, manques)
+static sMediaNo    medias   [1024]; //. MédiaNo protégés par le wait associé
+static uint8_t*    payloads;        //. Payloads source des xor
+static uint8_t     recup    [PLDS]; //. Payload en cours de récupération
+static unsigned    lrecov = PLDS;   //. Longueur xorée (variable, cf. david)
+
+static volatile uint64_t puits; //. Empêche le compilateur d'ignorer les calculs
+
+// Fonctions privées (outils) ==================================================
+
+// Horloge monotone ------------------------------------------------------------
+//> Instant courant en ns
+static inline uint64_t Maintenant()
+{
+  struct timespec _t;
+  clock_gettime (CLOCK_MONOTONIC, &_t);
+
+  return (uint64_t)_t.tv_sec * 1000000000ull + _t.tv_nsec;
+}
+
+// Compare deux durées (qsort) -------------------------------------------------
+static int CompareDurees (const void* a, const void* b)
+{
+  double _a = *(const double*)a, _b = *(const double*)b;
+
+  return _a < _b ? -1 : _a > _b;
+}
+
+// Répète une mesure et affiche sa statistique (ns par opération) --------------
+static void Mesure
+  (const char* pNom,    //: Nom de la mesure
+   sMesureFunc pMesure, //: Fonction mesurée
+   unsigned    pNb)     //: Nombre d'opérations par échantillon
+{
+  double   _ns[64];
+  unsigned no, n = OPTION_REPETITIONS;
+
+  pMesure (pNb); // Echauffement (caches, prédicteurs, fréquence)
+
+  for (no = 0; no < n; no++) _ns[no] = (double)pMesure (pNb) / pNb;
+
+  qsort (_ns, n, sizeof (double), CompareDurees);
+
+  // Intervalle de confiance de la médiane : rangs n/2 -+ 1.96*sqrt(n)/2
+  signed   _ecart = (signed)ceil (0.98 * sqrt (n));
+  signed   _bas   = (signed)(n / 2) - _ecart;
+  signed   _haut  = (signed)(n / 2) + _ecart;
+  _bas  = _bas  < 0          ? 0          : _bas;
+  _haut = _haut > (signed)n-1 ? (signed)n-1 : _haut;
+
+  double _mediane = _ns[n / 2];
+  double _iqr     = 100.0 * (_ns[3 * n / 4] - _ns[n / 4]) / _mediane;
+
+  PRINT0 ("%-24s %9.2f ns [%9.2f ; %9.2f] min %9.2f  iqr %5.1f%%%s\n",
+          pNom, _mediane, _ns[_bas], _ns[_haut], _ns[0], _iqr,
+          _iqr > OPTION_INSTABLE ? " (!)" : "")
+}
+
+// Lit la première ligne d'un fichier (sysfs, procfs) --------------------------
+//> Texte lu (sans retour à la ligne) ou "?" si indisponible
+static const char* Lire
+  (const char* pFichier, //: Fichier à lire
+   const char* pCle)     //: Préfixe de la ligne cherchée (0 = première ligne)
+{
+  static char _ligne[256];
+
+  FILE* _f = fopen (pFichier, "r");
+  if (!_f) return "?";
+
+  bool ok = false;
+
+  while (fgets (_ligne, sizeof (_ligne), _f))
+  {
+    if (pCle == 0 || strncmp (_ligne, pCle, strlen (pCle)) == 0)
+    {
+      ok = true;
+      break;
+    }
+  }
+
+  fclose (_f);
+
+  if (!ok) return "?";
+
+  _ligne[strcspn (_ligne, "\n")] = 0;
+
+  char* _valeur = pCle ? strchr (_ligne, ':') : 0;
+
+  return _valeur ? _valeur + 2 : _ligne;
+}
+
+// Estime la fréquence effective : chaîne d'additions dépendantes (1 cycle) ----
+//> Fréquence estimée en GHz
+static double Frequence()
+{
+  uint64_t x = 0, n, _nb = 100000000;
+
+  uint64_t _debut = Maintenant();
+
+  for (n = 0; n < _nb; n++)
+  {
+    x += n;
+    __asm__ volatile ("" : "+r" (x)); // Garde la chaîne (pas de vectorisation)
+  }
+
+  uint64_t _duree = Maintenant() - _debut;
+
+  puits = x;
+
+  return (double)_nb / _duree;
+}
+
+// Affiche les conditions de la mesure (processeur, fréquence, gouverneur) -----
+static void Notes()
+{
+  const char* _cpu = "/sys/devices/system/cpu/cpu0/cpufreq/";
+  char        _f[128];
+
+  PRINT0 ("processeur  : %s\n", Lire ("/proc/cpuinfo", "model name"))
+  PRINT0 ("coeurs      : %ld\n", sysconf (_SC_NPROCESSORS_ONLN))
+
+  sprintf (_f, "%sscaling_governor", _cpu);
+  const char* _gouverneur = Lire (_f, 0);
+  PRINT0  ("gouverneur  : %s\n", _gouverneur)
+
+  sprintf (_f, "%sscaling_min_freq", _cpu);
+  PRINT0  ("freq min    : %s kHz\n", Lire (_f, 0))
+  sprintf (_f, "%sscaling_max_freq", _cpu);
+  PRINT0  ("freq max    : %s kHz\n", Lire (_f, 0))
+  sprintf (_f, "%sscaling_cur_freq", _cpu);
+  PRINT0  ("freq cour.  : %s kHz\n", Lire (_f, 0))
+
+  PRINT0 ("turbo off   : %s (intel_pstate)\n",
+          Lire ("/sys/devices/system/cpu/intel_pstate/no_turbo", 0))
+  PRINT0 ("boost       : %s (acpi-cpufreq)\n",
+          Lire ("/sys/devices/system/cpu/cpufreq/boost", 0))
+
+  PRINT0 ("freq estimee: %.2f GHz (additions dependantes)\n\n", Frequence())
+
+  if (strcmp (_gouverneur, "performance") != 0)
+  {
+    PRINT0 ("REMARQUE : gouverneur autre que 'performance' (ou inconnu), la\n"
+            "           fréquence peut varier entre les mesures. Fixer la\n"
+            "           fréquence et le coeur (taskset) pour comparer.\n\n")
+  }
+}
+
+// Fonctions privées (mesures) =================================================
+
+// sRbTree : insertion des clés ------------------------------------------------
+static uint64_t RbAjoute (unsigned pNb)
+{
+  sRbTree  _arbre = sRbTree_New (0, 0);
+  unsigned no;
+
+  uint64_t _debut = Maintenant();
+  for (no = 0; no < pNb; no++)
+  {
+    sRbTree_AddByReference (&_arbre, cles[no], &cles[no], false);
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  sRbTree_Release (&_arbre);
+
+  return _duree;
+}
+
+// sRbTree : recherche des clés (toutes présentes) -----------------------------
+static uint64_t RbCherche (unsigned pNb)
+{
+  sRbTree  _arbre = sRbTree_New (0, 0);
+  unsigned no;
+
+  for (no = 0; no < pNb; no++)
+  {
+    sRbTree_AddByReference (&_arbre, clesSeq[no], &clesSeq[no], false);
+  }
+
+  uintptr_t _somme = 0;
+
+  uint64_t _debut = Maintenant();
+  for (no = 0; no < pNb; no++)
+  {
+    _somme += (uintptr_t)sRbTree_Lookup (&_arbre, cles[no]);
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  puits = _somme;
+
+  sRbTree_Release (&_arbre);
+
+  return _duree;
+}
+
+// sRbTree : suppression des clés ----------------------------------------------
+static uint64_t RbSupprime (unsigned pNb)
+{
+  sRbTree  _arbre = sRbTree_New (0, 0);
+  unsigned no;
+
+  for (no = 0; no < pNb; no++)
+  {
+    sRbTree_AddByReference (&_arbre, clesSeq[no], &clesSeq[no], false);
+  }
+
+  uint64_t _debut = Maintenant();
+  for (no = 0; no < pNb; no++)
+  {
+    sRbTree_Delete (&_arbre, cles[no]);
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  sRbTree_Release (&_arbre);
+
+  return _duree;
+}
+
+// sLinkedList : ajout en fin de liste -----------------------------------------
+static uint64_t ListeAjoute (unsigned pNb)
+{
+  sLinkedList _liste = sLinkedList_New (0, 0);
+  unsigned    no;
+
+  uint64_t _debut = Maintenant();
+  for (no = 0; no < pNb; no++)
+  {
+    sLinkedList_AppendByReference (&_liste, &clesSeq[no]);
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  sLinkedList_Release (&_liste);
+
+  return _duree;
+}
+
+// sLinkedList : parcours qui supprime un élément sur deux (cf. brute) ---------
+static uint64_t ListeParcours (unsigned pNb)
+{
+  sLinkedList _liste = sLinkedList_New (0, 0);
+  unsigned    no = 0;
+
+  for (no = 0; no < pNb; no++)
+  {
+    sLinkedList_AppendByReference (&_liste, &clesSeq[no]);
+  }
+
+  uint64_t _debut = Maintenant();
+  if (sLinkedList_InitForeach (&_liste, false))
+  {
+    while (sLinkedList_NextForeach (&_liste))
+    {
+      uint32_t* _cle = sLinkedList_ForeachValue (&_liste);
+      if (*_cle & 1) sLinkedList_DeleteOnForeach (&_liste);
+    }
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  sLinkedList_Release (&_liste);
+
+  return _duree;
+}
+
+// sChampBits : 1er et 2ème bit à 1 (comme GetManque) --------------------------
+static uint64_t ChampGetOne (unsigned pNb)
+{
+  signed   _somme = 0;
+  unsigned no;
+
+  uint64_t _debut = Maintenant();
+  for (no = 0; no < pNb; no++)
+  {
+    _somme += sChampBits_GetOne (&champs[no & 1023], 1 + (no & 1), LSB_FIRST);
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  puits = _somme;
+
+  return _duree;
+}
+
+// sChampBits : met un bit à 1 puis à 0 (comme SetManque) ----------------------
+static uint64_t ChampSetBit (unsigned pNb)
+{
+  unsigned no;
+
+  uint64_t _debut = Maintenant();
+  for (no = 0; no < pNb; no++)
+  {
+    sChampBits_SetBit (&champs[no & 1023], (uint8_t)(no * 37), !(no & 1024));
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  puits = champs[no & 1023].buffer[0];
+
+  return _duree;
+}
+
+// sWaitFec : rang j d'un médiaNo protégé --------------------------------------
+static uint64_t WaitComputeJ (unsigned pNb)
+{
+  unsigned _somme = 0, no;
+
+  uint64_t _debut = Maintenant();
+  for (no = 0; no < pNb; no++)
+  {
+    _somme += sWaitFec_ComputeJ (waits[no & 1023], medias[no & 1023]).v;
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  puits = _somme;
+
+  return _duree;
+}
+
+// sWaitFec : médiaNo du 1er paquet manquant -----------------------------------
+static uint64_t WaitGetManque (unsigned pNb)
+{
+  unsigned _somme = 0, no;
+
+  uint64_t _debut = Maintenant();
+  for (no = 0; no < pNb; no++)
+  {
+    _somme += sWaitFec_GetManque (waits[no & 1023], 1).v;
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  puits = _somme;
+
+  return _duree;
+}
+
+// Xor d'un payload, longueur variable (boucle de david, brute, col) -----------
+static uint64_t XorVariable (unsigned pNb)
+{
+  unsigned n, no;
+
+  uint64_t _debut = Maintenant();
+  for (n = 0; n < pNb; n++)
+  {
+    const uint8_t* _ami = &payloads[(n % OPTION_PAYLOADS) * OPTION_LRECOV];
+
+    for (no = 0; no < lrecov; no++) recup[no] ^= _ami[no];
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  puits = recup[n % PLDS];
+
+  return _duree;
+}
+
+// Xor d'un payload, longueur constante (boucle du décodeur L x D) -------------
+static uint64_t XorConstant (unsigned pNb)
+{
+  unsigned n, no;
+
+  uint64_t _debut = Maintenant();
+  for (n = 0; n < pNb; n++)
+  {
+    const uint8_t* _ami = &payloads[(n % OPTION_PAYLOADS) * OPTION_LRECOV];
+
+    for (no = 0; no < PLDS; no++) recup[no] ^= _ami[no];
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  puits = recup[n % PLDS];
+
+  return _duree;
+}
+
+// sPaquetMedia : forge (payload copié) puis libération ------------------------
+static uint64_t MediaForge (unsigned pNb)
+{
+  unsigned no;
+
+  uint64_t _debut = Maintenant();
+  for (no = 0; no < pNb; no++)
+  {
+    sPaquetMedia* _media = sPaquetMedia_Forge
+      (no, no, PAYLOAD_TYPE, OPTION_LRECOV,
+       &payloads[(no % OPTION_PAYLOADS) * OPTION_LRECOV]);
+
+    sPaquetMedia_Release (_media);
+  }
+  uint64_t _duree = Maintenant() - _debut;
+
+  return _duree;
+}
+
+// Fonctions publiques =========================================================
+
+// Affiche (et enregistre dans un fichier) le contenu des deux algorithmes -----
+void AssertPrintError()
+{
+}
+
+// Point d'entrée du programme -------------------------------------------------
+//> Code d'erreur renvoyé au système (0 = ok)
+int main()
+{
+  unsigned no, nb;
+
+  PRINT0 ("\n--------------------------------\n"
+          "\nCore data structures benchmark\n\n")
+
+  Notes();
+
+  // PRÉPARATION DES DONNÉES ===================================================
+
+  sAlea _alea = sAlea_New (1);
+
+  // Clés consécutives puis mélangées à l'intérieur de blocs (reordering)
+  for (no = 0; no < OPTION_CLES; no++) clesSeq[no] = clesReord[no] = no;
+
+  for (no = 0; no < OPTION_CLES; no += OPTION_BLOC)
+  {
+    for (nb = OPTION_BLOC - 1; nb > 0; nb--)
+    {
+      unsigned _j = sAlea_Next (&_alea) % (nb + 1);
+      uint32_t _c = clesReord[no + nb];
+
+      clesReord[no + nb] = clesReord[no + _j];
+      clesReord[no + _j] = _c;
+    }
+  }
+
+  // Champs missing et waits : matrice L x D aléatoire, 1 à 3 manques
+  for (no = 0; no < 1024; no++)
+  {
+    champs[no] = sChampBits_New();
+
+    for (nb = 0; nb < 24; nb++)
+    {
+      sChampBits_SetBit (&champs[no], (uint8_t)sAlea_Next (&_alea), true);
+    }
+
+    sWaitFec* _wait = waits[no] = sWaitFec_New (0, true);
+    ASSERTc  (_wait, -1, cExAllocateMemory)
+
+    _wait->NA     = 4 + sAlea_Next (&_alea) % 17;
+    _wait->Offset = 4 + sAlea_Next (&_alea) % 17;
+    _wait->SNBase = sAlea_Next (&_alea);
+    _wait->number = 1 + sAlea_Next (&_alea) % 3;
+
+    for (nb = 0; nb < _wait->number; nb++)
+    {
+      sChampBits_SetBit (&_wait->missing,
+                         sAlea_Next (&_alea) % _wait->NA, true);
+    }
+
+    // Au moins un bit à 1 : le manque de rang 1 existe toujours
+    _wait->number = 1;
+
+    medias[no] = _wait->SNBase +
+                 _wait->Offset * (sAlea_Next (&_alea) % _wait->NA);
+  }
+
+  payloads = malloc (OPTION_PAYLOADS * OPTION_LRECOV);
+  ASSERTc (payloads, -1, cExAllocateMemory)
+
+  for (no = 0; no < OPTION_PAYLOADS * OPTION_LRECOV; no++)
+  {
+    payloads[no] = (uint8_t)sAlea_Next (&_alea);
+  }
+
+  // MESURES ===================================================================
+
+  PRINT0 ("%-24s %12s %23s %14s %12s\n",
+          "mesure (par operation)", "mediane", "ic 95%", "min", "iqr")
+
+  cles = clesSeq;
+  Mesure ("RbTree Add      (seq)",   RbAjoute,   OPTION_CLES);
+  Mesure ("RbTree Lookup   (seq)",   RbCherche,  OPTION_CLES);
+  Mesure ("RbTree Delete   (seq)",   RbSupprime, OPTION_CLES);
+
+  cles = clesReord;
+  Mesure ("RbTree Add      (reord)", RbAjoute,   OPTION_CLES);
+  Mesure ("RbTree Lookup   (reord)", RbCherche,  OPTION_CLES);
+  Mesure ("RbTree Delete   (reord)", RbSupprime, OPTION_CLES);
+
+  Mesure ("LinkedList Append",       ListeAjoute,   OPTION_CLES);
+  Mesure ("LinkedList Foreach+Del",  ListeParcours, OPTION_CLES);
+
+  Mesure ("ChampBits GetOne",        ChampGetOne, OPTION_ITERATIONS);
+  Mesure ("ChampBits SetBit",        ChampSetBit, OPTION_ITERATIONS);
+
+  Mesure ("WaitFec ComputeJ",        WaitComputeJ,  OPTION_ITERATIONS);
+  Mesure ("WaitFec GetManque",       WaitGetManque, OPTION_ITERATIONS);
+
+  Mesure ("Xor payload (variable)",  XorVariable, OPTION_PAYLOADS);
+  Mesure ("Xor payload (constant)",  XorConstant, OPTION_PAYLOADS);
+
+  Mesure ("PaquetMedia Forge+Rel.",  MediaForge, OPTION_PAYLOADS);
+
+  for (no = 0; no < 1024; no++) sWaitFec_Release (waits[no]);
+  free (payloads);
+
+  PRINT0 ("\n")
+
+  return 0;
+}
@@ -84,6 +84,9 @@
  * OPTION_PRINT1_IS_NULL      PRINT1(c) sera <NULL>
  * OPTION_PRINT2_IS_NULL      PRINT2(c) sera <NULL> (et DETAILS2 pareil)
  *
+ * OPTION_CHRONO_IS_NULL      CHRONO_DEBUT / CHRONO_FIN seront <NULL> : aucun
+ *                            chronométrage des phases des algorithmes
+ *
  * OPTION_ASSERT_IS_ASSERT    ASSERT(c) sera ASSERTp(c) *1
  * OPTION_ASSERT_IS_IFNOT     ASSERT(c) sera IFNOTp(c)  *2
  * OPTION_ASSERT_IS_NULL      ASSERT(c) sera <NULL>
@@ -106,6 +109,8 @@
 //#define OPTION_PRINT1_IS_NULL
 //#define OPTION_PRINT2_IS_NULL
 
+//#define OPTION_CHRONO_IS_NULL
+
 #define OPTION_ASSERT_IS_ASSERT
 //#define OPTION_ASSERT_IS_IFNOT
 //#define OPTION_ASSERT_IS_NULL
@@ -122,6 +127,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <stddef.h>
 #include <unistd.h>
 #include <memory.h>
 #include <math.h>
@@ -134,6 +140,7 @@
 #include "common/macros.h"
 #include "common/console.h"
 #include "common/messages.h"
+#include "common/allocation.h"
 #include "common/project_types.h"
 
 #endif
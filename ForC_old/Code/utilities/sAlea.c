@@ -0,0 +1,177 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Seedable per-instance random generator (xoshiro256**)
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+#include "sAlea_ziggurat.h"
+
+// Fonctions privées ===========================================================
+
+// Rotation à gauche de pK bits ------------------------------------------------
+//> Valeur tournée
+static inline uint64_t Rotation
+  (uint64_t pX, //: Valeur à tourner
+   unsigned pK) //: Nombre de bits
+{
+  return (pX << pK) | (pX >> (64 - pK));
+}
+
+// Mélange splitmix64 : étend une graine de 64 bits sur l'état complet ---------
+//> Valeur suivante de la suite splitmix64
+static uint64_t SplitMix
+  (uint64_t* pEtat) //: Etat de la suite splitmix64
+{
+  uint64_t _z = (*pEtat += 0x9E3779B97F4A7C15ull);
+
+  _z = (_z ^ (_z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  _z = (_z ^ (_z >> 27)) * 0x94D049BB133111EBull;
+
+  return _z ^ (_z >> 31);
+}
+
+// Fonctions publiques =========================================================
+
+// Création d'un nouveau générateur (même graine = même suite) -----------------
+//> Nouveau générateur
+sAlea sAlea_New
+  (uint64_t pGraine) //: Graine du générateur
+{
+  sAlea _alea;
+
+  _alea.s[0] = SplitMix (&pGraine);
+  _alea.s[1] = SplitMix (&pGraine);
+  _alea.s[2] = SplitMix (&pGraine);
+  _alea.s[3] = SplitMix (&pGraine);
+
+  return _alea;
+}
+
+// Tire 64 bits aléatoires -----------------------------------------------------
+//> Valeur uniforme sur [0, 2^64[
+uint64_t sAlea_Next
+  (sAlea* pAlea) //: Générateur utilisé
+{
+  ASSERTpc (pAlea, 0, cExNullPtr)
+
+  uint64_t* s = pAlea->s;
+
+  uint64_t _resultat = Rotation (s[1] * 5, 7) * 9;
+  uint64_t _t        = s[1] << 17;
+
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= _t;
+  s[3]  = Rotation (s[3], 45);
+
+  return _resultat;
+}
+
+// Distribution Uniforme [0,1[ (53 bits) ---------------------------------------
+//> Valeur calculée via la loi de probabilité
+double sAlea_Uni
+  (sAlea* pAlea) //: Générateur utilisé
+{
+  return (sAlea_Next (pAlea) >> 11) * 0x1.0p-53;
+}
+
+// Distribution Gaussienne N(0,1) par la méthode ziggurat                    ---
+// Remarque : 7 bits de poids faible pour la couche, 32 de poids fort pour x ---
+//> Valeur calculée via la loi de probabilité
+double sAlea_Gauss
+  (sAlea* pAlea) //: Générateur utilisé
+{
+  const double r = 3.442619855899;
+
+  while (true)
+  {
+    uint64_t _u  = sAlea_Next (pAlea);
+    unsigned iz  = _u & 127;
+    int32_t  hz  = (int32_t)(_u >> 32);
+    double   x   = hz * zigWn[iz];
+
+    // Cas le plus fréquent (~99 %) : sous la couche, accepté d'emblée
+    if ((uint32_t)(hz < 0 ? -(int64_t)hz : hz) < zigKn[iz]) return x;
+
+    if (iz == 0) // Queue de la distribution (au-delà de r)
+    {
+      double y;
+
+      do
+      {
+        x = -log (1.0 - sAlea_Uni (pAlea)) / r;
+        y = -log (1.0 - sAlea_Uni (pAlea));
+      }
+      while (y + y < x * x);
+
+      return hz > 0 ? r + x : -r - x;
+    }
+
+    // Bord de la couche : test exact contre la densité
+    if (zigFn[iz] + sAlea_Uni (pAlea) * (zigFn[iz-1] - zigFn[iz]) <
+        exp (-0.5 * x * x))
+      return x;
+  }
+}
+
+// Distribution Exponentielle f(x) = e^-x par la méthode ziggurat --------------
+//> Valeur calculée via la loi de probabilité
+double sAlea_Exp
+  (sAlea* pAlea) //: Générateur utilisé
+{
+  const double r = 7.697117470131487;
+
+  while (true)
+  {
+    uint64_t _u = sAlea_Next (pAlea);
+    unsigned iz = _u & 255;
+    uint32_t jz = (uint32_t)(_u >> 32);
+    double   x  = jz * zigWe[iz];
+
+    if (jz < zigKe[iz]) return x;
+
+    if (iz == 0) return r - log (1.0 - sAlea_Uni (pAlea)); // Queue
+
+    if (zigFe[iz] + sAlea_Uni (pAlea) * (zigFe[iz-1] - zigFe[iz]) < exp (-x))
+      return x;
+  }
+}
+
+// Distribution Géométrique : nombre d'échecs avant le premier succès ----------
+// pLogEchec = log (1 - probabilité de succès), voir sTewfiq          ----------
+// Remarque : un seul tirage quelle que soit la longueur (inversion)  ----------
+//> Valeur calculée via la loi de probabilité (UINT64_MAX = jamais)
+uint64_t sAlea_Geometrique
+  (sAlea* pAlea,     //: Générateur utilisé
+   double pLogEchec) //: log (1 - p), 0 = jamais de succès, -inf = toujours
+{
+  if (pLogEchec >= 0) return UINT64_MAX; // Succès impossible
+
+  double _n = floor (log (1.0 - sAlea_Uni (pAlea)) / pLogEchec);
+
+  return _n < 0x1.0p63 ? (uint64_t)_n : UINT64_MAX;
+}
@@ -0,0 +1,398 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Ziggurat tables of the Gaussian and exponential samplers
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SALEA_ZIGGURAT__
+#define __SALEA_ZIGGURAT__
+
+// Tables de la méthode ziggurat (Marsaglia & Tsang, 2000) =====================
+
+// Remarque : générées une fois pour toutes (zigset de Marsaglia & Tsang)
+//            gaussienne    : 128 couches, base r = 3.442619855899
+//            exponentielle : 256 couches, base r = 7.697117470131487
+//            k = seuils d'acceptation immédiate, w = largeurs, f = densités
+
+static const uint32_t zigKn[128] =
+{
+  1991057938u,          0u, 1611602771u, 1826899878u, 1918584482u,
+  1969227037u, 2001281515u, 2023368125u, 2039498179u, 2051788381u,
+  2061460127u, 2069267110u, 2075699398u, 2081089314u, 2085670119u,
+  2089610331u, 2093034710u, 2096037586u, 2098691595u, 2101053571u,
+  2103168620u, 2105072996u, 2106796166u, 2108362327u, 2109791536u,
+  2111100552u, 2112303493u, 2113412330u, 2114437283u, 2115387130u,
+  2116269447u, 2117090813u, 2117856962u, 2118572919u, 2119243101u,
+  2119871411u, 2120461303u, 2121015852u, 2121537798u, 2122029592u,
+  2122493434u, 2122931299u, 2123344971u, 2123736059u, 2124106020u,
+  2124456175u, 2124787725u, 2125101763u, 2125399283u, 2125681194u,
+  2125948325u, 2126201433u, 2126441213u, 2126668298u, 2126883268u,
+  2127086657u, 2127278949u, 2127460589u, 2127631985u, 2127793506u,
+  2127945490u, 2128088244u, 2128222044u, 2128347141u, 2128463758u,
+  2128572095u, 2128672327u, 2128764606u, 2128849065u, 2128925811u,
+  2128994934u, 2129056501u, 2129110560u, 2129157136u, 2129196237u,
+  2129227847u, 2129251929u, 2129268426u, 2129277255u, 2129278312u,
+  2129271467u, 2129256561u, 2129233410u, 2129201800u, 2129161480u,
+  2129112170u, 2129053545u, 2128985244u, 2128906855u, 2128817916u,
+  2128717911u, 2128606255u, 2128482298u, 2128345305u, 2128194452u,
+  2128028813u, 2127847342u, 2127648860u, 2127432031u, 2127195339u,
+  2126937058u, 2126655214u, 2126347546u, 2126011445u, 2125643893u,
+  2125241376u, 2124799783u, 2124314271u, 2123779094u, 2123187386u,
+  2122530867u, 2121799464u, 2120980787u, 2120059418u, 2119015917u,
+  2117825402u, 2116455471u, 2114863093u, 2112989789u, 2110753906u,
+  2108037662u, 2104664315u, 2100355223u, 2094642347u, 2086670106u,
+  2074676188u, 2054300022u, 2010539237u
+};
+
+static const double zigWn[128] =
+{
+  1.729040521542798e-09, 1.2680928447002762e-10, 1.6897517773184551e-10,
+  1.9862688442479051e-10, 2.2232431792499955e-10, 2.4244936125448931e-10,
+  2.6016131900632064e-10, 2.7611988711703956e-10, 2.9073962817715979e-10,
+  3.0429970414376596e-10, 3.1699795213954273e-10, 3.2898020527113064e-10,
+  3.4035738121834064e-10, 3.5121602213664708e-10, 3.616250995056517e-10,
+  3.7164057634959785e-10, 3.8130856431105979e-10, 3.9066756809948822e-10,
+  3.9975011869976912e-10, 4.0858398615984403e-10, 4.1719309640160654e-10,
+  4.2559823534592626e-10, 4.3381759739255105e-10, 4.4186721812528858e-10,
+  4.4976131962665818e-10, 4.5751258894588287e-10, 4.6513240481400098e-10,
+  4.7263102384811756e-10, 4.800177347232567e-10, 4.8730098677987483e-10,
+  4.9448849805389729e-10, 5.0158734661196158e-10, 5.0860404824245599e-10,
+  5.15544622919539e-10, 5.2241465197063155e-10, 5.2921932750063053e-10,
+  5.3596349533128897e-10, 5.4265169248206189e-10, 5.4928818003460213e-10,
+  5.5587697207607733e-10, 5.6242186129835884e-10, 5.6892644173465501e-10,
+  5.7539412903756027e-10, 5.8182817863908979e-10, 5.8823170208121699e-10,
+  5.9460768176249956e-10, 6.0095898431083022e-10, 6.0728837276278847e-10,
+  6.1359851770541355e-10, 6.1989200751559216e-10, 6.2617135781494294e-10,
+  6.3243902024354019e-10, 6.3869739064357364e-10, 6.4494881673373833e-10,
+  6.5119560534646982e-10, 6.5744002929285993e-10, 6.6368433391398755e-10,
+  6.6993074337233023e-10, 6.7618146673274439e-10, 6.824387038791137e-10,
+  6.8870465131007329e-10, 6.949815078551667e-10, 7.0127148035131547e-10,
+  7.0757678931855602e-10, 7.138996746735849e-10, 7.2024240151974857e-10,
+  7.2660726605270474e-10, 7.329966016220864e-10, 7.3941278499112283e-10,
+  7.4585824283835391e-10, 7.5233545854834884e-10, 7.5884697934176525e-10,
+  7.6539542379922632e-10, 7.7198348983844004e-10, 7.786139632098381e-10,
+  7.8528972658289975e-10, 7.9201376930340978e-10, 7.9878919791135359e-10,
+  8.0561924752021698e-10, 8.1250729417139681e-10, 8.1945686829257451e-10,
+  8.2647166940666245e-10, 8.335555822587845e-10, 8.407126945532991e-10,
+  8.4794731652183716e-10, 8.5526400257760939e-10, 8.6266757535193633e-10,
+  8.7016315245744244e-10, 8.7775617638032838e-10, 8.8545244797372776e-10,
+  8.9325816410803695e-10, 9.0117996013566053e-10, 9.092249579511381e-10,
+  9.1740082057860052e-10, 9.257158144040126e-10, 9.3417888039884721e-10,
+  9.4279971596663144e-10, 9.5158886939988827e-10, 9.6055784938312528e-10,
+  9.697192525453944e-10, 9.7908691279089008e-10, 9.8867607706877244e-10,
+  9.9850361345354251e-10, 1.0085882589914473e-09, 1.0189509168621382e-09,
+  1.0296150152006668e-09, 1.0406069436999874e-09, 1.0519565892728039e-09,
+  1.0636979991930871e-09, 1.0758702101645819e-09, 1.0885182960607283e-09,
+  1.1016947078135044e-09, 1.1154610095597163e-09, 1.1298901613493216e-09,
+  1.1450695700067237e-09, 1.1611052426022348e-09, 1.1781275609456131e-09,
+  1.1962995053850756e-09, 1.2158286983295564e-09, 1.2369856290804966e-09,
+  1.2601323300608525e-09, 1.2857696844205153e-09, 1.3146201849677183e-09,
+  1.3477839562210855e-09, 1.3870635315067043e-09, 1.435740319181638e-09,
+  1.5008659030222993e-09, 1.6030947938091123e-09
+};
+
+static const double zigFn[128] =
+{
+  1, 0.96359969312708615, 0.93628268168505957,
+  0.9130436479717402, 0.8922816507840261, 0.87324304891006954,
+  0.85550060786945059, 0.83878360529598961, 0.82290721138140899,
+  0.80773829468296054, 0.79317701177130506, 0.7791460859296877,
+  0.7655841738977045, 0.75244155917461142, 0.73967724367264731,
+  0.72725691834418482, 0.7151515074104986, 0.70333609901615812,
+  0.69178914343667508, 0.68049184099733406, 0.66942766734889037,
+  0.65858200005008805, 0.64794182111022247, 0.6374954773350423,
+  0.62723248524992725, 0.61714337081888093, 0.60721953662512029,
+  0.59745315094451668, 0.58783705443470657, 0.57836468111976314,
+  0.56902999106795094, 0.55982741270408687, 0.55075179311460454,
+  0.5417983550254255, 0.53296265938383613, 0.52424057267298407,
+  0.51562823824400184, 0.50712205107556896, 0.4987186354709795,
+  0.49041482528384411, 0.48220764632948521, 0.47409430069301695,
+  0.46607215268945612, 0.45813871626787206, 0.45029164368203922,
+  0.44252871527546844, 0.43484783024999091, 0.42724699830499607,
+  0.41972433204957438, 0.412278040102661, 0.40490642080722294,
+  0.39760785649387331, 0.39038080823731458, 0.3832238110559012,
+  0.37613546951056259, 0.36911445366447221, 0.36215949536931757,
+  0.35526938484791709, 0.34844296754632659, 0.34167914123155041,
+  0.33497685331358917, 0.3283350983728503, 0.32175291587598492,
+  0.31522938806501088, 0.30876363800618112, 0.30235482778648354,
+  0.29600215684693298, 0.28970486044295984, 0.28346220822323298,
+  0.27727350291918812, 0.27113807913838461, 0.26505530225558921,
+  0.25902456739620483, 0.25304529850732577, 0.24711694751232141,
+  0.24123899354543982, 0.23541094226347908, 0.22963232523211613,
+  0.22390269938500842, 0.2182216465543054, 0.2125887730717303,
+  0.20700370943992652, 0.20146611007431367, 0.19597565311627774,
+  0.19053204031913715, 0.18513499700899219, 0.17978427212329545,
+  0.1744796383307895, 0.169220892237365, 0.16400785468342038,
+  0.1588403711394793, 0.15371831220818166, 0.14864157424234226,
+  0.14361008009062776, 0.1386237799845946, 0.13368265258343937,
+  0.12878670619594321, 0.12393598020286782, 0.11913054670765083,
+  0.11437051244886601, 0.10965602101484027, 0.10498725540942132,
+  0.10036444102865587, 0.095787849121731439, 0.091257800826830257,
+  0.086774671894780178, 0.082338898242235656, 0.077950982513973394,
+  0.073611501884113403, 0.069321117393577908, 0.065080585213068073,
+  0.060890770348040406, 0.056752663481049848, 0.052667401903051012,
+  0.048636295859867805, 0.044660862200491425, 0.040742868074444175,
+  0.036884388786656203, 0.033087886146225751, 0.02935631744000685,
+  0.025693291935934271, 0.022103304615927098, 0.018592102737011288,
+  0.015167298010546568, 0.011839478657884862, 0.0086244844128598851,
+  0.0055489952207713449, 0.0026696290838809228
+};
+
+static const uint32_t zigKe[256] =
+{
+  3801129273u,          0u, 2615860924u, 3279400049u, 3571300752u,
+  3733536696u, 3836274812u, 3906990442u, 3958562475u, 3997804264u,
+  4028649213u, 4053523342u, 4074002619u, 4091154507u, 4105727352u,
+  4118261130u, 4129155133u, 4138710916u, 4147160435u, 4154685009u,
+  4161428406u, 4167506077u, 4173011791u, 4178022498u, 4182601930u,
+  4186803325u, 4190671498u, 4194244443u, 4197554582u, 4200629752u,
+  4203493986u, 4206168142u, 4208670408u, 4211016720u, 4213221098u,
+  4215295924u, 4217252177u, 4219099625u, 4220846988u, 4222502074u,
+  4224071896u, 4225562770u, 4226980400u, 4228329951u, 4229616109u,
+  4230843138u, 4232014925u, 4233135020u, 4234206673u, 4235232866u,
+  4236216336u, 4237159604u, 4238064994u, 4238934652u, 4239770563u,
+  4240574564u, 4241348362u, 4242093539u, 4242811568u, 4243503822u,
+  4244171579u, 4244816032u, 4245438297u, 4246039419u, 4246620374u,
+  4247182079u, 4247725394u, 4248251127u, 4248760037u, 4249252839u,
+  4249730206u, 4250192773u, 4250641138u, 4251075867u, 4251497493u,
+  4251906522u, 4252303431u, 4252688672u, 4253062674u, 4253425844u,
+  4253778565u, 4254121205u, 4254454110u, 4254777611u, 4255092022u,
+  4255397640u, 4255694750u, 4255983622u, 4256264513u, 4256537670u,
+  4256803325u, 4257061702u, 4257313014u, 4257557464u, 4257795244u,
+  4258026541u, 4258251531u, 4258470383u, 4258683258u, 4258890309u,
+  4259091685u, 4259287526u, 4259477966u, 4259663135u, 4259843154u,
+  4260018142u, 4260188212u, 4260353470u, 4260514019u, 4260669958u,
+  4260821380u, 4260968374u, 4261111028u, 4261249421u, 4261383632u,
+  4261513736u, 4261639802u, 4261761900u, 4261880092u, 4261994441u,
+  4262105003u, 4262211835u, 4262314988u, 4262414513u, 4262510454u,
+  4262602857u, 4262691764u, 4262777212u, 4262859239u, 4262937878u,
+  4263013162u, 4263085118u, 4263153776u, 4263219158u, 4263281289u,
+  4263340187u, 4263395872u, 4263448358u, 4263497660u, 4263543789u,
+  4263586755u, 4263626565u, 4263663224u, 4263696735u, 4263727099u,
+  4263754314u, 4263778377u, 4263799282u, 4263817020u, 4263831582u,
+  4263842955u, 4263851124u, 4263856071u, 4263857776u, 4263856218u,
+  4263851370u, 4263843206u, 4263831695u, 4263816804u, 4263798497u,
+  4263776735u, 4263751476u, 4263722676u, 4263690284u, 4263654251u,
+  4263614520u, 4263571032u, 4263523724u, 4263472530u, 4263417377u,
+  4263358192u, 4263294892u, 4263227394u, 4263155608u, 4263079437u,
+  4262998781u, 4262913534u, 4262823581u, 4262728804u, 4262629075u,
+  4262524261u, 4262414220u, 4262298801u, 4262177846u, 4262051187u,
+  4261918645u, 4261780032u, 4261635148u, 4261483780u, 4261325704u,
+  4261160681u, 4260988457u, 4260808763u, 4260621313u, 4260425802u,
+  4260221905u, 4260009277u, 4259787550u, 4259556329u, 4259315195u,
+  4259063697u, 4258801357u, 4258527656u, 4258242044u, 4257943926u,
+  4257632664u, 4257307571u, 4256967906u, 4256612870u, 4256241598u,
+  4255853155u, 4255446525u, 4255020608u, 4254574202u, 4254106002u,
+  4253614578u, 4253098370u, 4252555662u, 4251984571u, 4251383021u,
+  4250748722u, 4250079132u, 4249371435u, 4248622490u, 4247828790u,
+  4246986404u, 4246090910u, 4245137315u, 4244119963u, 4243032411u,
+  4241867296u, 4240616155u, 4239269214u, 4237815118u, 4236240596u,
+  4234530035u, 4232664930u, 4230623176u, 4228378137u, 4225897409u,
+  4223141146u, 4220059768u, 4216590757u, 4212654085u, 4208145538u,
+  4202926710u, 4196809522u, 4189531420u, 4180713890u, 4169789475u,
+  4155865042u, 4137444620u, 4111806704u, 4073393724u, 4008685917u,
+  3873074895u
+};
+
+static const double zigWe[256] =
+{
+  2.0249554585048198e-09, 1.4866740399734205e-11, 2.4409617196257019e-11,
+  3.1968807089142434e-11, 3.8446770646650347e-11, 4.4228203972434112e-11,
+  4.9516444707046597e-11, 5.4433588650931181e-11, 5.9059440015327192e-11,
+  6.3449420379115524e-11, 6.7643810876464267e-11, 7.1672944974835315e-11,
+  7.5560323199467426e-11, 7.9324580976935741e-11, 8.298078557904521e-11,
+  8.6541321438250886e-11, 9.0016512652187109e-11, 9.3415071930799696e-11,
+  9.6744431555352919e-11, 1.0001099208030049e-10, 1.0322031240760055e-10,
+  1.0637725725104457e-10, 1.0948611308870936e-10, 1.1255068044491511e-10,
+  1.1557434814019747e-10, 1.1856015362861798e-10, 1.2151083247552875e-10,
+  1.2442885926858554e-10, 1.2731648170466222e-10, 1.3017574919190648e-10,
+  1.3300853700670057e-10, 1.3581656682043475e-10, 1.3860142424039064e-10,
+  1.4136457387830522e-10, 1.4410737235911022e-10, 1.468310796035191e-10,
+  1.495368686561783e-10, 1.5222583428203639e-10, 1.548990005144558e-10,
+  1.5755732730718325e-10, 1.6020171641692171e-10, 1.6283301662263209e-10,
+  1.6545202837084708e-10, 1.6805950792244488e-10, 1.7065617106490835e-10,
+  1.7324269644462167e-10, 1.7581972856586329e-10, 1.7838788049654857e-10,
+  1.8094773631522604e-10, 1.8349985332914868e-10, 1.8604476408927817e-10,
+  1.8858297822471151e-10, 1.9111498411614671e-10, 1.9364125042554713e-10,
+  1.9616222749705577e-10, 1.986783486423947e-10, 2.0119003132241833e-10,
+  2.0369767823513203e-10, 2.0620167831931019e-10, 2.0870240768182279e-10,
+  2.112002304558848e-10, 2.136954995966615e-10, 2.1618855761997602e-10,
+  2.1867973728926396e-10, 2.2116936225538936e-10, 2.2365774765346773e-10,
+  2.2614520066042933e-10, 2.2863202101668828e-10, 2.3111850151495869e-10,
+  2.336049284589698e-10, 2.3609158209457405e-10, 2.3857873701551362e-10,
+  2.4106666254590428e-10, 2.4355562310131329e-10, 2.4604587853014233e-10,
+  2.4853768443687966e-10, 2.5103129248865199e-10, 2.5352695070638909e-10,
+  2.5602490374180384e-10, 2.5852539314129605e-10, 2.6102865759779895e-10,
+  2.6353493319150911e-10, 2.6604445362036835e-10, 2.6855745042110159e-10,
+  2.7107415318155595e-10, 2.735947897450323e-10, 2.7611958640725362e-10,
+  2.7864876810656891e-10, 2.8118255860795257e-10, 2.8372118068132283e-10,
+  2.8626485627466989e-10, 2.8881380668245368e-10, 2.9136825270970607e-10,
+  2.9392841483224504e-10, 2.9649451335338866e-10, 2.9906676855753434e-10,
+  3.0164540086095204e-10, 3.0423063096012276e-10, 3.0682267997793922e-10,
+  3.0942176960807172e-10, 3.120281222577913e-10, 3.1464196118953024e-10,
+  3.1726351066145236e-10, 3.1989299606729509e-10, 3.2253064407574023e-10,
+  3.2517668276956318e-10, 3.2783134178480468e-10, 3.3049485245020638e-10,
+  3.3316744792714682e-10, 3.3584936335031208e-10, 3.385408359693346e-10,
+  3.4124210529163118e-10, 3.4395341322667268e-10, 3.4667500423191701e-10,
+  3.4940712546063962e-10, 3.5215002691189675e-10, 3.5490396158286035e-10,
+  3.5766918562376672e-10, 3.6044595849572514e-10, 3.6323454313163818e-10,
+  3.6603520610049112e-10, 3.6884821777527412e-10, 3.7167385250480909e-10,
+  3.7451238878976035e-10, 3.7736410946311836e-10, 3.8022930187545505e-10,
+  3.8310825808526086e-10, 3.8600127505468491e-10, 3.8890865485101279e-10,
+  3.9183070485423172e-10, 3.9476773797104552e-10, 3.9772007285572071e-10,
+  4.0068803413816153e-10, 4.0367195265963012e-10, 4.0667216571654994e-10,
+  4.0968901731285145e-10, 4.1272285842134283e-10, 4.1577404725461407e-10,
+  4.1884294954601002e-10, 4.2192993884123649e-10, 4.2503539680119604e-10,
+  4.2815971351668243e-10, 4.3130328783559985e-10, 4.3446652770341104e-10,
+  4.3764985051756069e-10, 4.4085368349666444e-10, 4.4407846406530314e-10,
+  4.4732464025531173e-10, 4.5059267112450964e-10, 4.5388302719387827e-10,
+  4.5719619090425536e-10, 4.6053265709368553e-10, 4.6389293349664151e-10,
+  4.6727754126640966e-10, 4.7068701552202169e-10, 4.7412190592120656e-10,
+  4.7758277726093915e-10, 4.8107021010727083e-10, 4.8458480145624524e-10,
+  4.8812716542783108e-10, 4.9169793399494223e-10, 4.9529775774976463e-10,
+  4.9892730670977461e-10, 5.0258727116600781e-10, 5.0627836257633195e-10,
+  5.1000131450668475e-10, 5.1375688362346617e-10, 5.1754585074052172e-10,
+  5.2136902192442454e-10, 5.2522722966205807e-10, 5.2912133409482337e-10,
+  5.3305222432414786e-10, 5.3702081979335778e-10, 5.4102807175139843e-10,
+  5.4507496480435043e-10, 5.4916251856119817e-10, 5.5329178938086676e-10,
+  5.5746387222815783e-10, 5.6167990264689383e-10, 5.6594105885932732e-10,
+  5.7024856400169711e-10, 5.7460368850672781e-10, 5.7900775264487874e-10,
+  5.8346212923726911e-10, 5.8796824655445066e-10, 5.9252759141658261e-10,
+  5.9714171251210103e-10, 6.0181222395369397e-10, 6.0654080909230705e-10,
+  6.1132922461204966e-10, 6.1617930493126919e-10, 6.2109296693775583e-10,
+  6.2607221508906402e-10, 6.3111914691234304e-10, 6.3623595894191043e-10,
+  6.4142495313714003e-10, 6.4668854382814863e-10, 6.520292652423359e-10,
+  6.5744977967116044e-10, 6.6295288634374581e-10, 6.6854153108213581e-10,
+  6.7421881682242878e-10, 6.7998801509680825e-10, 6.8585257858388383e-10,
+  6.9181615484903926e-10, 6.9788260141297635e-10, 7.0405600230574674e-10,
+  7.1034068628574297e-10, 7.1674124692894912e-10, 7.2326256482392343e-10,
+  7.2990983214332897e-10, 7.3668857990437663e-10, 7.4360470827954072e-10,
+  7.5066452037689093e-10, 7.578747599782558e-10, 7.6524265380554776e-10,
+  7.7277595898386961e-10, 7.8048301648817006e-10, 7.8837281150284949e-10,
+  7.964550417966978e-10, 8.0474019542633808e-10, 8.1323963933951936e-10,
+  8.2196572076747075e-10, 8.3093188368909736e-10, 8.4015280313997575e-10,
+  8.4964454075341733e-10, 8.5942472569584664e-10, 8.6951276614326312e-10,
+  8.7993009770561058e-10, 8.9070047683137269e-10, 9.0185032933939347e-10,
+  9.1340916700090881e-10, 9.2541008877423724e-10, 9.3789038822240069e-10,
+  9.5089229531779803e-10, 9.6446388998629316e-10, 9.7866023744810505e-10,
+  9.9354481331011954e-10, 1.0091913119697238e-09, 1.0256859691519288e-09,
+  1.0431305846498463e-09, 1.0616465149697337e-09, 1.0813800351275404e-09,
+  1.1025096747562698e-09, 1.1252564706432517e-09, 1.1498986477733807e-09,
+  1.1767932423347028e-09, 1.2064090187897797e-09, 1.2393785886826128e-09,
+  1.2765849538906782e-09, 1.3193139264951723e-09, 1.3695434471116157e-09,
+  1.4305498138471953e-09, 1.5083650345524605e-09, 1.6160853275511056e-09,
+  1.7921248148501588e-09
+};
+
+static const double zigFe[256] =
+{
+  1, 0.93814368086219635, 0.9004699299257618,
+  0.87170433238121592, 0.84778550062400004, 0.82699329664305943,
+  0.80842165152301648, 0.79152763697250306, 0.77595685204012244,
+  0.76146338884990261, 0.7478686219852011, 0.73503809243142915,
+  0.72286765959357735, 0.71127476080508101, 0.70019265508279294,
+  0.68956649611708254, 0.67935057226476969, 0.66950631673192884,
+  0.66000084107900359, 0.65080583341457476, 0.64189671642726964,
+  0.63325199421436951, 0.6248527387036692, 0.61668218091521076,
+  0.60872538207962512, 0.60096896636523522, 0.59340090169173632,
+  0.58601031847727081, 0.57878735860284769, 0.57172304866482837,
+  0.56480919291240272, 0.55803828226258989, 0.55140341654064362,
+  0.54489823767244183, 0.53851687200286402, 0.53225388026304532,
+  0.52610421398362173, 0.52006317736823549, 0.51412639381475045,
+  0.50828977641064466, 0.5025495018413495, 0.49690198724155127,
+  0.4913438695940342, 0.48587198734188652, 0.48048336393045576,
+  0.47517519303737887, 0.46994482528396148, 0.46478975625042762,
+  0.45970761564213908, 0.45469615747461684, 0.44975325116275633,
+  0.44487687341454984, 0.44006510084235517, 0.43531610321563785,
+  0.43062813728846006, 0.42599954114303556, 0.4214287289976178,
+  0.41691418643300404, 0.41245446599716229, 0.40804818315203345,
+  0.40369401253053133, 0.39939068447523213, 0.39513698183329116,
+  0.39093173698479811, 0.38677382908413865, 0.38266218149601078,
+  0.37859575940958173, 0.37457356761590305, 0.37059464843514689,
+  0.36665807978151504, 0.36276297335481866, 0.35890847294875056,
+  0.35509375286678818, 0.351318016437484, 0.34758049462163765,
+  0.34388044470450307, 0.34021714906678069, 0.33658991402867827,
+  0.33299806876180965, 0.32944096426413705, 0.32591797239355691,
+  0.32242848495608983, 0.31897191284495791, 0.31554768522712956,
+  0.31215524877418016, 0.30879406693456074, 0.30546361924459081,
+  0.30216340067569408, 0.29889292101558229, 0.2956517042812617,
+  0.29243928816189307, 0.28925522348967819, 0.28609907373707727,
+  0.28297041453878119, 0.27986883323697331, 0.27679392844851775,
+  0.27374530965280336, 0.27072259679906047, 0.26772541993204524,
+  0.26475341883506259, 0.26180624268936331, 0.25888354974901656,
+  0.25598500703041571, 0.25311029001562979, 0.25025908236886263,
+  0.24743107566532793, 0.24462596913189236, 0.24184346939887746,
+  0.23908329026244937, 0.23634515245705984, 0.23362878343743348,
+  0.23093391716962755, 0.22826029393071681, 0.22560766011668415,
+  0.22297576805812028, 0.22036437584335958, 0.21777324714870061,
+  0.21520215107537877, 0.21265086199297836, 0.21011915938898837,
+  0.20760682772422212, 0.20511365629383779, 0.2026394390937091,
+  0.20018397469191135, 0.19774706610509893, 0.19532852067956327,
+  0.19292814997677141, 0.19054576966319545, 0.18818119940425435,
+  0.18583426276219714, 0.18350478709776744, 0.18119260347549626,
+  0.17889754657247828, 0.17661945459049483, 0.17435816917135341,
+  0.17211353531531998, 0.16988540130252755, 0.16767361861725008,
+  0.16547804187493589, 0.16329852875190168, 0.1611349399175919,
+  0.15898713896931407, 0.15685499236936509, 0.15473836938446794,
+  0.15263714202744272, 0.15055118500103976, 0.14848037564386662,
+  0.14642459387834475, 0.14438372216063458, 0.14235764543247201,
+  0.14034625107486226, 0.13834942886358001, 0.13636707092642864,
+  0.13439907170221341, 0.13244532790138733, 0.13050573846833061,
+  0.12858020454522801, 0.1266686294375105, 0.12477091858083077,
+  0.12288697950954494, 0.12101672182667463, 0.11916005717532749,
+  0.11731689921155537, 0.11548716357863334, 0.11367076788274413,
+  0.11186763167005613, 0.11007767640518522, 0.1083008254510336,
+  0.10653700405000148, 0.10478613930657001, 0.10304816017125756,
+  0.10132299742595349, 0.099610583670637007, 0.097910853311492074,
+  0.096223742550432659, 0.094549189376055692, 0.092887133556043361,
+  0.091237516631039961, 0.089600281910032678, 0.087975374467270037,
+  0.086362741140756732, 0.084762330532367952, 0.083174093009632216,
+  0.081597980709237239, 0.080033947542319725, 0.078481949201606227,
+  0.076941943170480309, 0.075413888734058201, 0.073897746992364552,
+  0.07239348087570853, 0.070901055162371593, 0.069420436498728505,
+  0.067951593421936365, 0.066494496385339552, 0.065049117786753541,
+  0.063615431999807098, 0.062193415408540759, 0.06078304644547939,
+  0.059384305633420016, 0.057997175631200402, 0.05662164128374262,
+  0.055257689676696788, 0.053905310196045816, 0.052564494593071408,
+  0.051235237055125983, 0.049917534282706066, 0.048611385573379198,
+  0.047316792913181249, 0.046033761076174871, 0.044762297732942991,
+  0.043502413568887892, 0.042254122413315935, 0.041017441380414528,
+  0.03979239102337382, 0.038578995503074545, 0.037377282772959049,
+  0.03618728478193111, 0.035009037697397091, 0.033842582150874011,
+  0.032687963508959222, 0.031545232172893289, 0.030414443910466285,
+  0.029295660224637071, 0.028188948763978306, 0.027094383780955467,
+  0.026012046645133884, 0.024942026419731454, 0.023884420511557845,
+  0.022839335406384914, 0.021806887504283261, 0.020787204072577802,
+  0.019780424338009424, 0.018786700744695708, 0.017806200410911039,
+  0.016839106826039625, 0.015885621839972847, 0.014945968011690829,
+  0.014020391403181618, 0.013109164931254677, 0.012212592426255064,
+  0.011331013597834288, 0.010464810181029675, 0.0096144136425019046,
+  0.0087803149858086734, 0.0079630774380167399, 0.0071633531836346855,
+  0.0063819059373188833, 0.005619642207205189, 0.0048776559835421052,
+  0.0041572951208335126, 0.0034602647778366304, 0.0027887987935738107,
+  0.0021459677437186517, 0.0015362997803013297, 0.00096726928232694837,
+  0.00045413435384129814
+};
+
+#endif
@@ -0,0 +1,128 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Per-phase timing histograms
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Constantes publiques ========================================================
+
+const char* cPhaseNoms[PHASE_NOMBRE] =
+  {"media add", "FEC scan", "recovery", "cascade", "read-out", "cleanup"};
+
+// Fonctions publiques =========================================================
+
+// Création de nouveaux chronos (vides), étalonne sInstant_Ticks       ---------
+// Remarque : ne pas oublier de faire le ménage avec sChrono_Release ! ---------
+//> Pointeur sur les nouveaux chronos ou 0 si problème
+sChrono* sChrono_New()
+{
+  sChrono* _chrono = AlignedMalloc (sizeof (sChrono));
+  IFNOT    (_chrono, 0) // Allocation ratée ?
+
+  sChrono_Reset (_chrono);
+
+  sInstant_NsParTick(); // Etalonnage hors des phases chronométrées
+
+  return _chrono;
+}
+
+// Libère la mémoire allouée par des chronos -----------------------------------
+void sChrono_Release
+  (sChrono* pChrono) //: Chronos à libérer
+{
+  ASSERTpc (pChrono,, cExNullPtr)
+
+  AlignedFree (pChrono);
+}
+
+// Remet tous les chronos à zéro -----------------------------------------------
+void sChrono_Reset
+  (sChrono* pChrono) //: Chronos à vider
+{
+  ASSERTpc (pChrono,, cExNullPtr)
+
+  unsigned no;
+
+  for (no = 0; no < PHASE_NOMBRE; no++) sHisto_Reset (&pChrono->phases[no]);
+}
+
+// Ajoute la durée d'une phase -------------------------------------------------
+void sChrono_Add
+  (sChrono* pChrono, //: Chronos à compléter
+   ePhase   pPhase,  //: Phase chronométrée
+   uint64_t pTicks)  //: Durée de la phase (ticks)
+{
+  ASSERTpc (pChrono,,               cExNullPtr)
+  ASSERTpc (pPhase < PHASE_NOMBRE,, cExUndefined)
+
+  sHisto_Add (&pChrono->phases[pPhase], pTicks);
+}
+
+// Copie l'état courant des chronos (ex. avant un Reset périodique) ------------
+void sChrono_Snapshot
+  (const sChrono* pChrono, //: Chronos à copier
+         sChrono* pCopie)  //: Copie
+{
+  ASSERTpc (pChrono,, cExNullPtr)
+  ASSERTpc (pCopie,,  cExNullPtr)
+
+  memcpy (pCopie, pChrono, sizeof (sChrono));
+}
+
+// Temps total passé dans une phase --------------------------------------------
+//> Durée totale en ms
+double sChrono_TotalMs
+  (const sChrono* pChrono, //: Chronos à interroger
+         ePhase   pPhase)  //: Phase voulue
+{
+  ASSERTpc (pChrono,                0, cExNullPtr)
+  ASSERTpc (pPhase < PHASE_NOMBRE, 0, cExUndefined)
+
+  return pChrono->phases[pPhase].somme * sInstant_NsParTick() * 1e-6;
+}
+
+// Affiche les chronos : total, nombre et distribution de chaque phase ---------
+void sChrono_Print
+  (const sChrono* pChrono) //: Chronos à afficher
+{
+  ASSERTpc (pChrono,, cExNullPtr)
+
+  double   _ns = sInstant_NsParTick();
+  unsigned no;
+
+  for (no = 0; no < PHASE_NOMBRE; no++)
+  {
+    const sHisto* _h = &pChrono->phases[no];
+
+    PRINT1 (cMsgPrintChrono, cPhaseNoms[no], sChrono_TotalMs (pChrono, no),
+            (unsigned long long)_h->nombre,
+            sHisto_Percentile (_h, 50) * _ns,
+            sHisto_Percentile (_h, 99) * _ns,
+            sHisto_Percentile (_h, 100) * _ns)
+  }
+
+  PRINT1 ("\n")
+}
@@ -0,0 +1,84 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Per-phase timing histograms
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SCHRONO__
+#define __SCHRONO__
+
+// Constantes ==================================================================
+
+// Phases chronométrées des algorithmes (chaque durée est exclusive : une  -----
+// phase imbriquée, ex. la cascade récursive, n'est pas comptée deux fois) -----
+typedef enum
+{
+  PHASE_MEDIA,     //. Ajout d'un paquet média au buffer
+  PHASE_SCAN,      //. Analyse d'un paquet de FEC (paquets protégés, waits)
+  PHASE_RECUP,     //. Récupération d'un paquet média (forge et xor)
+  PHASE_CASCADE,   //. Mise à jour des waits liés (recherche de cascade)
+  PHASE_LECTURE,   //. Lecture d'un paquet média du buffer
+  PHASE_NETTOYAGE, //. Suppression des FEC devenus inutiles après lecture
+  PHASE_NOMBRE
+}
+  ePhase;
+
+extern const char* cPhaseNoms[PHASE_NOMBRE]; //. Noms (affichage, export)
+
+// Macros de chronométrage                                                  ----
+// Remarque : OPTION_CHRONO_IS_NULL (smpte.h) les supprime à la compilation ----
+#ifdef OPTION_CHRONO_IS_NULL
+  #define CHRONO_DEBUT(chrono)           0
+  #define CHRONO_FIN(chrono,phase,debut) { (void)(debut); }
+#else
+  #define CHRONO_DEBUT(chrono) ((chrono) ? sInstant_Ticks() : 0)
+  #define CHRONO_FIN(chrono,phase,debut) \
+  { \
+    if (chrono) sChrono_Add (chrono, phase, sInstant_Ticks() - (debut)); \
+  }
+#endif
+
+// Types de données ============================================================
+
+// Chronos d'une session : un histogramme log-linéaire de durées (ticks de -----
+// sInstant_Ticks) par phase, à copier (Snapshot) et remettre à zéro       -----
+typedef struct
+{
+  sHisto phases[PHASE_NOMBRE]; //. Durées de chaque phase (ticks)
+}
+  sChrono;
+
+// Déclaration des Fonctions ===================================================
+
+sChrono* sChrono_New     ();
+void     sChrono_Release (sChrono*);
+void     sChrono_Reset   (sChrono*);
+void     sChrono_Print   (const sChrono*);
+
+void sChrono_Add      (sChrono*, ePhase, uint64_t pTicks);
+void sChrono_Snapshot (const sChrono*, sChrono* pCopie);
+
+double sChrono_TotalMs (const sChrono*, ePhase);
+
+#endif
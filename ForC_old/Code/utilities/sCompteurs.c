@@ -0,0 +1,218 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Hardware performance counters
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+#ifdef __linux__
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <linux/perf_event.h>
+#endif
+
+// Constantes publiques ========================================================
+
+const char* cCompteurNoms[CPT_NOMBRE] =
+  {"cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses",
+   "task_clock_ns", "page_faults"};
+
+// Fonctions privées ===========================================================
+
+#ifdef __linux__
+
+// Ouvre un compteur du thread appelant (désactivé, hors noyau) ----------------
+//> Descripteur du compteur ou -1 si indisponible
+static int Ouvre
+  (uint32_t pType,   //: Type perf (PERF_TYPE_...)
+   uint64_t pConfig, //: Evénement compté
+   int      pChef)   //: Chef de groupe (-1 = devient chef)
+{
+  struct perf_event_attr _attr;
+  memset (&_attr, 0, sizeof (_attr));
+
+  _attr.size           = sizeof (_attr);
+  _attr.type           = pType;
+  _attr.config         = pConfig;
+  _attr.disabled       = pChef < 0; // Les membres suivent leur chef
+  _attr.exclude_kernel = 1;
+  _attr.exclude_hv     = 1;
+  _attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED |
+                         PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  return syscall (__NR_perf_event_open, &_attr, 0, -1, pChef, 0);
+}
+
+#endif
+
+// Fonctions publiques =========================================================
+
+// Ouvre les compteurs disponibles du thread appelant (désactivés)        ------
+// Remarque : ne pas oublier de faire le ménage avec sCompteurs_Release ! ------
+//> Nouveau jeu de compteurs (éventuellement tous indisponibles)
+sCompteurs sCompteurs_New()
+{
+  sCompteurs _compteurs;
+  unsigned   no;
+
+  _compteurs.chef  = -1;
+  _compteurs.actif = false;
+
+  for (no = 0; no < CPT_NOMBRE; no++) _compteurs.fd[no] = -1;
+
+#ifdef __linux__
+  static const uint32_t _types[CPT_NOMBRE] =
+  {
+    PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE,
+    PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_SOFTWARE,
+    PERF_TYPE_SOFTWARE
+  };
+
+  static const uint64_t _configs[CPT_NOMBRE] =
+  {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_SW_TASK_CLOCK,
+    PERF_COUNT_SW_PAGE_FAULTS
+  };
+
+  for (no = 0; no < CPT_NOMBRE; no++)
+  {
+    _compteurs.fd[no] = Ouvre (_types[no], _configs[no], _compteurs.chef);
+
+    if (_compteurs.chef < 0) _compteurs.chef = _compteurs.fd[no];
+  }
+#endif
+
+  return _compteurs;
+}
+
+// Ferme les compteurs ---------------------------------------------------------
+void sCompteurs_Release
+  (sCompteurs* pCompteurs) //: Compteurs à fermer
+{
+  ASSERTpc (pCompteurs,, cExNullPtr)
+
+  unsigned no;
+
+  for (no = 0; no < CPT_NOMBRE; no++)
+  {
+    if (pCompteurs->fd[no] >= 0) close (pCompteurs->fd[no]);
+    pCompteurs->fd[no] = -1;
+  }
+
+  pCompteurs->chef = -1;
+}
+
+// Remet les compteurs à zéro (sans changer leur état) -------------------------
+void sCompteurs_Reset
+  (sCompteurs* pCompteurs) //: Compteurs à remettre à zéro
+{
+  ASSERTpc (pCompteurs,, cExNullPtr)
+
+#ifdef __linux__
+  if (pCompteurs->chef >= 0)
+  {
+    ioctl (pCompteurs->chef, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+}
+
+// Active le comptage (tout le groupe, un seul appel système) ------------------
+void sCompteurs_Start
+  (sCompteurs* pCompteurs) //: Compteurs à activer
+{
+  ASSERTpc (pCompteurs,, cExNullPtr)
+
+#ifdef __linux__
+  if (pCompteurs->chef >= 0)
+  {
+    ioctl (pCompteurs->chef, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+
+  pCompteurs->actif = true;
+}
+
+// Suspend le comptage (les valeurs sont conservées) ---------------------------
+void sCompteurs_Stop
+  (sCompteurs* pCompteurs) //: Compteurs à suspendre
+{
+  ASSERTpc (pCompteurs,, cExNullPtr)
+
+#ifdef __linux__
+  if (pCompteurs->chef >= 0)
+  {
+    ioctl (pCompteurs->chef, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+
+  pCompteurs->actif = false;
+}
+
+// Le compteur est-il fourni par le noyau et la machine ? ----------------------
+//> Compteur disponible ?
+bool sCompteurs_IsDispo
+  (const sCompteurs* pCompteurs, //: Compteurs à interroger
+         eCompteur   pCompteur)  //: Compteur voulu
+{
+  ASSERTpc (pCompteurs,             false, cExNullPtr)
+  ASSERTpc (pCompteur < CPT_NOMBRE, false, cExUndefined)
+
+  return pCompteurs->fd[pCompteur] >= 0;
+}
+
+// Lit la valeur d'un compteur, extrapolée si le noyau a dû le multiplexer -----
+// (le compteur n'a alors compté que pendant une partie du temps activé).  -----
+// Un compteur que le noyau n'a jamais placé sur la PMU n'a pas de valeur  -----
+//> Lecture réussie (compteur disponible et ayant compté) ?
+bool sCompteurs_Read
+  (const sCompteurs* pCompteurs, //: Compteurs à lire
+         eCompteur   pCompteur,  //: Compteur voulu
+         double*     pValeur)    //: Valeur lue
+{
+  ASSERTpc (pCompteurs,             false, cExNullPtr)
+  ASSERTpc (pCompteur < CPT_NOMBRE, false, cExUndefined)
+  ASSERTpc (pValeur,                false, cExNullPtr)
+
+  *pValeur = 0;
+
+  if (pCompteurs->fd[pCompteur] < 0) return false;
+
+  uint64_t _lu[3]; // Valeur, temps activé, temps compté
+
+  bool ok = read (pCompteurs->fd[pCompteur], _lu, sizeof (_lu)) ==
+    sizeof (_lu);
+  IFNOT (ok,     false) // Lecture ratée ?
+  IFNOT (_lu[2], false) // Jamais compté (groupe jamais placé) ?
+
+  *pValeur = (double)_lu[0] * _lu[1] / _lu[2];
+
+  return true;
+}
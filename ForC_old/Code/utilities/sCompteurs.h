@@ -0,0 +1,75 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Hardware performance counters
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SCOMPTEURS__
+#define __SCOMPTEURS__
+
+// Constantes ==================================================================
+
+// Compteurs lus (perf_event_open, mode utilisateur seul) ----------------------
+typedef enum
+{
+  CPT_CYCLES,       //. Cycles processeur
+  CPT_INSTRUCTIONS, //. Instructions exécutées
+  CPT_L1D_MISS,     //. Lectures ratées du cache L1 de données
+  CPT_LLC_MISS,     //. Accès ratés du dernier niveau de cache
+  CPT_BRANCH_MISS,  //. Branchements mal prédits
+  CPT_TASK_CLOCK,   //. Temps processeur de la tâche (ns, logiciel)
+  CPT_PAGE_FAULTS,  //. Défauts de page (logiciel)
+  CPT_NOMBRE
+}
+  eCompteur;
+
+extern const char* cCompteurNoms[CPT_NOMBRE]; //. Noms (JSON, affichage)
+
+// Types de données ============================================================
+
+// Jeu de compteurs de performance du thread appelant. Les compteurs sont   ----
+// groupés (activés et désactivés ensemble par un seul appel système) ; un  ----
+// compteur que le noyau ou la machine (VM) ne fournit pas est indisponible ----
+// et ignoré, les autres restent utilisables                                ----
+typedef struct
+{
+  int  fd   [CPT_NOMBRE]; //. Descripteur perf_event (-1 = indisponible)
+  int  chef;              //. Descripteur du chef de groupe (-1 = aucun)
+  bool actif;             //. Compteurs en cours de comptage ?
+}
+  sCompteurs;
+
+// Déclaration des Fonctions ===================================================
+
+sCompteurs sCompteurs_New     ();
+void       sCompteurs_Release (sCompteurs*);
+
+void sCompteurs_Reset (sCompteurs*);
+void sCompteurs_Start (sCompteurs*);
+void sCompteurs_Stop  (sCompteurs*);
+
+bool sCompteurs_IsDispo (const sCompteurs*, eCompteur);
+bool sCompteurs_Read    (const sCompteurs*, eCompteur, double* pValeur);
+
+#endif
@@ -0,0 +1,222 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Media + FEC stream generator through a lossy channel
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Fonctions privées ===========================================================
+
+// Ajoute un paquet média à un paquet de FEC (xor) -----------------------------
+static void sGenerateur_Xor
+  (sPaquetFec*         pFec,   //: Paquet de FEC à compléter
+   const sPaquetMedia* pMedia) //: Paquet média protégé
+{
+  unsigned no;
+
+  pFec->DWORD2.TS_recovery ^= pMedia->timeStamp;
+  pFec->DWORD1.PT_recovery ^= pMedia->payloadType;
+
+  for (no = 0; no < pMedia->payloadSize; no++)
+  {
+    pFec->resXor[no] ^= pMedia->payload[no];
+  }
+}
+
+// Emet un paquet de FEC terminé à travers le canal ----------------------------
+//> Paquet de FEC reçu ou 0 si perdu
+static sPaquetFec* sGenerateur_EmetFec
+  (sGenerateur* pGenerateur, //: Générateur émetteur
+   sPaquetFec*  pFec)        //: Paquet de FEC terminé
+{
+  pGenerateur->nbFec++;
+
+  if (sTewfiq_IsOkayOrLost (&pGenerateur->canal)) return pFec;
+
+  pGenerateur->fecPertes++;
+  sPaquetFec_Release (pFec);
+
+  return 0;
+}
+
+// Fonctions publiques =========================================================
+
+// Création d'un nouveau générateur, le flux démarre au paquet média 0  --------
+// Remarque : ne pas oublier de faire le ménage avec sGenerateur_Release ! -----
+//> Pointeur sur le nouveau générateur ou 0 si problème
+sGenerateur* sGenerateur_New
+  (uint8_t  pL,        //: Taille (colonne) de la matrice de FEC
+   uint8_t  pD,        //: Taille (ligne)   de la matrice de FEC
+   bool     pMatrix2D, //: FEC ligne en plus des FEC colonne ?
+   unsigned pPayload,  //: Taille des payloads (0 = métadonnées seules)
+   double   pP,        //: Probabilité de passer de ok à perte
+   double   pQ,        //: Longueur moyenne d'une rafale de pertes (paquets)
+   uint64_t pGraine)   //: Graine du canal et du contenu des payloads
+{
+  ASSERTc (pL >= 1 && pD >= 1, 0, cExMatrixMin)
+  ASSERT  (pPayload <= GENERATEUR_PAYLOAD_MAX, 0,
+           "Payload size is limited to %u bytes", GENERATEUR_PAYLOAD_MAX)
+
+  sGenerateur* _generateur = AlignedCalloc (sizeof (sGenerateur));
+  IFNOT        (_generateur, 0) // Allocation ratée ?
+
+  _generateur->L        = pL;
+  _generateur->D        = pD;
+  _generateur->matrix2D = pMatrix2D;
+  _generateur->payload  = pPayload;
+  _generateur->canal    = sTewfiq_New3 (pP, 1.0 / pQ, pGraine);
+
+  if (pPayload > 0)
+  {
+    _generateur->reserve = malloc (GENERATEUR_PAYLOAD_MAX +
+                                   GENERATEUR_RESERVE);
+    if (!_generateur->reserve)
+    {
+      AlignedFree (_generateur);
+      return 0;
+    }
+
+    // Contenu des payloads, indépendant des tirages du canal
+    sAlea    _alea = sAlea_New (~pGraine);
+    unsigned no;
+
+    for (no = 0; no < GENERATEUR_PAYLOAD_MAX + GENERATEUR_RESERVE; no++)
+    {
+      _generateur->reserve[no] = (uint8_t)sAlea_Next (&_alea);
+    }
+  }
+
+  return _generateur;
+}
+
+// Libère un générateur et les FEC de la matrice en cours ----------------------
+void sGenerateur_Release
+  (sGenerateur* pGenerateur) //: Générateur à libérer
+{
+  ASSERTpc (pGenerateur,, cExNullPtr)
+
+  unsigned _c = pGenerateur->position % pGenerateur->L;
+  unsigned _r = pGenerateur->position / pGenerateur->L;
+  unsigned no;
+
+  // FEC commencés (forgés) mais pas encore émis, dans la matrice en cours
+  for (no = 0; no < pGenerateur->L; no++)
+  {
+    bool _forge = _r > 0 || no < _c;
+    bool _emis  = _r == pGenerateur->D - 1u && no < _c;
+
+    if (_forge && !_emis) sPaquetFec_Release (pGenerateur->col[no]);
+  }
+
+  if (pGenerateur->matrix2D && _c > 0) sPaquetFec_Release (pGenerateur->row);
+
+  free        (pGenerateur->reserve);
+  AlignedFree (pGenerateur);
+}
+
+// Forge le paquet média suivant et l'ajoute aux FEC colonne et ligne ----------
+// Remarque : les FEC sont forgés avec le premier paquet qu'ils protègent ------
+//> Paquet média forgé (à transmettre) ou 0 si problème
+sPaquetMedia* sGenerateur_Encode
+  (sGenerateur* pGenerateur) //: Générateur du flux
+{
+  ASSERTpc (pGenerateur, 0, cExNullPtr)
+
+  sMediaNo _no = pGenerateur->mediaNo;
+  unsigned _c  = pGenerateur->position % pGenerateur->L;
+  unsigned _r  = pGenerateur->position / pGenerateur->L;
+
+  sPaquetMedia* _media = sPaquetMedia_Forge
+    (_no, _no, PAYLOAD_TYPE, pGenerateur->payload, pGenerateur->reserve ?
+     &pGenerateur->reserve[_no % GENERATEUR_RESERVE] : 0);
+  ASSERTc (_media, 0, cExMediaForge)
+
+  if (_r == 0)
+  {
+    pGenerateur->col[_c] = sPaquetFec_Forge
+      (pGenerateur->col0++, pGenerateur->payload, _no, 0, 0,
+       pGenerateur->L, pGenerateur->D, COL, 0);
+    ASSERTc (pGenerateur->col[_c], 0, cExFecForge)
+  }
+
+  sGenerateur_Xor (pGenerateur->col[_c], _media);
+
+  if (pGenerateur->matrix2D)
+  {
+    if (_c == 0)
+    {
+      pGenerateur->row = sPaquetFec_Forge
+        (pGenerateur->row0++, pGenerateur->payload, _no, 0, 0,
+         pGenerateur->L, pGenerateur->D, ROW, 0);
+      ASSERTc (pGenerateur->row, 0, cExFecForge)
+    }
+
+    sGenerateur_Xor (pGenerateur->row, _media);
+  }
+
+  return _media;
+}
+
+// Transmet un paquet média (de sGenerateur_Encode) puis les FEC qu'il ---------
+// termine à travers le canal. Les réceptions sont dans media et fec[] ---------
+void sGenerateur_Transmet
+  (sGenerateur*  pGenerateur, //: Générateur du flux
+   sPaquetMedia* pMedia)      //: Paquet média à transmettre
+{
+  ASSERTpc (pGenerateur && pMedia,, cExNullPtr)
+
+  unsigned _c = pGenerateur->position % pGenerateur->L;
+  unsigned _r = pGenerateur->position / pGenerateur->L;
+
+  pGenerateur->no       = pGenerateur->mediaNo++;
+  pGenerateur->media    = pMedia;
+  pGenerateur->fec[COL] = 0;
+  pGenerateur->fec[ROW] = 0;
+  pGenerateur->nbMedia++;
+
+  if (!sTewfiq_IsOkayOrLost (&pGenerateur->canal))
+  {
+    pGenerateur->pertes++;
+    pGenerateur->media = 0;
+    sPaquetMedia_Release (pMedia);
+  }
+
+  // FEC colonne à la dernière ligne, FEC ligne en fin de ligne
+  if (_r == pGenerateur->D - 1u)
+  {
+    pGenerateur->fec[COL] =
+      sGenerateur_EmetFec (pGenerateur, pGenerateur->col[_c]);
+  }
+
+  if (pGenerateur->matrix2D && _c == pGenerateur->L - 1u)
+  {
+    pGenerateur->fec[ROW] = sGenerateur_EmetFec (pGenerateur, pGenerateur->row);
+  }
+
+  if (++pGenerateur->position == (unsigned)pGenerateur->L * pGenerateur->D)
+  {
+    pGenerateur->position = 0;
+  }
+}
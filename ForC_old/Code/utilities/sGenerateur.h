@@ -0,0 +1,82 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Media + FEC stream generator through a lossy channel
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SGENERATEUR__
+#define __SGENERATEUR__
+
+// Constantes ==================================================================
+
+#define GENERATEUR_PAYLOAD_MAX 8192 //. Taille max du payload d'un paquet média
+#define GENERATEUR_RESERVE     4096 //. Décalages des payloads dans la réserve
+
+// Types de données ============================================================
+
+// Générateur d'un flux média + FEC SMPTE 2022-1 (ordre de FecGenerator, gap ---
+// 0) à travers un canal de Gilbert-Elliott. sGenerateur_Encode forge le     ---
+// paquet média suivant et l'ajoute (xor) aux FEC de sa colonne et de sa     ---
+// ligne, sGenerateur_Transmet le fait passer par le canal, suivi des FEC    ---
+// qu'il termine (colonne à la dernière ligne, ligne en fin de ligne)        ---
+typedef struct
+{
+  uint8_t  L;        //. Taille (colonne) de la matrice de FEC
+  uint8_t  D;        //. Taille (ligne)   de la matrice de FEC
+  bool     matrix2D; //. FEC ligne en plus des FEC colonne ?
+  unsigned payload;  //. Taille des payloads (0 = métadonnées seules)
+  sTewfiq  canal;    //. Canal de transmission (reproductible)
+  uint8_t* reserve;  //. Contenu des payloads (0 si payload = 0)
+
+  sPaquetFec* col[UINT8_MAX + 1]; //. FEC colonne de la matrice en cours
+  sPaquetFec* row;                //. FEC ligne de la ligne en cours
+  sMediaNo    mediaNo;            //. Numéro du prochain paquet média
+  sFecNo      col0;               //. Numéro du prochain FEC colonne
+  sFecNo      row0;               //. Numéro du prochain FEC ligne
+  unsigned    position;           //. Position du prochain média (matrice)
+
+  // Réceptions de la dernière transmission (l'appelant en devient le
+  // propriétaire), 0 si le paquet est perdu ou n'est pas émis
+  sMediaNo      no;     //. Numéro du paquet média transmis
+  sPaquetMedia* media;  //. Paquet média reçu
+  sPaquetFec*   fec[2]; //. FEC [COL] et [ROW] reçus, terminés par ce média
+
+  unsigned long long nbMedia;   //. Paquets média émis
+  unsigned long long nbFec;     //. Paquets de FEC émis
+  unsigned long long pertes;    //. Paquets média perdus
+  unsigned long long fecPertes; //. Paquets de FEC perdus
+}
+  sGenerateur;
+
+// Déclaration des Fonctions ===================================================
+
+sGenerateur* sGenerateur_New     (uint8_t pL, uint8_t pD, bool pMatrix2D,
+                                  unsigned pPayload, double pP, double pQ,
+                                  uint64_t pGraine);
+void         sGenerateur_Release (sGenerateur*);
+
+sPaquetMedia* sGenerateur_Encode   (sGenerateur*);
+void          sGenerateur_Transmet (sGenerateur*, sPaquetMedia* pMedia);
+
+#endif
@@ -0,0 +1,137 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Grid of benchmark parameters (comma-separated lists)
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Fonctions publiques =========================================================
+
+// Création d'une nouvelle grille sans axe (un seul point) ---------------------
+//> Nouvelle grille
+sGrille sGrille_New()
+{
+  sGrille _grille;
+
+  memset (&_grille, 0, sizeof (sGrille));
+  return  _grille;
+}
+
+// Ajoute un axe à la grille, avec une seule valeur (par défaut) ---------------
+//> Numéro de l'axe ajouté
+unsigned sGrille_AddAxe
+  (sGrille*    pGrille, //: Grille à compléter
+   const char* pLabel,  //: Label du paramètre de l'axe (ex. cLabelL)
+   double      pDefaut) //: Valeur si le paramètre n'est pas donné
+{
+  ASSERTpc (pGrille, 0, cExNullPtr)
+  ASSERT   (pGrille->axes < GRILLE_AXES_MAX, 0, "Grid is limited to %u axes",
+            GRILLE_AXES_MAX)
+
+  unsigned _axe = pGrille->axes++;
+
+  pGrille->label [_axe]    = pLabel;
+  pGrille->nombre[_axe]    = 1;
+  pGrille->valeur[_axe][0] = pDefaut;
+
+  return _axe;
+}
+
+// Lit un argument de la ligne de commande s'il est le label d'un axe ----------
+//> Vrai si l'argument est un paramètre de la grille (liste lue)
+bool sGrille_Parametre
+  (sGrille*    pGrille, //: Grille à compléter
+   const char* pArg)    //: Argument (ex. l=4,5,10)
+{
+  ASSERTpc (pGrille, false, cExNullPtr)
+
+  unsigned no;
+
+  for (no = 0; no < pGrille->axes; no++)
+  {
+    char* value = GetParameterValue (pArg, pGrille->label[no], '=');
+
+    if (value != 0)
+    {
+      pGrille->nombre[no] = sGrille_Liste (value, pGrille->valeur[no]);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Nombre de points de la grille (produit des tailles des axes) ----------------
+//> Nombre de points
+unsigned sGrille_Points
+  (const sGrille* pGrille) //: Grille à traiter
+{
+  ASSERTpc (pGrille, 0, cExNullPtr)
+
+  unsigned no, _nb = 1;
+
+  for (no = 0; no < pGrille->axes; no++) _nb *= pGrille->nombre[no];
+
+  return _nb;
+}
+
+// Valeur d'un axe en un point de la grille ------------------------------------
+//> Valeur de l'axe pAxe au point pPoint
+double sGrille_Valeur
+  (const sGrille* pGrille, //: Grille à traiter
+   unsigned       pPoint,  //: Numéro du point (0 à sGrille_Points-1)
+   unsigned       pAxe)    //: Numéro de l'axe (ordre des sGrille_AddAxe)
+{
+  ASSERTpc (pGrille, 0, cExNullPtr)
+  ASSERT   (pAxe < pGrille->axes, 0, "Grid axis %u does not exist", pAxe)
+
+  unsigned no;
+
+  for (no = pGrille->axes - 1; no > pAxe; no--) pPoint /= pGrille->nombre[no];
+
+  return pGrille->valeur[pAxe][pPoint % pGrille->nombre[pAxe]];
+}
+
+// Lit une liste de valeurs séparées par des virgules --------------------------
+//> Nombre de valeurs lues
+unsigned sGrille_Liste
+  (const char* pValeur, //: Texte de la liste (ex. 4,5,10)
+   double*     pListe)  //: Valeurs lues (GRILLE_LISTE_MAX au plus)
+{
+  ASSERTpc (pValeur && pListe, 0, cExNullPtr)
+
+  unsigned _nb = 0;
+  char*    _fin;
+
+  while (_nb < GRILLE_LISTE_MAX)
+  {
+    pListe[_nb++] = strtod (pValeur, &_fin);
+
+    if (*_fin != ',') break;
+    pValeur = _fin + 1;
+  }
+
+  return _nb;
+}
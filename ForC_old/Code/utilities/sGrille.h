@@ -0,0 +1,63 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Grid of benchmark parameters (comma-separated lists)
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SGRILLE__
+#define __SGRILLE__
+
+// Constantes ==================================================================
+
+#define GRILLE_LISTE_MAX 16 //. Nombre max de valeurs d'une liste de paramètres
+#define GRILLE_AXES_MAX  8  //. Nombre max de paramètres (axes) de la grille
+
+// Types de données ============================================================
+
+// Grille de points : produit cartésien de listes de valeurs, une par axe  -----
+// (ex. l=4,5 d=5,10). Les points sont numérotés de 0 à sGrille_Points-1,  -----
+// le dernier axe ajouté variant le plus vite                              -----
+typedef struct
+{
+  const char* label[GRILLE_AXES_MAX];  //. Label du paramètre de chaque axe
+  unsigned    nombre[GRILLE_AXES_MAX]; //. Nombre de valeurs de chaque axe
+  unsigned    axes;                    //. Nombre d'axes de la grille
+
+  double valeur[GRILLE_AXES_MAX][GRILLE_LISTE_MAX]; //. Valeurs de chaque axe
+}
+  sGrille;
+
+// Déclaration des Fonctions ===================================================
+
+sGrille sGrille_New ();
+
+unsigned sGrille_AddAxe    (sGrille*, const char* pLabel, double pDefaut);
+bool     sGrille_Parametre (sGrille*, const char* pArg);
+
+unsigned sGrille_Points (const sGrille*);
+double   sGrille_Valeur (const sGrille*, unsigned pPoint, unsigned pAxe);
+
+unsigned sGrille_Liste (const char* pValeur, double* pListe);
+
+#endif
@@ -0,0 +1,185 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Log-linear latency histogram
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Fonctions privées ===========================================================
+
+// Case d'une valeur : les 2*SOUS premières valeurs ont chacune leur case, -----
+// au-delà la valeur est tronquée à ses BITS+1 bits de poids fort          -----
+//> Numéro de la case
+static inline unsigned Case
+  (uint64_t pValeur) //: Valeur à classer
+{
+  if (pValeur < 2 * SHISTO_SOUS) return (unsigned)pValeur;
+
+  unsigned _e = 63 - __builtin_clzll (pValeur) - SHISTO_BITS;
+
+  return _e * SHISTO_SOUS + (unsigned)(pValeur >> _e);
+}
+
+// Plus grande valeur d'une case (valeur rapportée pour un percentile) ---------
+//> Borne supérieure de la case
+static inline uint64_t Borne
+  (unsigned pCase) //: Numéro de la case
+{
+  if (pCase < 2 * SHISTO_SOUS) return pCase;
+
+  unsigned _e = pCase / SHISTO_SOUS - 1;
+  uint64_t _m = pCase - _e * SHISTO_SOUS;
+
+  return ((_m + 1) << _e) - 1;
+}
+
+// Fonctions publiques =========================================================
+
+// Création d'un nouvel histogramme vide                              ----------
+// Remarque : ne pas oublier de faire le ménage avec sHisto_Release ! ----------
+//> Pointeur sur le nouvel histogramme ou 0 si problème
+sHisto* sHisto_New()
+{
+  sHisto* _histo = AlignedMalloc (sizeof (sHisto));
+  IFNOT   (_histo, 0) // Allocation ratée ?
+
+  sHisto_Reset (_histo);
+
+  return _histo;
+}
+
+// Libère la mémoire allouée par un histogramme --------------------------------
+void sHisto_Release
+  (sHisto* pHisto) //: Histogramme à libérer
+{
+  ASSERTpc (pHisto,, cExNullPtr)
+
+  AlignedFree (pHisto);
+}
+
+// Vide un histogramme (toutes les cases à 0) ----------------------------------
+void sHisto_Reset
+  (sHisto* pHisto) //: Histogramme à vider
+{
+  ASSERTpc (pHisto,, cExNullPtr)
+
+  memset (pHisto, 0, sizeof (sHisto));
+
+  pHisto->min = UINT64_MAX;
+}
+
+// Ajoute une valeur à l'histogramme -------------------------------------------
+void sHisto_Add
+  (sHisto*  pHisto,  //: Histogramme à compléter
+   uint64_t pValeur) //: Valeur à ajouter
+{
+  ASSERTpc (pHisto,, cExNullPtr)
+
+  pHisto->cases[Case (pValeur)]++;
+  pHisto->nombre++;
+  pHisto->somme += pValeur;
+
+  if (pValeur < pHisto->min) pHisto->min = pValeur;
+  if (pValeur > pHisto->max) pHisto->max = pValeur;
+}
+
+// Ajoute le contenu d'un autre histogramme (ex. fusion de threads) ------------
+void sHisto_Merge
+  (      sHisto* pHisto, //: Histogramme à compléter
+   const sHisto* pAutre) //: Histogramme à ajouter
+{
+  ASSERTpc (pHisto,, cExNullPtr)
+  ASSERTpc (pAutre,, cExNullPtr)
+
+  unsigned no;
+
+  for (no = 0; no < SHISTO_CASES; no++) pHisto->cases[no] += pAutre->cases[no];
+
+  pHisto->nombre += pAutre->nombre;
+  pHisto->somme  += pAutre->somme;
+
+  if (pAutre->min < pHisto->min) pHisto->min = pAutre->min;
+  if (pAutre->max > pHisto->max) pHisto->max = pAutre->max;
+}
+
+// Valeur sous laquelle se trouvent pPourcent % des valeurs ajoutées -----------
+// (borne supérieure de la case, bornée par le max exact, 100 = max) -----------
+//> Percentile demandé ou 0 si l'histogramme est vide
+uint64_t sHisto_Percentile
+  (const sHisto* pHisto,    //: Histogramme à interroger
+   double        pPourcent) //: Percentile voulu [0 ; 100]
+{
+  ASSERTpc (pHisto, 0, cExNullPtr)
+
+  if (pHisto->nombre == 0) return 0;
+  if (pPourcent >= 100)    return pHisto->max;
+
+  // Rang (1..nombre) de la valeur cherchée
+  uint64_t _rang = (uint64_t)ceil (pPourcent / 100 * pHisto->nombre);
+  if (_rang < 1) _rang = 1;
+
+  uint64_t _cumul = 0;
+  unsigned no;
+
+  for (no = 0; no < SHISTO_CASES; no++)
+  {
+    _cumul += pHisto->cases[no];
+
+    if (_cumul >= _rang)
+    {
+      uint64_t _borne = Borne (no);
+      return _borne < pHisto->max ? _borne : pHisto->max;
+    }
+  }
+
+  return pHisto->max;
+}
+
+// Moyenne des valeurs ajoutées ------------------------------------------------
+//> Moyenne ou 0 si l'histogramme est vide
+double sHisto_Moyenne
+  (const sHisto* pHisto) //: Histogramme à interroger
+{
+  ASSERTpc (pHisto, 0, cExNullPtr)
+
+  return pHisto->nombre ? pHisto->somme / pHisto->nombre : 0;
+}
+
+// Affiche le résumé d'un histogramme (valeurs multipliées par pEchelle) -------
+void sHisto_Print
+  (const sHisto* pHisto,   //: Histogramme à afficher
+   double        pEchelle) //: Facteur d'échelle (ex. ticks -> ns)
+{
+  ASSERTpc (pHisto,, cExNullPtr)
+
+  PRINT1 ("{nombre=%llu, moyenne=%.1f, p50=%.1f, p99=%.1f, p99.9=%.1f, "
+          "max=%.1f} ",
+          (unsigned long long)pHisto->nombre,
+          sHisto_Moyenne    (pHisto)       * pEchelle,
+          sHisto_Percentile (pHisto, 50)   * pEchelle,
+          sHisto_Percentile (pHisto, 99)   * pEchelle,
+          sHisto_Percentile (pHisto, 99.9) * pEchelle,
+          pHisto->max                      * pEchelle)
+}
@@ -0,0 +1,68 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Log-linear latency histogram
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SHISTO__
+#define __SHISTO__
+
+// Constantes ==================================================================
+
+#define SHISTO_BITS  5                       //. Sous-cases par octave = 2^BITS
+#define SHISTO_SOUS  (1u << SHISTO_BITS)     //. Sous-cases par octave
+#define SHISTO_CASES ((65 - SHISTO_BITS) * SHISTO_SOUS) //. Nombre de cases
+
+// Types de données ============================================================
+
+// Histogramme log-linéaire (à la HdrHistogram) : chaque octave [2^k;2^k+1[  ---
+// est découpée en SHISTO_SOUS cases égales, soit une précision relative     ---
+// meilleure que 1/SHISTO_SOUS (3%) sur toute la plage de uint64_t. Les      ---
+// valeurs sont sans unité (ticks, ns, ...), à convertir lors de l'affichage ---
+typedef struct
+{
+  uint64_t nombre; //. Nombre de valeurs ajoutées
+  uint64_t min;    //. Plus petite valeur ajoutée (exacte)
+  uint64_t max;    //. Plus grande valeur ajoutée (exacte)
+  double   somme;  //. Somme des valeurs (moyenne)
+
+  uint64_t cases[SHISTO_CASES]; //. Nombre de valeurs de chaque case
+}
+  sHisto;
+
+// Déclaration des Fonctions ===================================================
+
+sHisto* sHisto_New     ();
+void    sHisto_Release (sHisto*);
+void    sHisto_Reset   (sHisto*);
+
+void sHisto_Add   (sHisto*, uint64_t pValeur);
+void sHisto_Merge (sHisto*, const sHisto* pAutre);
+
+uint64_t sHisto_Percentile (const sHisto*, double pPourcent);
+double   sHisto_Moyenne    (const sHisto*);
+
+void sHisto_Print (const sHisto*, double pEchelle);
+
+#endif
@@ -0,0 +1,129 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Arrival time records of the test bench streams
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+// Constantes privées ==========================================================
+
+const char*  cBegInstantString = "THIS_IS_AN_ARRIV"; //. Entête -> fichier
+const size_t cBegInstantLength = 16;    //. Longueur de l'entête parsing
+static char  cBegInstantBuffer  [16+1]; //. Buffer lecture de l'entête parsing
+
+// Fonctions publiques =========================================================
+
+// Enregistre un instant d'arrivée vers un fichier (avant le paquet) -----------
+//> Résultat de l'opération / enregistrement réussi ?
+bool sInstant_ToFile
+  (sInstant pInstant, //: Instant à enregistrer
+   FILE*    pFile)    //: Fichier destination
+{
+  ASSERTpc (pFile, false, cExNullPtr)
+
+  bool ok =  (fwrite (cBegInstantString, cBegInstantLength, 1, pFile) == 1);
+  ok = ok && (fwrite (&pInstant,         sizeof (sInstant), 1, pFile) == 1);
+
+  return ok;
+}
+
+// Récupère un instant d'arrivée depuis un fichier. Si le flux ne contient -----
+// pas un instant à cette position, celle-ci est restaurée                 -----
+//> Un instant a-t-il été lu ?
+bool sInstant_FromFile
+  (FILE*     pFile,    //: Fichier source
+   sInstant* pInstant) //: Instant lu
+{
+  ASSERTpc (pFile,    false, cExNullPtr)
+  ASSERTpc (pInstant, false, cExNullPtr)
+
+  fpos_t pos;
+  fgetpos (pFile, &pos);
+
+  bool ok = fread (cBegInstantBuffer, 1, cBegInstantLength, pFile) ==
+    cBegInstantLength;
+
+  IFNOT_OP (ok, fsetpos (pFile, &pos), false) // Lecture ratée ?
+
+  cBegInstantBuffer[cBegInstantLength] = 0;
+
+  // Le flux est bien préfixé ... alors ça doit être bon !
+  ok = strcmp (cBegInstantBuffer, cBegInstantString) == 0;
+  IFNOT_OP (ok, fsetpos (pFile, &pos), false) // Comparaison réussie ?
+
+  ok = fread (pInstant, 1, sizeof (sInstant), pFile) == sizeof (sInstant);
+  IFNOT_OP (ok, fsetpos (pFile, &pos), false) // Lecture ratée ?
+
+  return true;
+}
+
+// Instant courant en ns (horloge monotone brute, insensible aux ajustements ---
+// NTP). Sert de référence pour étalonner sInstant_Ticks                     ---
+//> Instant courant
+sInstant sInstant_Now()
+{
+  struct timespec _t;
+  clock_gettime (CLOCK_MONOTONIC_RAW, &_t);
+
+  return (sInstant)_t.tv_sec * 1000000000ull + _t.tv_nsec;
+}
+
+// Compteur de cycles (TSC sur x86, sinon sInstant_Now) pour chronométrer un ---
+// appel de quelques dizaines de ns. lfence évite que rdtsc ne soit exécuté  ---
+// avant la fin des instructions qui le précèdent                            ---
+// Remarque : suppose un TSC invariant (constant_tsc, nonstop_tsc)           ---
+//> Valeur courante du compteur en ticks
+uint64_t sInstant_Ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  uint32_t _lo, _hi;
+  __asm__ volatile ("lfence\n\trdtsc" : "=a" (_lo), "=d" (_hi) :: "memory");
+
+  return ((uint64_t)_hi << 32) | _lo;
+#else
+  return sInstant_Now();
+#endif
+}
+
+// Durée d'un tick de sInstant_Ticks en ns (étalonnée une fois sur 20 ms) ------
+//> Facteur de conversion ticks -> ns
+double sInstant_NsParTick()
+{
+  static double _nsParTick = 0;
+
+  if (_nsParTick > 0) return _nsParTick;
+
+  sInstant _debut = sInstant_Now();
+  uint64_t _ticks = sInstant_Ticks();
+  sInstant _fin;
+
+  do { _fin = sInstant_Now(); } while (_fin - _debut < 20000000);
+
+  _ticks = sInstant_Ticks() - _ticks;
+
+  _nsParTick = _ticks ? (double)(_fin - _debut) / _ticks : 1;
+
+  return _nsParTick;
+}
@@ -0,0 +1,47 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Arrival time records of the test bench streams
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SINSTANT__
+#define __SINSTANT__
+
+// Types de données ============================================================
+
+// Instant d'arrivée (simulé) d'un paquet en nanosecondes. ErrorsGenerator -----
+// le fait précéder chaque paquet du flux lorsque le modèle de délais est  -----
+// actif, FecDecoder s'en sert pour mesurer la latence de récupération     -----
+typedef uint64_t sInstant;
+
+// Déclaration des Fonctions ===================================================
+
+bool sInstant_ToFile   (sInstant, FILE*);
+bool sInstant_FromFile (FILE*, sInstant*);
+
+sInstant sInstant_Now       ();
+uint64_t sInstant_Ticks     ();
+double   sInstant_NsParTick ();
+
+#endif
@@ -0,0 +1,146 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Memory accounting per structure
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+#define MAX(a,b) ((a) >= (b) ? (a) : (b))
+
+// Constantes publiques ========================================================
+
+const char* cMemoireNoms[MEM_NOMBRE] =
+  {"slot table", "media blocks", "crosses", "wait nodes", "waits", "resXor"};
+
+// Fonctions privées ===========================================================
+
+// Ajoute des objets et octets à un compte (et met à jour ses maximums) --------
+static void Compte
+  (sMemoireCompte* pCompte, //: Compte à mettre à jour
+   int64_t         pObjets, //: Objets ajoutés (négatif = libérés)
+   int64_t         pOctets) //: Octets ajoutés (négatif = libérés)
+{
+  pCompte->objets += pObjets;
+  pCompte->octets += pOctets;
+
+  pCompte->maxObjets = MAX (pCompte->maxObjets, pCompte->objets);
+  pCompte->maxOctets = MAX (pCompte->maxOctets, pCompte->octets);
+}
+
+// Fonctions publiques =========================================================
+
+// Création d'une comptabilité (vide)                                   --------
+// Remarque : ne pas oublier de faire le ménage avec sMemoire_Release ! --------
+//> Pointeur sur la nouvelle comptabilité ou 0 si problème
+sMemoire* sMemoire_New()
+{
+  sMemoire* _memoire = AlignedMalloc (sizeof (sMemoire));
+  IFNOT    (_memoire, 0) // Allocation ratée ?
+
+  sMemoire_Reset (_memoire);
+
+  return _memoire;
+}
+
+// Libère la mémoire allouée par une comptabilité ------------------------------
+void sMemoire_Release
+  (sMemoire* pMemoire) //: Comptabilité à libérer
+{
+  ASSERTpc (pMemoire,, cExNullPtr)
+
+  AlignedFree (pMemoire);
+}
+
+// Remet une comptabilité à zéro (maximums compris) ----------------------------
+void sMemoire_Reset
+  (sMemoire* pMemoire) //: Comptabilité à vider
+{
+  ASSERTpc (pMemoire,, cExNullPtr)
+
+  memset (pMemoire, 0, sizeof (sMemoire));
+}
+
+// Affiche une comptabilité (une ligne par catégorie puis le total) ------------
+void sMemoire_Print
+  (const sMemoire* pMemoire) //: Comptabilité à afficher
+{
+  ASSERTpc (pMemoire,, cExNullPtr)
+
+  unsigned no;
+
+  for (no = 0; no <= MEM_NOMBRE; no++)
+  {
+    const sMemoireCompte* _c = no < MEM_NOMBRE ?
+                                 &pMemoire->categorie[no] : &pMemoire->total;
+
+    PRINT1 (cMsgPrintMemoire, no < MEM_NOMBRE ? cMemoireNoms[no] : "total",
+            (long long)_c->octets, (long long)_c->maxOctets,
+            (long long)_c->objets, (long long)_c->maxObjets)
+  }
+
+  PRINT1 ("\n")
+}
+
+// Comptabilise une allocation (ou une libération) -----------------------------
+void sMemoire_Add
+  (sMemoire* pMemoire,   //: Comptabilité à mettre à jour
+   eMemoire  pCategorie, //: Catégorie de la mémoire
+   int64_t   pObjets,    //: Objets alloués (négatif = libérés)
+   int64_t   pOctets)    //: Octets alloués (négatif = libérés)
+{
+  ASSERTpc (pMemoire,,                cExNullPtr)
+  ASSERTpc (pCategorie < MEM_NOMBRE,, cExUndefined)
+
+  Compte (&pMemoire->categorie[pCategorie], pObjets, pOctets);
+
+  // Les cross occupent la table de slots : déjà comptés dans le total
+  if (pCategorie != MEM_CROSS) Compte (&pMemoire->total, pObjets, pOctets);
+}
+
+// Ajoute une comptabilité à un total (plusieurs sessions ou flux)        ------
+// Remarque : les maximums sont additionnés, c'est donc un majorant du    ------
+//            maximum atteint simultanément par l'ensemble des sessions   ------
+void sMemoire_Somme
+  (      sMemoire* pTotal,   //: Total à compléter
+   const sMemoire* pMemoire) //: Comptabilité à ajouter
+{
+  ASSERTpc (pTotal,,   cExNullPtr)
+  ASSERTpc (pMemoire,, cExNullPtr)
+
+  unsigned no;
+
+  for (no = 0; no <= MEM_NOMBRE; no++)
+  {
+    sMemoireCompte* _t = no < MEM_NOMBRE ?
+                           &pTotal->categorie[no] : &pTotal->total;
+    const sMemoireCompte* _c = no < MEM_NOMBRE ?
+                                 &pMemoire->categorie[no] : &pMemoire->total;
+
+    _t->objets    += _c->objets;
+    _t->octets    += _c->octets;
+    _t->maxObjets += _c->maxObjets;
+    _t->maxOctets += _c->maxOctets;
+  }
+}
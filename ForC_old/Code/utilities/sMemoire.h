@@ -0,0 +1,86 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Memory accounting per structure
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SMEMOIRE__
+#define __SMEMOIRE__
+
+// Constantes ==================================================================
+
+// Catégories de mémoire comptabilisées ----------------------------------------
+typedef enum
+{
+  MEM_SLOTS,  //. Table de slots du buffer média (fenêtre, porte les cross)
+  MEM_MEDIA,  //. Blocs des paquets média (entête + payload)
+  MEM_CROSS,  //. Cross (dans la table de slots, hors total)
+  MEM_NOEUD,  //. Noeuds des arbres de waits
+  MEM_WAIT,   //. Waits (entêtes, recyclés compris)
+  MEM_RESXOR, //. Payloads resXor des waits
+  MEM_NOMBRE
+}
+  eMemoire;
+
+extern const char* cMemoireNoms[MEM_NOMBRE]; //. Noms (affichage, export)
+
+// Macro de comptabilité (sans effet si aucune comptabilité n'est attachée) ----
+#define MEMOIRE(memoire,categorie,objets,octets) \
+{ \
+  if (memoire) sMemoire_Add (memoire, categorie, objets, octets); \
+}
+
+// Types de données ============================================================
+
+// Objets et octets alloués, actuels et maximums (high-water marks) ------------
+typedef struct
+{
+  int64_t objets;    //. Nombre d'objets alloués
+  int64_t octets;    //. Nombre d'octets alloués
+  int64_t maxObjets; //. Maximum atteint par objets
+  int64_t maxOctets; //. Maximum atteint par octets
+}
+  sMemoireCompte;
+
+// Comptabilité mémoire d'une session, par catégorie. Les tailles sont     -----
+// celles demandées à l'allocateur (arrondies à CACHE_LINE pour les blocs  -----
+// alignés), sans le surcoût propre de l'allocateur                        -----
+typedef struct
+{
+  sMemoireCompte categorie[MEM_NOMBRE]; //. Comptes de chaque catégorie
+  sMemoireCompte total;                 //. Toutes catégories (hors cross)
+}
+  sMemoire;
+
+// Déclaration des Fonctions ===================================================
+
+sMemoire* sMemoire_New     ();
+void      sMemoire_Release (sMemoire*);
+void      sMemoire_Reset   (sMemoire*);
+void      sMemoire_Print   (const sMemoire*);
+
+void sMemoire_Add   (sMemoire*, eMemoire, int64_t pObjets, int64_t pOctets);
+void sMemoire_Somme (sMemoire* pTotal, const sMemoire*);
+
+#endif
@@ -0,0 +1,306 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Metrics publication (seqlock) and export
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#include "../smpte.h"
+
+#ifndef OPTION_OS_IS_WINDOWS
+  #include <errno.h>
+  #include <sys/socket.h>
+  #include <sys/un.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+  #define MSG_NOSIGNAL 0 /* Sans lui (BSD), SO_NOSIGPIPE sur la socket */
+#endif
+
+#define UNIX_PREFIXE "unix:" /* Destination = socket Unix locale */
+
+// Fonctions privées ===========================================================
+
+#ifndef OPTION_OS_IS_WINDOWS
+
+// Ouvre en écriture la socket Unix (flux) d'un collecteur local ---------------
+//> Descripteur de la socket connectée ou -1 si problème
+static int OuvreSocket
+  (const char* pChemin) //: Chemin de la socket (sans le préfixe unix:)
+{
+  struct sockaddr_un _adresse;
+
+  IFNOT (strlen (pChemin) < sizeof (_adresse.sun_path), -1)
+
+  memset  (&_adresse, 0, sizeof (_adresse));
+  strncpy (_adresse.sun_path, pChemin, sizeof (_adresse.sun_path) - 1);
+  _adresse.sun_family = AF_UNIX;
+
+  int _fd = socket (AF_UNIX, SOCK_STREAM, 0);
+  IFNOT (_fd >= 0, -1)
+
+#ifdef SO_NOSIGPIPE
+  int _un = 1;
+  setsockopt (_fd, SOL_SOCKET, SO_NOSIGPIPE, &_un, sizeof (_un));
+#endif
+
+  if (connect (_fd, (struct sockaddr*)&_adresse, sizeof (_adresse)) != 0)
+  {
+    close (_fd);
+    return -1;
+  }
+
+  return _fd;
+}
+
+// Envoie un export complet sur la socket d'un collecteur                 ------
+// Remarque : send (MSG_NOSIGNAL) et non stdio, un collecteur qui ferme   ------
+//            la connexion donne EPIPE (export raté) au lieu de SIGPIPE   ------
+//> Envoi complet ?
+static bool EnvoieSocket
+  (int         pFd,     //: Socket connectée
+   const char* pTexte,  //: Export à envoyer
+   size_t      pTaille) //: Taille de l'export (octets)
+{
+  while (pTaille > 0)
+  {
+    ssize_t _envoye = send (pFd, pTexte, pTaille, MSG_NOSIGNAL);
+
+    if (_envoye < 0 && errno == EINTR) continue;
+    IFNOT (_envoye > 0, false) // EPIPE (collecteur parti), ...
+
+    pTexte  += _envoye;
+    pTaille -= _envoye;
+  }
+
+  return true;
+}
+
+#endif
+
+// Fonctions publiques =========================================================
+
+// Création d'une publication (vide)                                      ------
+// Remarque : ne pas oublier de faire le ménage avec sMetriques_Release ! ------
+//> Pointeur sur la nouvelle publication ou 0 si problème
+sMetriques* sMetriques_New()
+{
+  // Alignée sur une ligne de cache : pas de faux partage avec le décodeur
+  sMetriques* _metriques = AlignedMalloc (sizeof (sMetriques));
+  IFNOT      (_metriques, 0) // Allocation ratée ?
+
+  memset (_metriques, 0, sizeof (sMetriques));
+
+  return _metriques;
+}
+
+// Libère la mémoire allouée par une publication -------------------------------
+void sMetriques_Release
+  (sMetriques* pMetriques) //: Publication à libérer
+{
+  ASSERTpc (pMetriques,, cExNullPtr)
+
+  AlignedFree (pMetriques);
+}
+
+// Publie de nouvelles valeurs (un seul écrivain, sans attente ni verrou) ------
+void sMetriques_Publie
+  (sMetriques*     pMetriques, //: Publication à mettre à jour
+   const uint64_t* pValeurs,   //: Valeurs à publier
+   unsigned        pNombre)    //: Nombre de valeurs (max METRIQUES_MAX)
+{
+  ASSERTpc (pMetriques,,               cExNullPtr)
+  ASSERTpc (pValeurs,,                 cExNullPtr)
+  ASSERTpc (pNombre <= METRIQUES_MAX,, cExUndefined)
+
+  uint32_t _sequence = pMetriques->sequence;
+
+  // Séquence impaire puis valeurs : un lecteur concurrent recommencera
+  __atomic_store_n (&pMetriques->sequence, _sequence + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence (__ATOMIC_RELEASE);
+
+  unsigned no;
+
+  for (no = 0; no < pNombre; no++)
+  {
+    __atomic_store_n (&pMetriques->valeurs[no], pValeurs[no], __ATOMIC_RELAXED);
+  }
+
+  __atomic_store_n (&pMetriques->nombre,   pNombre,       __ATOMIC_RELAXED);
+  __atomic_store_n (&pMetriques->sequence, _sequence + 2, __ATOMIC_RELEASE);
+}
+
+// Copie les dernières valeurs publiées (depuis n'importe quel thread) ---------
+//> Nombre de valeurs copiées
+unsigned sMetriques_Lit
+  (const sMetriques* pMetriques, //: Publication à lire
+   uint64_t*         pValeurs)   //: Copie des valeurs (METRIQUES_MAX places)
+{
+  ASSERTpc (pMetriques, 0, cExNullPtr)
+  ASSERTpc (pValeurs,   0, cExNullPtr)
+
+  uint32_t _avant, _apres;
+  unsigned _nombre, no;
+
+  do
+  {
+    _avant = __atomic_load_n (&pMetriques->sequence, __ATOMIC_ACQUIRE);
+
+    _nombre = __atomic_load_n (&pMetriques->nombre, __ATOMIC_RELAXED);
+    if (_nombre > METRIQUES_MAX) _nombre = METRIQUES_MAX;
+
+    for (no = 0; no < _nombre; no++)
+    {
+      pValeurs[no] =
+        __atomic_load_n (&pMetriques->valeurs[no], __ATOMIC_RELAXED);
+    }
+
+    __atomic_thread_fence (__ATOMIC_ACQUIRE);
+    _apres = __atomic_load_n (&pMetriques->sequence, __ATOMIC_RELAXED);
+  }
+  while ((_avant & 1) || _avant != _apres);
+
+  return _nombre;
+}
+
+// Ecrit des valeurs au format demandé -----------------------------------------
+//> Ecriture réussie ?
+bool sMetriques_Ecrit
+  (FILE*            pFlux,        //: Destination
+   eMetriquesFormat pFormat,      //: Format d'écriture
+   const char*      pPrefixe,     //: Préfixe des noms (Prometheus seulement)
+   const sMetrique* pDescription, //: Description de chaque valeur
+   const uint64_t*  pValeurs,     //: Valeurs à écrire
+   unsigned         pNombre)      //: Nombre de valeurs
+{
+  ASSERTpc (pFlux,        false, cExNullPtr)
+  ASSERTpc (pPrefixe,     false, cExNullPtr)
+  ASSERTpc (pDescription, false, cExNullPtr)
+  ASSERTpc (pValeurs,     false, cExNullPtr)
+
+  unsigned no;
+
+  if (pFormat == METRIQUES_JSON) fprintf (pFlux, "{");
+
+  for (no = 0; no < pNombre; no++)
+  {
+    const sMetrique* _m = &pDescription[no];
+
+    if (pFormat == METRIQUES_JSON)
+    {
+      fprintf (pFlux, "%s\"%s\": %llu", no > 0 ? ", " : "",
+               _m->nom, (unsigned long long)pValeurs[no]);
+    }
+    else
+    {
+      fprintf (pFlux, "# HELP %s%s %s\n", pPrefixe, _m->nom, _m->aide);
+      fprintf (pFlux, "# TYPE %s%s %s\n", pPrefixe, _m->nom,
+               _m->jauge ? "gauge" : "counter");
+      fprintf (pFlux, "%s%s %llu\n", pPrefixe, _m->nom,
+               (unsigned long long)pValeurs[no]);
+    }
+  }
+
+  if (pFormat == METRIQUES_JSON) fprintf (pFlux, "}\n");
+
+  return !ferror (pFlux);
+}
+
+// Exporte des valeurs vers un fichier ou vers une socket Unix (unix:...) ------
+// Remarque : le fichier est remplacé d'un bloc (rename), un collecteur   ------
+//            ne lit jamais un export à moitié écrit                      ------
+//> Export réussi ?
+bool sMetriques_Exporte
+  (const char*      pDestination, //: Fichier ou unix:chemin de la socket
+   eMetriquesFormat pFormat,      //: Format d'écriture
+   const char*      pPrefixe,     //: Préfixe des noms (Prometheus seulement)
+   const sMetrique* pDescription, //: Description de chaque valeur
+   const uint64_t*  pValeurs,     //: Valeurs à exporter
+   unsigned         pNombre)      //: Nombre de valeurs
+{
+  ASSERTpc (pDestination, false, cExNullPtr)
+
+  size_t _lPrefixe = strlen (UNIX_PREFIXE);
+
+  if (strncmp (pDestination, UNIX_PREFIXE, _lPrefixe) == 0)
+  {
+#ifdef OPTION_OS_IS_WINDOWS
+    return false;
+#else
+    // Export rédigé en mémoire puis envoyé d'un bloc
+    char*  _texte  = 0;
+    size_t _taille = 0;
+    FILE*  _flux   = open_memstream (&_texte, &_taille);
+    IFNOT (_flux, false)
+
+    bool ok = sMetriques_Ecrit
+      (_flux, pFormat, pPrefixe, pDescription, pValeurs, pNombre);
+
+    ok = (fclose (_flux) == 0) && ok;
+
+    int _fd = ok ? OuvreSocket (pDestination + _lPrefixe) : -1;
+
+    ok = _fd >= 0 && EnvoieSocket (_fd, _texte, _taille);
+
+    if (_fd >= 0) close (_fd);
+    free (_texte);
+
+    return ok;
+#endif
+  }
+
+  char _temporaire[FILENAME_MAX];
+
+  IFNOT (snprintf (_temporaire, sizeof (_temporaire), "%s.tmp", pDestination)
+         < (int)sizeof (_temporaire), false)
+
+  FILE* _flux = fopen (_temporaire, "w");
+  IFNOT (_flux, false)
+
+  bool ok = sMetriques_Ecrit
+    (_flux, pFormat, pPrefixe, pDescription, pValeurs, pNombre);
+
+  ok = (fclose (_flux) == 0) && ok;
+
+  if (ok) ok = rename (_temporaire, pDestination) == 0;
+  if (!ok) remove (_temporaire);
+
+  return ok;
+}
+
+// Format d'export déduit de la destination (.json = JSON) ---------------------
+//> Format JSON si la destination se termine par .json, Prometheus sinon
+eMetriquesFormat sMetriques_Format
+  (const char* pDestination) //: Fichier ou unix:chemin de la socket
+{
+  ASSERTpc (pDestination, METRIQUES_PROMETHEUS, cExNullPtr)
+
+  size_t _l = strlen (pDestination);
+
+  if (_l >= 5 && strcmp (pDestination + _l - 5, ".json") == 0)
+  {
+    return METRIQUES_JSON;
+  }
+
+  return METRIQUES_PROMETHEUS;
+}
@@ -0,0 +1,81 @@
+/**************************************************************************************************\
+        OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
+
+    Description    : Metrics publication (seqlock) and export
+    Main Developer : David Fischer (david.fischer.ch@gmail.com)
+    Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
+    Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
+                     Haute école du paysage, d'ingénierie et d'architecture @ Genève
+                     Telecommunications Laboratory
+\**************************************************************************************************/
+/*
+  This file is part of smpte2022lib Project.
+
+  This project is free software: you can redistribute it and/or modify it under the terms of the
+  EUPL v. 1.1 as provided by the European Commission. This project is distributed in the hope that
+  it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+  or FITNESS FOR A PARTICULAR PURPOSE.
+
+  See the European Union Public License for more details.
+
+  You should have received a copy of the EUPL General Public License along with this project.
+  If not, see he EUPL licence v1.1 is available in 22 languages:
+      22-07-2013, <https://joinup.ec.europa.eu/software/page/eupl/licence-eupl>
+
+  Retrieved from https://github.com/davidfischer-ch/smpte2022lib.git
+*/
+
+#ifndef __SMETRIQUES__
+#define __SMETRIQUES__
+
+// Constantes ==================================================================
+
+#define METRIQUES_MAX 32 /* Nombre max de valeurs d'une publication */
+
+// Formats d'export des métriques ----------------------------------------------
+typedef enum
+{
+  METRIQUES_PROMETHEUS, //. Format texte de Prometheus (HELP, TYPE, valeur)
+  METRIQUES_JSON        //. Un objet JSON sur une ligne
+}
+  eMetriquesFormat;
+
+// Types de données ============================================================
+
+// Description d'une métrique exportée -----------------------------------------
+typedef struct
+{
+  const char* nom;   //. Nom sans préfixe (ex. recovered_total)
+  const char* aide;  //. Description (ligne HELP)
+  bool        jauge; //. Jauge (gauge) ou compteur croissant (counter) ?
+}
+  sMetrique;
+
+// Publication de valeurs protégée par un seqlock : un seul écrivain (le   -----
+// décodeur) qui ne bloque ni n'attend jamais, des lecteurs (supervision)  -----
+// qui recommencent leur copie si une publication l'a chevauchée           -----
+typedef struct
+{
+  uint32_t sequence;                //. Impaire = publication en cours
+  unsigned nombre;                  //. Nombre de valeurs publiées
+  uint64_t valeurs[METRIQUES_MAX];  //. Dernières valeurs publiées
+}
+  sMetriques;
+
+// Déclaration des Fonctions ===================================================
+
+sMetriques* sMetriques_New     ();
+void        sMetriques_Release (sMetriques*);
+
+void     sMetriques_Publie (sMetriques*, const uint64_t* pValeurs, unsigned);
+unsigned sMetriques_Lit    (const sMetriques*, uint64_t* pValeurs);
+
+bool sMetriques_Ecrit   (FILE*, eMetriquesFormat, const char* pPrefixe,
+                         const sMetrique*, const uint64_t* pValeurs, unsigned);
+bool sMetriques_Exporte (const char* pDestination, eMetriquesFormat,
+                         const char* pPrefixe,
+                         const sMetrique*, const uint64_t* pValeurs, unsigned);
+
+eMetriquesFormat sMetriques_Format (const char* pDestination);
+
+#endif
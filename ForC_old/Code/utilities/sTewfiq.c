@@ -1,7 +1,7 @@
 /**************************************************************************************************\
         OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
 
-    Description    : TODO
+    Description    : Gilbert-Elliott channel model (Tewfiq)
     Main Developer : David Fischer (david.fischer.ch@gmail.com)
     Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
     Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
@@ -29,49 +29,71 @@
 
 // Constantes privées ==========================================================
 
-const sTewfiq INIT_TEWFIQ = //. Valeur par défaut d'un Tewfiq
-  {true, 0, 0, 0, 0.001, 1.000};
+const uint64_t TEWFIQ_GRAINE = 1; //. Graine par défaut (New1, New2)
+
+// Fonctions privées ===========================================================
+
+// Passe à l'état suivant et tire la durée du séjour (loi géométrique) ---------
+static void Transition
+  (sTewfiq* pTewfiq) //: Tewfiq utilisé
+{
+  pTewfiq->etat = !pTewfiq->etat;
+
+  if (pTewfiq->etat)
+  {
+    // Paquets ok avant de passer à perte (éventuellement aucun)
+    pTewfiq->reste = sAlea_Geometrique (&pTewfiq->alea, pTewfiq->logP);
+  }
+  else
+  {
+    // Le paquet qui passe à perte est perdu, puis reste à perte (1-q)
+    uint64_t _n = sAlea_Geometrique (&pTewfiq->alea, pTewfiq->logQ);
+
+    pTewfiq->reste = _n < UINT64_MAX ? _n + 1 : UINT64_MAX;
+    pTewfiq->quantitePertes++;
+  }
+}
 
 // Fonctions publiques =========================================================
 
 // Distribution Uniforme [0,1] -------------------------------------------------
 //> Valeur calculée via la loi de probabilité
-float sTewfiq_DistribUni()
+float sTewfiq_DistribUni
+  (sTewfiq* pTewfiq) //: Tewfiq (générateur) utilisé
 {
-  return (float)rand() / (float)RAND_MAX;
+  return sAlea_Uni (&pTewfiq->alea);
 }
 
 // Distribution Exponentielle f(x) = e^-x --------------------------------------
 //> Valeur calculée via la loi de probabilité
-float sTewfiq_DistribExp()
+float sTewfiq_DistribExp
+  (sTewfiq* pTewfiq) //: Tewfiq (générateur) utilisé
 {
-  return - log (1 - sTewfiq_DistribUni() / 1.0001);
+  return sAlea_Exp (&pTewfiq->alea);
 }
 
 // Distribution de Pareto f(x) = a/b(b/x)^(a+1) avec a=2 b=1 -------------------
 //> Valeur calculée via la loi de probabilité
-float sTewfiq_DistribPareto()
+float sTewfiq_DistribPareto
+  (sTewfiq* pTewfiq) //: Tewfiq (générateur) utilisé
 {
-  return 1.0 / sqrt (1.0001 - sTewfiq_DistribUni());
+  return 1.0 / sqrt (1.0 - sAlea_Uni (&pTewfiq->alea));
 }
 
-// Distribution Gaussienne (enfin ça a la forme...)                       ------
-// Remarque : Trouvé sur http://rfv.insa-lyon.fr/~jolion/STAT/node56.html ------
+// Distribution Gaussienne (centrée, écart-type pVariance) ---------------------
 //> Valeur calculée via la loi de probabilité
-float sTewfiq_DistribGauss (float pVariance)
+float sTewfiq_DistribGauss
+  (sTewfiq* pTewfiq,   //: Tewfiq (générateur) utilisé
+   float    pVariance) //: Facteur d'échelle
 {
-	float tMax = 100.0, tEui = 0.0;
-	int i; for (i = 0; i < tMax; i++) { tEui += sTewfiq_DistribUni(); }
-	return (sqrt (12.0 / tMax) * (tEui - tMax / 2.0)) * pVariance;
+  return sAlea_Gauss (&pTewfiq->alea) * pVariance;
 }
 
 // Création d'un nouveau tewfiq ------------------------------------------------
 //> Nouveau tewfiq
 sTewfiq sTewfiq_New1()
 {
-  //srand((unsigned)time(NULL));
-
-  return INIT_TEWFIQ;
+  return sTewfiq_New3 (0.001, 1.000, TEWFIQ_GRAINE);
 }
 
 // Création d'un nouveau tewfiq ------------------------------------------------
@@ -80,26 +102,45 @@ sTewfiq sTewfiq_New2
   (double pOptionP, //: Valeur désirée pour la probabilité P
    double pOptionQ) //: Valeur désirée pour la probabilité Q
 {
-  //srand((unsigned)time(NULL));
+  return sTewfiq_New3 (pOptionP, pOptionQ, TEWFIQ_GRAINE);
+}
+
+// Création d'un nouveau tewfiq à générateur propre (même graine = mêmes -------
+// pertes, quel que soit le thread)                                      -------
+//> Nouveau tewfiq
+sTewfiq sTewfiq_New3
+  (double   pOptionP, //: Valeur désirée pour la probabilité P
+   double   pOptionQ, //: Valeur désirée pour la probabilité Q
+   uint64_t pGraine)  //: Graine du générateur aléatoire
+{
+  sTewfiq _tewfiq;
+  memset (&_tewfiq, 0, sizeof (sTewfiq));
 
-  sTewfiq _tewfiq = INIT_TEWFIQ;
+  _tewfiq.alea    = sAlea_New (pGraine);
   _tewfiq.optionP = pOptionP;
   _tewfiq.optionQ = pOptionQ;
+  _tewfiq.logP    = log1p (-pOptionP);
+  _tewfiq.logQ    = log1p (-pOptionQ);
+
+  // Démarre à ok : le premier séjour est tiré au premier paquet
+  _tewfiq.etat  = false;
+  _tewfiq.reste = 0;
+
   return _tewfiq;
 }
 
 //              (1-p)
-//              ------
+//              - --------------------------------------------------------------
 //             |      |
 //             |      v
-//     ---- (état ok media) <----
+//     ---- (état ok media) < --------------------------------------------------
 //    |                         |
 //  p |                         | q
 //    |                         |
-//     --> (état perte media) ---
+//     --> (état perte media) --------------------------------------------------
 //             ^      |
 //             |      |
-//              ------
+//              - --------------------------------------------------------------
 //              (1-q)
 
 // Simule un médium réseau (avec les probabilités de passage à perte / à ok) ---
@@ -109,18 +150,9 @@ bool sTewfiq_IsOkayOrLost
 {
   ASSERTpc (pTewfiq, false, cExNullPtr)
 
-  if (pTewfiq->etat)
-  {
-    if (RAND(1000) <= pTewfiq->optionP * 1000)
-    {
-      pTewfiq->etat = false;
-      pTewfiq->quantitePertes++;
-    }
-  }
-  else
-  {
-    if (RAND(1000) <= pTewfiq->optionQ * 1000) pTewfiq->etat = true;
-  }
+  while (pTewfiq->reste == 0) Transition (pTewfiq);
+
+  if (pTewfiq->reste != UINT64_MAX) pTewfiq->reste--;
 
   if (pTewfiq->etat) pTewfiq->nombreOk    ++;
   else               pTewfiq->nombrePertes++;
@@ -128,6 +160,56 @@ bool sTewfiq_IsOkayOrLost
   return pTewfiq->etat;
 }
 
+// Simule pNombre paquets d'un coup : bit n de pMasque = paquet n perdu      ---
+// Les séjours sont appliqués par mots de 64 bits (pas de tirage par paquet) ---
+//> Nombre de paquets perdus
+unsigned sTewfiq_Masque
+  (sTewfiq* pTewfiq, //: Tewfiq utilisé
+   uint64_t* pMasque, //: Masque de pertes ((pNombre+63)/64 mots)
+   unsigned pNombre)  //: Nombre de paquets à simuler
+{
+  ASSERTpc (pTewfiq, 0, cExNullPtr)
+  ASSERTpc (pMasque, 0, cExNullPtr)
+
+  unsigned _pos = 0, _pertes = 0;
+
+  memset (pMasque, 0, ((pNombre + 63) / 64) * sizeof (uint64_t));
+
+  while (_pos < pNombre)
+  {
+    while (pTewfiq->reste == 0) Transition (pTewfiq);
+
+    unsigned _n = pNombre - _pos;
+    if (pTewfiq->reste < _n) _n = pTewfiq->reste;
+
+    if (pTewfiq->reste != UINT64_MAX) pTewfiq->reste -= _n;
+
+    if (pTewfiq->etat)
+    {
+      pTewfiq->nombreOk += _n;
+      _pos += _n;
+      continue;
+    }
+
+    pTewfiq->nombrePertes += _n;
+    _pertes += _n;
+
+    // Met à 1 les bits [_pos, _pos+_n[ mot par mot
+    for (; _n > 0;)
+    {
+      unsigned _bit = _pos & 63;
+      unsigned _nb  = 64 - _bit < _n ? 64 - _bit : _n;
+
+      pMasque[_pos >> 6] |= (_nb == 64 ? UINT64_MAX :
+                             ((UINT64_C(1) << _nb) - 1)) << _bit;
+      _pos += _nb;
+      _n   -= _nb;
+    }
+  }
+
+  return _pertes;
+}
+
 // Affiche (et enregistre dans un fichier) les statistiques Tewfiq :-)     -----
 // (Qui est le nom de mon ex professeur de télétrafique, alias télétewfiq) -----
 void sTewfiq_Print
@@ -139,8 +221,8 @@ void sTewfiq_Print
     (100.0 * pTewfiq->nombreOk) / (pTewfiq->nombreOk + pTewfiq->nombrePertes);
 
   PRINT1 ("statistiques avant traitement de FEC \n"
-          "nombre de paquets media arrives sans embuche = %lu (%g %%)\n"
-          "nombre de paquets media perdus (simule) = %lu (%g %%)\n"
+          "nombre de paquets media arrives sans embuche = %u (%g %%)\n"
+          "nombre de paquets media perdus (simule) = %u (%g %%)\n"
           "longueur moyenne d'un burst de perte = %g\n\n",
           pTewfiq->nombreOk,             _PourcentOk,
           pTewfiq->nombrePertes, 100.0 - _PourcentOk,
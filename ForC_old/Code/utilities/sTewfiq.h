@@ -1,7 +1,7 @@
 /**************************************************************************************************\
         OPTIMIZED AND CROSS PLATFORM SMPTE 2022-1 FEC LIBRARY IN C, JAVA, PYTHON, +TESTBENCH
 
-    Description    : TODO
+    Description    : Gilbert-Elliott channel model (Tewfiq)
     Main Developer : David Fischer (david.fischer.ch@gmail.com)
     Copyright      : Copyright (c) 2008-2013 smpte2022lib Team. All rights reserved.
     Sponsoring     : Developed for a HES-SO CTI Ra&D project called GaVi
@@ -30,29 +30,37 @@
 
 // Types de données ============================================================
 
-// Structure représentant un Tewfiq --------------------------------------------
+// Structure représentant un Tewfiq (canal de Gilbert-Elliott)                --
+// Remarque : les séjours dans un état sont tirés d'un coup (loi géométrique) --
+//            ce qui permet de produire les masques de pertes par blocs       --
 
 typedef struct
 {
+  sAlea    alea;           //. Générateur aléatoire propre à l'instance
   bool     etat;           //. Etat (ok ou perte) en cours
+  uint64_t reste;          //. Paquets restant à passer dans l'état en cours
   uint32_t nombreOk;       //. Statistiques (nombre de non perte)
   uint32_t nombrePertes;   //. Statistiques (nombre de pertes)
   uint32_t quantitePertes; //. Statistiques (nombre de passages à)
   double   optionP;        //. Probabilité de passer de ok à perte sur 1.0
   double   optionQ;        //. Probabilité de passer de perte à ok sur 1.0
+  double   logP;           //. log (1 - optionP) : durée des séjours ok
+  double   logQ;           //. log (1 - optionQ) : durée des séjours perte
 } sTewfiq;
 
 // Déclaration des Fonctions ===================================================
 
-float sTewfiq_DistribUni();
-float sTewfiq_DistribExp();
-float sTewfiq_DistribPareto();
-float sTewfiq_DistribGauss (float pVariance);
+float sTewfiq_DistribUni    (sTewfiq*);
+float sTewfiq_DistribExp    (sTewfiq*);
+float sTewfiq_DistribPareto (sTewfiq*);
+float sTewfiq_DistribGauss  (sTewfiq*, float pVariance);
 
 sTewfiq sTewfiq_New1 ();
 sTewfiq sTewfiq_New2 (double pOptionP, double pOptionQ);
+sTewfiq sTewfiq_New3 (double pOptionP, double pOptionQ, uint64_t pGraine);
 
-bool sTewfiq_IsOkayOrLost (      sTewfiq*);
-void sTewfiq_Print        (const sTewfiq*);
+bool     sTewfiq_IsOkayOrLost (      sTewfiq*);
+unsigned sTewfiq_Masque       (      sTewfiq*, uint64_t* pMasque, unsigned);
+void     sTewfiq_Print        (const sTewfiq*);
 
 #endif